@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "commonroad_cpp/geometry/shape.h"
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/obstacle/obstacle.h"
+#include "commonroad_cpp/predicates/position/left_of_predicate.h"
+#include "commonroad_cpp/predicates/position/right_of_predicate.h"
+#include "commonroad_cpp/world.h"
+
+#include "benchmark_utils.h"
+
+// The global allocation functions are replaced to count all allocations. This file is therefore built as a separate
+// executable so that the allocation costs of the other benchmarks are not affected.
+
+namespace {
+
+// number of allocations of the current thread
+thread_local int64_t numAllocations{0};
+
+} // namespace
+
+void *operator new(size_t size) {
+    if (void *ptr{std::malloc(size == 0 ? 1 : size)}) {
+        ++numAllocations;
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+static void BM_ObstaclePredicateSweepAllocations(benchmark::State &state) {
+    // evaluates position predicates for all obstacle pairs at the initial time step; the occupancy polygons of all
+    // obstacles are cached before the measurement, so that only repeated accesses are measured
+    static std::shared_ptr<World> world;
+    if (world == nullptr) {
+        auto scenario{InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() +
+                                                        "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb")};
+        world = std::make_shared<World>("DEU_Guetersloh-25_4_T-1", 0, scenario.roadNetwork,
+                                        std::vector<std::shared_ptr<Obstacle>>{}, scenario.obstacles,
+                                        scenario.timeStepSize);
+    }
+    LeftOfPredicate leftOf;
+    RightOfPredicate rightOf;
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    for (const auto &obs : world->getObstacles())
+        if (obs->getGeoShape().getType() == ShapeType::rectangle and obs->timeStepExists(0)) {
+            obstacles.push_back(obs);
+            benchmark::DoNotOptimize(obs->getOccupancyPolygonShape(0));
+        }
+    int64_t numEvaluations{0};
+    int64_t allocations{0};
+    for (auto _ : state) {
+        const auto initialAllocations{numAllocations};
+        for (const auto &obsK : obstacles)
+            for (const auto &obsP : obstacles) {
+                if (obsK == obsP)
+                    continue;
+                benchmark::DoNotOptimize(leftOf.booleanEvaluation(0, world, obsK, obsP));
+                benchmark::DoNotOptimize(rightOf.booleanEvaluation(0, world, obsK, obsP));
+                numEvaluations += 2;
+            }
+        allocations += numAllocations - initialAllocations;
+    }
+    state.SetItemsProcessed(numEvaluations);
+    state.counters["allocationsPerEvaluation"] =
+        static_cast<double>(allocations) / static_cast<double>(std::max<int64_t>(numEvaluations, 1));
+}
+BENCHMARK(BM_ObstaclePredicateSweepAllocations);
@@ -0,0 +1,53 @@
+#include "benchmark_utils.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#include "commonroad_cpp/obstacle/obstacle.h"
+#include "commonroad_cpp/obstacle/state.h"
+
+#include "predicate_categories.h"
+
+std::string BenchmarkUtils::getScenarioDirectory() {
+    auto curDir{std::filesystem::current_path()};
+    auto parent{curDir.parent_path()};
+
+    for (const auto &candidate : {curDir, parent, parent.parent_path()}) {
+        auto candidateScenarioDir{candidate / "tests" / "scenarios"};
+        if (std::filesystem::is_directory(candidateScenarioDir)) {
+            return candidateScenarioDir.string();
+        }
+    }
+
+    throw std::runtime_error{"could not find test scenario directory"};
+}
+
+std::vector<std::shared_ptr<Obstacle>> BenchmarkUtils::createObstacles(const size_t numObstacles,
+                                                                       const size_t timeStep, const size_t firstId) {
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    obstacles.reserve(numObstacles);
+    for (size_t idx{0}; idx < numObstacles; ++idx) {
+        auto state{std::make_shared<State>(timeStep, 10.0 * static_cast<double>(idx % 100),
+                                           4.0 * static_cast<double>(idx / 100), 10.0, 0.0, 0.0)};
+        obstacles.push_back(std::make_shared<Obstacle>(firstId + idx, ObstacleRole::DYNAMIC, state, ObstacleType::car,
+                                                       50.0, 10.0, 10.0, -10.0, 0.3, state_map_t{}, 5.0, 2.0));
+    }
+    return obstacles;
+}
+
+std::string BenchmarkUtils::getPredicateCategory(const std::string &predicateName) {
+    for (const auto &[name, category] : predicateCategories)
+        if (name == predicateName)
+            return std::string{category};
+    return {};
+}
+
+std::vector<std::string> BenchmarkUtils::getPredicateCategories() {
+    std::vector<std::string> categories;
+    for (const auto &[name, category] : predicateCategories)
+        categories.emplace_back(category);
+    std::sort(categories.begin(), categories.end());
+    categories.erase(std::unique(categories.begin(), categories.end()), categories.end());
+    return categories;
+}
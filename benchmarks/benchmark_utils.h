@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Obstacle;
+
+/**
+ * Collection of utility functions for benchmark execution.
+ */
+namespace BenchmarkUtils {
+
+/**
+ * Searches for path to directory where test scenarios are located.
+ *
+ * @return Path.
+ */
+std::string getScenarioDirectory();
+
+/**
+ * Creates dynamic obstacles with consecutive IDs which are placed on a grid without overlapping each other.
+ *
+ * @param numObstacles Number of obstacles which should be created.
+ * @param timeStep Time step of the current state of each obstacle.
+ * @param firstId ID of first obstacle.
+ * @return List of pointers to obstacles.
+ */
+std::vector<std::shared_ptr<Obstacle>> createObstacles(size_t numObstacles, size_t timeStep, size_t firstId = 1);
+
+/**
+ * Getter for the category of a predicate, i.e., the directory containing the predicate.
+ *
+ * @param predicateName Name of the predicate as used in the predicate map.
+ * @return Category of the predicate. Empty if the predicate is unknown.
+ */
+std::string getPredicateCategory(const std::string &predicateName);
+
+/**
+ * Getter for all predicate categories.
+ *
+ * @return Sorted list of distinct categories.
+ */
+std::vector<std::string> getPredicateCategories();
+
+} // namespace BenchmarkUtils
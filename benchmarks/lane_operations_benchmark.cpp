@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lane_operations.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+// scenarios with many branching lanelets, selected via the benchmark argument
+const std::array<std::string, 3> branchingScenarios{"USA_Lanker-1/USA_Lanker-1_1_T-1.pb",
+                                                    "DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb",
+                                                    "ZAM_CARLA-10/ZAM_CARLA-10.pb"};
+
+// default sensor parameters and number of intersections used by the world for lane creation
+constexpr double fovFront{150.0};
+constexpr double fovRear{100.0};
+constexpr int numIntersections{1};
+
+std::shared_ptr<RoadNetwork> loadRoadNetwork(const benchmark::State &state) {
+    auto roadNetwork{InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() + "/" +
+                                                       branchingScenarios.at(static_cast<size_t>(state.range(0))))
+                         .roadNetwork};
+    roadNetwork->setIdCounterRef(std::make_shared<size_t>(0));
+    return roadNetwork;
+}
+
+} // namespace
+
+static void BM_LaneOperationsEnumerateLaneletSequences(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork(state)};
+    size_t numSequences{0};
+    for (auto _ : state) {
+        for (const auto &let : roadNetwork->getLaneletNetwork()) {
+            const auto successorParts{
+                lane_operations::enumerateLaneletSequences(let, fovFront, numIntersections, true)};
+            const auto predecessorParts{
+                lane_operations::enumerateLaneletSequences(let, fovRear, numIntersections, false)};
+            numSequences += successorParts.leaves.size() + predecessorParts.leaves.size();
+        }
+    }
+    benchmark::DoNotOptimize(numSequences);
+    state.SetItemsProcessed(static_cast<int64_t>(numSequences));
+}
+BENCHMARK(BM_LaneOperationsEnumerateLaneletSequences)->DenseRange(0, branchingScenarios.size() - 1);
+
+static void BM_LaneOperationsCombineLaneletAndSuccessors(benchmark::State &state) {
+    // materialized sequences as returned by the previous recursive interface
+    auto roadNetwork{loadRoadNetwork(state)};
+    size_t numSequences{0};
+    for (auto _ : state) {
+        for (const auto &let : roadNetwork->getLaneletNetwork()) {
+            const auto successorParts{
+                lane_operations::combineLaneletAndSuccessorsToLane(let, fovFront, numIntersections)};
+            const auto predecessorParts{
+                lane_operations::combineLaneletAndPredecessorsToLane(let, fovRear, numIntersections)};
+            numSequences += successorParts.size() + predecessorParts.size();
+        }
+    }
+    benchmark::DoNotOptimize(numSequences);
+    state.SetItemsProcessed(static_cast<int64_t>(numSequences));
+}
+BENCHMARK(BM_LaneOperationsCombineLaneletAndSuccessors)->DenseRange(0, branchingScenarios.size() - 1);
+
+static void BM_LaneOperationsCreateLanesForAllLanelets(benchmark::State &state) {
+    for (auto _ : state) {
+        // lanes are registered in the road network -> a new road network is required for each iteration
+        state.PauseTiming();
+        auto roadNetwork{loadRoadNetwork(state)};
+        state.ResumeTiming();
+        lane_operations::createLanesForAllLanelets(roadNetwork->getLaneletNetwork(), roadNetwork, fovFront, fovRear,
+                                                   numIntersections, {}, 1);
+    }
+}
+BENCHMARK(BM_LaneOperationsCreateLanesForAllLanelets)
+    ->DenseRange(0, branchingScenarios.size() - 1)
+    ->Unit(benchmark::kMillisecond);
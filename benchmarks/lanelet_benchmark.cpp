@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <boost/geometry.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
+#include "commonroad_cpp/geometry/geometric_operations.h"
+#include "commonroad_cpp/geometry/oriented_bounding_box.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
+
+namespace bg = boost::geometry;
+
+namespace {
+
+constexpr size_t numQueries{256};
+
+// curved lanelet with the given number of vertices and a spacing of one meter, as obtained for long highway lanes
+Lanelet createLongLanelet(size_t numVertices) {
+    std::vector<vertex> leftBorder;
+    std::vector<vertex> rightBorder;
+    for (size_t idx{0}; idx < numVertices; ++idx) {
+        const double xPos{static_cast<double>(idx)};
+        const double yPos{50.0 * std::sin(xPos / 200.0)};
+        leftBorder.push_back({xPos, yPos + 1.75});
+        rightBorder.push_back({xPos, yPos - 1.75});
+    }
+    return Lanelet{1, leftBorder, rightBorder, {LaneletType::highway}};
+}
+
+// positions of vehicles close to the center line
+std::vector<vertex> createQueries(size_t numVertices) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distributionX{0.0, static_cast<double>(numVertices)};
+    std::uniform_real_distribution<double> distributionY{-5.0, 5.0};
+    std::vector<vertex> queries;
+    for (size_t idx{0}; idx < numQueries; ++idx) {
+        const double xPos{distributionX(generator)};
+        queries.push_back({xPos, 50.0 * std::sin(xPos / 200.0) + distributionY(generator)});
+    }
+    return queries;
+}
+
+// occupancy polygons of vehicles at the query positions
+std::vector<polygon_type> createRectangles(const std::vector<vertex> &positions) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distributionOrientation{-0.5, 0.5};
+    std::vector<polygon_type> rectangles;
+    for (const auto &position : positions) {
+        const auto vertices{geometric_operations::rotateAndTranslateVertices(
+            geometric_operations::addObjectDimensionsRectangle({vertex{0.0, 0.0}}, 4.5, 1.8), position,
+            distributionOrientation(generator))};
+        polygon_type polygon;
+        for (const auto &vert : vertices)
+            polygon.outer().emplace_back(vert.x, vert.y);
+        polygon.outer().emplace_back(vertices.front().x, vertices.front().y);
+        rectangles.push_back(polygon);
+    }
+    return rectangles;
+}
+
+} // namespace
+
+static void BM_LaneletFindClosestIndex(benchmark::State &state) {
+    const auto numVertices{static_cast<size_t>(state.range(0))};
+    const auto lanelet{createLongLanelet(numVertices)};
+    const auto queries{createQueries(numVertices)};
+    for (auto _ : state) {
+        for (const auto &query : queries)
+            benchmark::DoNotOptimize(lanelet.findClosestIndex(query.x, query.y));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numQueries));
+}
+BENCHMARK(BM_LaneletFindClosestIndex)->RangeMultiplier(4)->Range(32, 8192);
+
+// reference: scan of all center vertices
+static void BM_LaneletFindClosestIndexLinear(benchmark::State &state) {
+    const auto numVertices{static_cast<size_t>(state.range(0))};
+    const auto lanelet{createLongLanelet(numVertices)};
+    const auto queries{createQueries(numVertices)};
+    const auto &centerVertices{lanelet.getCenterVertices()};
+    for (auto _ : state) {
+        for (const auto &query : queries) {
+            double minimumDiff{std::numeric_limits<double>::infinity()};
+            size_t minimumIndex{0};
+            for (size_t idx{0}; idx < centerVertices.size() - 1; ++idx) {
+                const double diffX{centerVertices[idx].x - query.x};
+                const double diffY{centerVertices[idx].y - query.y};
+                if (diffX * diffX + diffY * diffY < minimumDiff) {
+                    minimumDiff = diffX * diffX + diffY * diffY;
+                    minimumIndex = idx;
+                }
+            }
+            benchmark::DoNotOptimize(minimumIndex);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numQueries));
+}
+BENCHMARK(BM_LaneletFindClosestIndexLinear)->RangeMultiplier(4)->Range(32, 8192);
+
+static void BM_LaneletIntersectionPolygon(benchmark::State &state) {
+    const auto numVertices{static_cast<size_t>(state.range(0))};
+    const auto lanelet{createLongLanelet(numVertices)};
+    const auto rectangles{createRectangles(createQueries(numVertices))};
+    for (auto _ : state) {
+        for (const auto &rectangle : rectangles)
+            benchmark::DoNotOptimize(lanelet.applyIntersectionTesting(rectangle));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numQueries));
+}
+BENCHMARK(BM_LaneletIntersectionPolygon)->RangeMultiplier(4)->Range(8, 512);
+
+// includes the creation of the boxes as done for each time step of an obstacle
+static void BM_LaneletIntersectionOrientedBoundingBox(benchmark::State &state) {
+    const auto numVertices{static_cast<size_t>(state.range(0))};
+    const auto lanelet{createLongLanelet(numVertices)};
+    const auto rectangles{createRectangles(createQueries(numVertices))};
+    for (auto _ : state) {
+        for (const auto &rectangle : rectangles)
+            benchmark::DoNotOptimize(
+                lanelet.applyIntersectionTesting(OrientedBoundingBox::fromRectangle(rectangle), rectangle));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numQueries));
+}
+BENCHMARK(BM_LaneletIntersectionOrientedBoundingBox)->RangeMultiplier(4)->Range(8, 512);
+
+static void BM_RectangleIntersectionPolygon(benchmark::State &state) {
+    const auto rectangles{createRectangles(createQueries(32))};
+    for (auto _ : state) {
+        for (size_t idx{1}; idx < rectangles.size(); ++idx)
+            benchmark::DoNotOptimize(bg::intersects(rectangles[idx - 1], rectangles[idx]));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (numQueries - 1)));
+}
+BENCHMARK(BM_RectangleIntersectionPolygon);
+
+static void BM_RectangleIntersectionOrientedBoundingBox(benchmark::State &state) {
+    std::vector<OrientedBoundingBox> boxes;
+    for (const auto &rectangle : createRectangles(createQueries(32)))
+        boxes.push_back(OrientedBoundingBox::fromRectangle(rectangle));
+    for (auto _ : state) {
+        for (size_t idx{1}; idx < boxes.size(); ++idx)
+            benchmark::DoNotOptimize(boxes[idx - 1].intersects(boxes[idx]));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (numQueries - 1)));
+}
+BENCHMARK(BM_RectangleIntersectionOrientedBoundingBox);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/roadNetwork/intersection/incoming_group.h"
+#include "commonroad_cpp/roadNetwork/intersection/intersection.h"
+#include "commonroad_cpp/roadNetwork/intersection/outgoing_group.h"
+#include "commonroad_cpp/roadNetwork/lanelet/dijkstra.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet_graph.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+// scenarios with intersections, selected via the benchmark argument
+const std::array<std::string, 3> intersectionScenarios{"USA_Lanker-1/USA_Lanker-1_1_T-1.pb",
+                                                       "DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb",
+                                                       "ZAM_CARLA-10/ZAM_CARLA-10.pb"};
+
+std::shared_ptr<RoadNetwork> loadRoadNetwork(const benchmark::State &state) {
+    return InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() + "/" +
+                                             intersectionScenarios.at(static_cast<size_t>(state.range(0))))
+        .roadNetwork;
+}
+
+// path queries from each incoming lanelet to each outgoing lanelet of an intersection
+std::vector<std::array<size_t, 2>> createIntersectionQueries(const std::shared_ptr<RoadNetwork> &roadNetwork) {
+    std::vector<std::array<size_t, 2>> queries;
+    for (const auto &inter : roadNetwork->getIntersections())
+        for (const auto &inc : inter->getIncomingGroups())
+            for (const auto &letInc : inc->getIncomingLanelets())
+                for (const auto &out : inter->getOutgoingGroups())
+                    for (const auto &letOut : out->getOutgoingLanelets())
+                        queries.push_back({letInc->getId(), letOut->getId()});
+    return queries;
+}
+
+} // namespace
+
+static void BM_LaneletGraphFindPaths(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork(state)};
+    const auto queries{createIntersectionQueries(roadNetwork)};
+    for (auto _ : state) {
+        // a new graph per iteration so that no query is answered from the memo of previous iterations
+        state.PauseTiming();
+        LaneletGraph laneletGraph{roadNetwork->getLaneletNetwork()};
+        state.ResumeTiming();
+        for (const auto &query : queries)
+            benchmark::DoNotOptimize(laneletGraph.findPaths(query[0], query[1], false));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(BM_LaneletGraphFindPaths)->DenseRange(0, intersectionScenarios.size() - 1);
+
+static void BM_LaneletGraphFindPathsAdjacencyList(benchmark::State &state) {
+    // reference for the path search: adjacency list graph and Dijkstra run as previously used by the lanelet graph
+    auto roadNetwork{loadRoadNetwork(state)};
+    const auto queries{createIntersectionQueries(roadNetwork)};
+    graph<size_t, size_t> referenceGraph;
+    std::unordered_map<size_t, std::ptrdiff_t> vertices;
+    for (const auto &let : roadNetwork->getLaneletNetwork())
+        vertices.insert({let->getId(), referenceGraph.add_vertex(let->getId())});
+    for (const auto &let : roadNetwork->getLaneletNetwork())
+        for (const auto &suc : let->getSuccessors())
+            referenceGraph.add_edge(vertices.at(let->getId()), vertices.at(suc->getId()), 1);
+    for (auto _ : state) {
+        for (const auto &query : queries) {
+            const dijkstra<size_t, size_t> searcher{referenceGraph, vertices.at(query[0])};
+            benchmark::DoNotOptimize(searcher.search_path(vertices.at(query[1])));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(BM_LaneletGraphFindPathsAdjacencyList)->DenseRange(0, intersectionScenarios.size() - 1);
+
+static void BM_LaneletGraphFindPathsMemo(benchmark::State &state) {
+    // memoized queries shared by all benchmark threads
+    static std::shared_ptr<RoadNetwork> roadNetwork;
+    static std::vector<std::array<size_t, 2>> queries;
+    if (state.thread_index() == 0) {
+        roadNetwork = loadRoadNetwork(state);
+        queries = createIntersectionQueries(roadNetwork);
+        for (const auto &query : queries)
+            roadNetwork->getTopologicalMap()->findPaths(query[0], query[1], false);
+    }
+    for (auto _ : state) {
+        for (const auto &query : queries)
+            benchmark::DoNotOptimize(roadNetwork->getTopologicalMap()->findPaths(query[0], query[1], false));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(BM_LaneletGraphFindPathsMemo)->Arg(0)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_LaneletGraphIsReachable(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork(state)};
+    const auto queries{createIntersectionQueries(roadNetwork)};
+    const auto &laneletGraph{roadNetwork->getTopologicalMap()};
+    for (auto _ : state) {
+        for (const auto &query : queries)
+            benchmark::DoNotOptimize(laneletGraph->isReachable(query[0], query[1]));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(BM_LaneletGraphIsReachable)->DenseRange(0, intersectionScenarios.size() - 1);
@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <geometry/curvilinear_coordinate_system.h>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "commonroad_cpp/geometry/shape.h"
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/obstacle/obstacle.h"
+#include "commonroad_cpp/obstacle/obstacle_cache.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lane.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+constexpr time_step_t numTimeSteps{100};
+
+// bytes allocated by counting allocators of the current thread which are not freed yet; used for the memory benchmarks
+thread_local int64_t allocatedBytes{0};
+
+// allocator which tracks the memory of the cache under test without affecting allocations of other benchmarks
+template <typename T> struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U> explicit CountingAllocator(const CountingAllocator<U> &) {}
+
+    T *allocate(const size_t num) {
+        allocatedBytes += static_cast<int64_t>(num * sizeof(T));
+        return std::allocator<T>{}.allocate(num);
+    }
+
+    void deallocate(T *ptr, const size_t num) {
+        allocatedBytes -= static_cast<int64_t>(num * sizeof(T));
+        std::allocator<T>{}.deallocate(ptr, num);
+    }
+
+    template <typename U> bool operator==(const CountingAllocator<U> &) const { return true; }
+    template <typename U> bool operator!=(const CountingAllocator<U> &) const { return false; }
+};
+
+template <typename Value>
+using CountingHashTimeStepStorage = HashTimeStepStorage<Value, CountingAllocator<std::pair<time_step_t, Value>>>;
+template <typename Value> using CountingDenseTimeStepStorage = DenseTimeStepStorage<Value, CountingAllocator<Value>>;
+
+} // namespace
+
+template <template <typename...> class Storage> static void BM_TimeStepCacheFind(benchmark::State &state) {
+    ShardedTimeStepMap<double, Storage> cache;
+    const auto numSteps{static_cast<time_step_t>(state.range(0))};
+    for (time_step_t timeStep{0}; timeStep < numSteps; ++timeStep)
+        cache.emplace(timeStep, static_cast<double>(timeStep));
+    for (auto _ : state) {
+        for (time_step_t timeStep{0}; timeStep < numSteps; ++timeStep)
+            benchmark::DoNotOptimize(cache.find(timeStep));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numSteps));
+}
+BENCHMARK_TEMPLATE(BM_TimeStepCacheFind, HashTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_TimeStepCacheFind, DenseTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+
+template <template <typename...> class Storage> static void BM_TimeStepCacheInsert(benchmark::State &state) {
+    const auto numSteps{static_cast<time_step_t>(state.range(0))};
+    for (auto _ : state) {
+        ShardedTimeStepMap<double, Storage> cache;
+        for (time_step_t timeStep{0}; timeStep < numSteps; ++timeStep)
+            cache.emplace(timeStep, static_cast<double>(timeStep));
+        benchmark::DoNotOptimize(cache.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numSteps));
+}
+BENCHMARK_TEMPLATE(BM_TimeStepCacheInsert, HashTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_TimeStepCacheInsert, DenseTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+
+template <template <typename...> class Storage> static void BM_TimeStepCacheMemory(benchmark::State &state) {
+    const auto numSteps{static_cast<time_step_t>(state.range(0))};
+    int64_t bytes{0};
+    for (auto _ : state) {
+        const auto initialBytes{allocatedBytes};
+        ShardedTimeStepMap<double, Storage> cache;
+        // only the latest half of the time steps is kept, as done for the history of obstacles within a world
+        for (time_step_t timeStep{0}; timeStep < numSteps; ++timeStep) {
+            cache.emplace(timeStep, static_cast<double>(timeStep));
+            if (timeStep >= numSteps / 2)
+                cache.erase(timeStep - numSteps / 2);
+        }
+        bytes = allocatedBytes - initialBytes;
+        benchmark::DoNotOptimize(cache.size());
+    }
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.counters["bytesPerValue"] = static_cast<double>(bytes) / static_cast<double>(numSteps / 2);
+}
+BENCHMARK_TEMPLATE(BM_TimeStepCacheMemory, CountingHashTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_TimeStepCacheMemory, CountingDenseTimeStepStorage)->RangeMultiplier(4)->Range(16, 1024);
+
+static void BM_ObstacleCacheFind(benchmark::State &state) {
+    static ObstacleCache cache;
+    if (state.thread_index() == 0) {
+        cache.clear();
+        for (time_step_t timeStep{0}; timeStep < numTimeSteps; ++timeStep)
+            cache.frontXYPositions.emplace(timeStep, {1.0, 2.0});
+    }
+    for (auto _ : state) {
+        for (time_step_t timeStep{0}; timeStep < numTimeSteps; ++timeStep)
+            benchmark::DoNotOptimize(cache.frontXYPositions.find(timeStep));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numTimeSteps));
+}
+BENCHMARK(BM_ObstacleCacheFind)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ObstacleCacheModify(benchmark::State &state) {
+    static ObstacleCache cache;
+    if (state.thread_index() == 0)
+        cache.clear();
+    const auto threadIdx{static_cast<size_t>(state.thread_index())};
+    for (auto _ : state) {
+        for (time_step_t timeStep{0}; timeStep < numTimeSteps; ++timeStep)
+            cache.lateralDistanceToObjects.modify(timeStep,
+                                                  [threadIdx](auto &distances) { distances[threadIdx] = 1.0; });
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numTimeSteps));
+}
+BENCHMARK(BM_ObstacleCacheModify)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ObstacleConcurrentEvaluation(benchmark::State &state) {
+    // all threads evaluate the same obstacles of one scenario, as done for predicate evaluation within a world
+    static std::shared_ptr<RoadNetwork> roadNetwork;
+    static std::vector<std::shared_ptr<Obstacle>> obstacles;
+    if (state.thread_index() == 0 and roadNetwork == nullptr) {
+        auto scenario{InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() +
+                                                        "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb")};
+        roadNetwork = scenario.roadNetwork;
+        for (const auto &obs : scenario.obstacles)
+            if (obs->getGeoShape().getType() == ShapeType::rectangle)
+                obstacles.push_back(obs);
+    }
+    int64_t numQueries{0};
+    for (auto _ : state) {
+        for (const auto &obs : obstacles) {
+            for (const auto &timeStep : obs->getTimeSteps()) {
+                benchmark::DoNotOptimize(obs->getOccupiedLaneletsByShape(roadNetwork, timeStep));
+                benchmark::DoNotOptimize(obs->getFrontXYCoordinates(timeStep));
+                ++numQueries;
+            }
+        }
+    }
+    state.SetItemsProcessed(numQueries);
+}
+BENCHMARK(BM_ObstacleConcurrentEvaluation)->ThreadRange(1, 8)->UseRealTime();
+
+template <bool Batched> static void BM_ObstacleCurvilinearProjection(benchmark::State &state) {
+    // projects the positions of all obstacles of one scenario onto the reference lane of each obstacle
+    static std::vector<std::tuple<std::shared_ptr<Obstacle>, std::shared_ptr<geometry::CurvilinearCoordinateSystem>,
+                                  std::vector<size_t>>>
+        projections;
+    static std::shared_ptr<RoadNetwork> roadNetwork;
+    if (roadNetwork == nullptr) {
+        auto scenario{InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() +
+                                                        "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb")};
+        roadNetwork = scenario.roadNetwork;
+        roadNetwork->setIdCounterRef(std::make_shared<size_t>(123456789));
+        for (const auto &obs : scenario.obstacles) {
+            if (obs->getGeoShape().getType() != ShapeType::rectangle)
+                continue;
+            const auto ccs{obs->getReferenceLane(roadNetwork, obs->getCurrentState()->getTimeStep())
+                               ->getCurvilinearCoordinateSystem()};
+            std::vector<size_t> timeSteps;
+            for (const auto &timeStep : obs->getTimeSteps())
+                if (ccs->cartesianPointInProjectionDomain(obs->getStateByTimeStep(timeStep)->getXPosition(),
+                                                          obs->getStateByTimeStep(timeStep)->getYPosition()))
+                    timeSteps.push_back(timeStep);
+            projections.emplace_back(obs, ccs, timeSteps);
+        }
+    }
+    int64_t numPoints{0};
+    for (auto _ : state) {
+        for (const auto &[obs, ccs, timeSteps] : projections) {
+            state.PauseTiming();
+            obs->clearCache();
+            state.ResumeTiming();
+            if constexpr (Batched)
+                benchmark::DoNotOptimize(obs->convertPointsToCurvilinear(timeSteps, ccs));
+            else
+                for (const auto &timeStep : timeSteps)
+                    benchmark::DoNotOptimize(obs->convertPointToCurvilinear(timeStep, ccs));
+            numPoints += static_cast<int64_t>(timeSteps.size());
+        }
+    }
+    state.SetItemsProcessed(numPoints);
+}
+BENCHMARK_TEMPLATE(BM_ObstacleCurvilinearProjection, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ObstacleCurvilinearProjection, true)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,312 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "commonroad_cpp/auxiliaryDefs/task_scheduler.h"
+#include "commonroad_cpp/geometry/geometric_operations.h"
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/obstacle/obstacle.h"
+#include "commonroad_cpp/predicates/commonroad_predicate.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+#include "commonroad_cpp/world.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+constexpr size_t maxNumObstacles{8};
+constexpr double fieldOfViewRadius{200.0};
+constexpr size_t maxTimeStep{20};
+constexpr size_t timeStepsPerTask{5};
+
+std::shared_ptr<World> createWorld() {
+    auto scenario{InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() +
+                                                    "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb")};
+    scenario.roadNetwork->setIdCounterRef(std::make_shared<size_t>(1000000));
+    // the scenario does not define fields of view, which are required by some predicates
+    for (const auto &obs : scenario.obstacles)
+        if (obs->timeStepExists(0))
+            obs->setFov(geometric_operations::addObjectDimensionsCircle(
+                vertex{obs->getStateByTimeStep(0)->getXPosition(), obs->getStateByTimeStep(0)->getYPosition()},
+                fieldOfViewRadius));
+    return std::make_shared<World>("DEU_Guetersloh-25_4_T-1", 0, scenario.roadNetwork,
+                                   std::vector<std::shared_ptr<Obstacle>>{}, scenario.obstacles,
+                                   scenario.timeStepSize);
+}
+
+// collects the ordered pairs of obstacles existing at the initial time step for which the predicate can be evaluated
+// at all considered time steps
+std::vector<ObstaclePair> createObstaclePairs(const std::shared_ptr<World> &world,
+                                              const std::shared_ptr<CommonRoadPredicate> &predicate,
+                                              const std::vector<std::string> &additionalFunctionParameters) {
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    for (const auto &obs : world->getObstacles())
+        if (obs->timeStepExists(0) and obstacles.size() < maxNumObstacles)
+            obstacles.push_back(obs);
+    std::vector<ObstaclePair> obstaclePairs;
+    for (const auto &obsK : obstacles)
+        for (const auto &obsP : obstacles) {
+            if (obsK == obsP)
+                continue;
+            // pairs are skipped if an obstacle leaves the projection domain of the reference lane of the other one
+            try {
+                predicate->CommonRoadPredicate::batchBooleanEvaluation(0, maxTimeStep, world, {{obsK, obsP}},
+                                                                       additionalFunctionParameters);
+                obstaclePairs.emplace_back(obsK, obsP);
+            } catch (const std::runtime_error &) {
+            }
+        }
+    return obstaclePairs;
+}
+
+// collects the obstacles existing at the initial time step
+std::vector<std::shared_ptr<Obstacle>> collectInitialObstacles(const std::shared_ptr<World> &world) {
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    for (const auto &obs : world->getObstacles())
+        if (obs->timeStepExists(0) and obstacles.size() < maxNumObstacles)
+            obstacles.push_back(obs);
+    return obstacles;
+}
+
+// collects the predicates of a category (all predicates if the category is empty) which support the boolean evaluation
+// for all pairs of obstacles at the initial time step
+std::vector<std::shared_ptr<CommonRoadPredicate>>
+collectSupportedPredicates(const std::shared_ptr<World> &world, const std::vector<std::shared_ptr<Obstacle>> &obstacles,
+                           std::string_view category) {
+    std::vector<std::shared_ptr<CommonRoadPredicate>> supportedPredicates;
+    for (const auto &[name, predicate] : predicates) {
+        // test predicates simulate expensive computations by sleeping
+        if (name.find("computation_time_test") != std::string::npos)
+            continue;
+        if (!category.empty() and BenchmarkUtils::getPredicateCategory(name) != category)
+            continue;
+        try {
+            for (const auto &obsK : obstacles)
+                for (const auto &obsP : obstacles)
+                    if (obsK != obsP)
+                        predicate->booleanEvaluation(0, world, obsK, obsP);
+            supportedPredicates.push_back(predicate);
+        } catch (...) {
+        }
+    }
+    return supportedPredicates;
+}
+
+} // namespace
+
+static void BM_PredicateParameterLookupByName(benchmark::State &state) {
+    PredicateParameters parameters;
+    std::vector<std::string> names;
+    for (const auto &name : predicateParamNames)
+        names.emplace_back(name);
+    for (auto _ : state) {
+        for (const auto &name : names)
+            benchmark::DoNotOptimize(parameters.getParam(name));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * names.size()));
+}
+BENCHMARK(BM_PredicateParameterLookupByName);
+
+static void BM_PredicateParameterLookupById(benchmark::State &state) {
+    PredicateParameters parameters;
+    for (auto _ : state) {
+        for (size_t idx{0}; idx < numPredicateParams; ++idx)
+            benchmark::DoNotOptimize(parameters.getParam(static_cast<PredicateParamId>(idx)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPredicateParams));
+}
+BENCHMARK(BM_PredicateParameterLookupById);
+
+// evaluates all predicates which support the boolean evaluation for pairs of obstacles at the initial time step;
+// predicates throwing an exception for any pair are skipped; values cached by obstacles are computed before the
+// measurement
+static void BM_PredicateSuite(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const auto obstacles{collectInitialObstacles(world)};
+    const auto supportedPredicates{collectSupportedPredicates(world, obstacles, {})};
+
+    int64_t numEvaluations{0};
+    for (auto _ : state) {
+        for (const auto &predicate : supportedPredicates)
+            for (const auto &obsK : obstacles)
+                for (const auto &obsP : obstacles) {
+                    if (obsK == obsP)
+                        continue;
+                    benchmark::DoNotOptimize(predicate->booleanEvaluation(0, world, obsK, obsP));
+                    ++numEvaluations;
+                }
+    }
+    state.SetItemsProcessed(numEvaluations);
+    state.counters["predicates"] = static_cast<double>(supportedPredicates.size());
+}
+BENCHMARK(BM_PredicateSuite);
+
+// evaluates a predicate for the ordered pairs of obstacles over the considered time steps; compares the batch
+// evaluation of the predicate with the scalar fallback of the predicate interface
+static void BM_PredicateBatchEvaluation(benchmark::State &state, const std::string &name,
+                                        const std::vector<std::string> &additionalFunctionParameters, bool batch) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const auto &predicate{predicates.at(name)};
+    // values cached by obstacles are computed before the measurement
+    const auto obstaclePairs{createObstaclePairs(world, predicate, additionalFunctionParameters)};
+    if (obstaclePairs.empty()) {
+        state.SkipWithError("No obstacle pair can be evaluated.");
+        return;
+    }
+    const auto evaluate{[&]() {
+        return batch ? predicate->batchBooleanEvaluation(0, maxTimeStep, world, obstaclePairs,
+                                                         additionalFunctionParameters)
+                     : predicate->CommonRoadPredicate::batchBooleanEvaluation(0, maxTimeStep, world, obstaclePairs,
+                                                                              additionalFunctionParameters);
+    }};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluate());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (maxTimeStep + 1) * obstaclePairs.size()));
+    state.counters["pairs"] = static_cast<double>(obstaclePairs.size());
+}
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, in_same_lane_scalar, "in_same_lane_predicate",
+                  std::vector<std::string>{"0.0"}, false);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, in_same_lane_batch, "in_same_lane_predicate",
+                  std::vector<std::string>{"0.0"}, true);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, in_front_of_scalar, "in_front_of_predicate",
+                  std::vector<std::string>{"0.0"}, false);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, in_front_of_batch, "in_front_of_predicate",
+                  std::vector<std::string>{"0.0"}, true);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, keeps_safe_distance_prec_scalar, "keeps_safe_distance_prec_predicate",
+                  std::vector<std::string>{"0.0"}, false);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, keeps_safe_distance_prec_batch, "keeps_safe_distance_prec_predicate",
+                  std::vector<std::string>{"0.0"}, true);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, on_lanelet_with_type_scalar, "on_lanelet_with_type_predicate",
+                  std::vector<std::string>{"urban"}, false);
+BENCHMARK_CAPTURE(BM_PredicateBatchEvaluation, on_lanelet_with_type_batch, "on_lanelet_with_type_predicate",
+                  std::vector<std::string>{"urban"}, true);
+
+// evaluates the predicates of a category like BM_PredicateSuite; registered below for every predicate category
+static void BM_PredicateCategory(benchmark::State &state, const std::string &category) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const auto obstacles{collectInitialObstacles(world)};
+    const auto supportedPredicates{collectSupportedPredicates(world, obstacles, category)};
+    if (supportedPredicates.empty()) {
+        state.SkipWithError("No predicate of the category can be evaluated.");
+        return;
+    }
+
+    int64_t numEvaluations{0};
+    for (auto _ : state) {
+        for (const auto &predicate : supportedPredicates)
+            for (const auto &obsK : obstacles)
+                for (const auto &obsP : obstacles) {
+                    if (obsK == obsP)
+                        continue;
+                    benchmark::DoNotOptimize(predicate->booleanEvaluation(0, world, obsK, obsP));
+                    ++numEvaluations;
+                }
+    }
+    state.SetItemsProcessed(numEvaluations);
+    state.counters["predicates"] = static_cast<double>(supportedPredicates.size());
+}
+[[maybe_unused]] static const bool predicateCategoryBenchmarksRegistered{[]() {
+    for (const auto &category : BenchmarkUtils::getPredicateCategories())
+        benchmark::RegisterBenchmark(("BM_PredicateCategory/" + category).c_str(), BM_PredicateCategory, category);
+    return true;
+}()};
+
+// evaluates several predicates for the ordered pairs of obstacles with one task per predicate and chunk of time steps;
+// all tasks share the world; the scaling curve is obtained by comparing the real time for different numbers of threads
+static void BM_PredicateTaskScheduler(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const std::vector<std::pair<std::string, std::vector<std::string>>> evaluatedPredicates{
+        {"in_same_lane_predicate", {"0.0"}},
+        {"in_front_of_predicate", {"0.0"}},
+        {"keeps_safe_distance_prec_predicate", {"0.0"}},
+        {"on_lanelet_with_type_predicate", {"urban"}}};
+    // values cached by obstacles are computed before the measurement
+    std::vector<std::vector<ObstaclePair>> obstaclePairs;
+    for (const auto &[name, additionalFunctionParameters] : evaluatedPredicates)
+        obstaclePairs.push_back(createObstaclePairs(world, predicates.at(name), additionalFunctionParameters));
+
+    TaskScheduler scheduler{static_cast<size_t>(state.range(0))};
+    int64_t numEvaluations{0};
+    for (auto _ : state) {
+        for (size_t idx{0}; idx < evaluatedPredicates.size(); ++idx)
+            for (size_t firstTimeStep{0}; firstTimeStep <= maxTimeStep; firstTimeStep += timeStepsPerTask) {
+                const size_t lastTimeStep{std::min(firstTimeStep + timeStepsPerTask - 1, maxTimeStep)};
+                scheduler.submit(
+                    [&, idx, firstTimeStep, lastTimeStep]() {
+                        const auto &[name, additionalFunctionParameters]{evaluatedPredicates[idx]};
+                        benchmark::DoNotOptimize(predicates.at(name)->batchBooleanEvaluation(
+                            firstTimeStep, lastTimeStep, world, obstaclePairs[idx], additionalFunctionParameters));
+                    },
+                    evaluatedPredicates[idx].first);
+                numEvaluations += static_cast<int64_t>((lastTimeStep - firstTimeStep + 1) * obstaclePairs[idx].size());
+            }
+        scheduler.wait();
+    }
+    state.SetItemsProcessed(numEvaluations);
+    const auto timings{scheduler.getTaskTimings()};
+    long totalTime{0};
+    for (const auto &timing : timings)
+        totalTime += timing.duration;
+    state.counters["tasks"] =
+        benchmark::Counter(static_cast<double>(timings.size()), benchmark::Counter::kAvgIterations);
+    state.counters["task_time_us"] = static_cast<double>(totalTime) / static_cast<double>(timings.size()) / 1e3;
+    size_t numStolenTasks{0};
+    for (const auto &statistics : scheduler.getWorkerStatistics())
+        numStolenTasks += statistics.numStolenTasks;
+    state.counters["stolen"] =
+        benchmark::Counter(static_cast<double>(numStolenTasks), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_PredicateTaskScheduler)
+    ->DenseRange(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime();
+
+// evaluates a predicate for a flat list of entries (time step and obstacle pair) as done by the vectorized Python API;
+// the scaling curve is obtained by comparing the real time for different numbers of threads
+static void BM_PredicateVectorizedEvaluation(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const auto &predicate{predicates.at("in_front_of_predicate")};
+    // values cached by obstacles are computed before the measurement
+    const auto obstaclePairs{createObstaclePairs(world, predicate, {"0.0"})};
+    std::vector<size_t> timeSteps;
+    std::vector<ObstaclePair> entries;
+    for (size_t timeStep{0}; timeStep <= maxTimeStep; ++timeStep)
+        for (const auto &pair : obstaclePairs) {
+            timeSteps.push_back(timeStep);
+            entries.push_back(pair);
+        }
+    const auto numThreads{static_cast<size_t>(state.range(0))};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            predicate->vectorizedBooleanEvaluation(timeSteps, world, entries, {"0.0"}, false, numThreads));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * entries.size()));
+}
+BENCHMARK(BM_PredicateVectorizedEvaluation)
+    ->DenseRange(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime();
+
+// repeated vectorized evaluation of few entries, e.g., one call per planning cycle; dominated by the per-call overhead
+static void BM_PredicateVectorizedEvaluationSmall(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    static const auto world{createWorld()};
+    const auto &predicate{predicates.at("in_front_of_predicate")};
+    const auto obstaclePairs{createObstaclePairs(world, predicate, {"0.0"})};
+    const auto numEntries{static_cast<std::ptrdiff_t>(std::min<size_t>(16, obstaclePairs.size()))};
+    const std::vector<ObstaclePair> entries(obstaclePairs.begin(), obstaclePairs.begin() + numEntries);
+    const std::vector<size_t> timeSteps(entries.size(), 0);
+    const auto numThreads{static_cast<size_t>(state.range(0))};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            predicate->vectorizedBooleanEvaluation(timeSteps, world, entries, {"0.0"}, false, numThreads));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * entries.size()));
+}
+BENCHMARK(BM_PredicateVectorizedEvaluationSmall)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
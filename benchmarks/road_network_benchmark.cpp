@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lane.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lane_operations.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+// largest road network of the test scenarios
+std::shared_ptr<RoadNetwork> loadRoadNetwork() {
+    return InputUtils::getDataFromCommonRoad(BenchmarkUtils::getScenarioDirectory() + "/ZAM_CARLA-10/ZAM_CARLA-10.pb")
+        .roadNetwork;
+}
+
+} // namespace
+
+static void BM_RoadNetworkFindLaneletById(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork()};
+    std::vector<size_t> laneletIds;
+    for (const auto &let : roadNetwork->getLaneletNetwork())
+        laneletIds.push_back(let->getId());
+    for (auto _ : state) {
+        for (const auto &laneletId : laneletIds)
+            benchmark::DoNotOptimize(roadNetwork->findLaneletById(laneletId));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * laneletIds.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLaneletById);
+
+static void BM_RoadNetworkFindLaneletByIdLinear(benchmark::State &state) {
+    // reference for the lookup by ID: linear search as previously used by the road network
+    auto roadNetwork{loadRoadNetwork()};
+    const auto &lanelets{roadNetwork->getLaneletNetwork()};
+    for (auto _ : state) {
+        for (const auto &let : lanelets) {
+            const auto laneletId{let->getId()};
+            benchmark::DoNotOptimize(*std::find_if(lanelets.begin(), lanelets.end(), [laneletId](const auto &val) {
+                return val->getId() == laneletId;
+            }));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lanelets.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLaneletByIdLinear);
+
+static void BM_RoadNetworkFindOccupiedLaneletsByShape(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork()};
+    // one query at the center of each lanelet
+    std::vector<multi_polygon_type> shapes;
+    for (const auto &let : roadNetwork->getLaneletNetwork()) {
+        const auto &center{let->getCenterVertices().at(let->getCenterVertices().size() / 2)};
+        polygon_type polygon;
+        polygon.outer().push_back(point_type{center.x - 2.0, center.y - 1.0});
+        polygon.outer().push_back(point_type{center.x - 2.0, center.y + 1.0});
+        polygon.outer().push_back(point_type{center.x + 2.0, center.y + 1.0});
+        polygon.outer().push_back(point_type{center.x + 2.0, center.y - 1.0});
+        polygon.outer().push_back(point_type{center.x - 2.0, center.y - 1.0});
+        shapes.push_back({polygon});
+    }
+    for (auto _ : state) {
+        for (const auto &shape : shapes)
+            benchmark::DoNotOptimize(roadNetwork->findOccupiedLaneletsByShape(shape));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shapes.size()));
+}
+BENCHMARK(BM_RoadNetworkFindOccupiedLaneletsByShape);
+
+namespace {
+
+// one point on the center line of each lanelet
+std::vector<vertex> createQueryPositions(const std::shared_ptr<RoadNetwork> &roadNetwork) {
+    std::vector<vertex> positions;
+    for (const auto &let : roadNetwork->getLaneletNetwork())
+        positions.push_back(let->getCenterVertices().at(let->getCenterVertices().size() / 2));
+    return positions;
+}
+
+} // namespace
+
+static void BM_RoadNetworkFindLaneletsByPosition(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork()};
+    const auto positions{createQueryPositions(roadNetwork)};
+    for (auto _ : state) {
+        for (const auto &pos : positions)
+            benchmark::DoNotOptimize(roadNetwork->findLaneletsByPosition(pos.x, pos.y));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLaneletsByPosition);
+
+static void BM_RoadNetworkFindLaneletsByPositionShape(benchmark::State &state) {
+    // reference for the point query: single point polygon evaluated via the general shape intersection
+    auto roadNetwork{loadRoadNetwork()};
+    const auto positions{createQueryPositions(roadNetwork)};
+    for (auto _ : state) {
+        for (const auto &pos : positions) {
+            polygon_type polygon;
+            polygon.outer().push_back(point_type{pos.x, pos.y});
+            benchmark::DoNotOptimize(roadNetwork->findOccupiedLaneletsByShape({polygon}));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLaneletsByPositionShape);
+
+static void BM_RoadNetworkFindLaneletsByPositions(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetwork()};
+    const auto positions{createQueryPositions(roadNetwork)};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(roadNetwork->findLaneletsByPositions(positions));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLaneletsByPositions);
+
+namespace {
+
+// road network with lanes created for all lanelets
+std::shared_ptr<RoadNetwork> loadRoadNetworkWithLanes() {
+    auto roadNetwork{loadRoadNetwork()};
+    roadNetwork->setIdCounterRef(std::make_shared<size_t>(0));
+    lane_operations::createLanesForAllLanelets(roadNetwork->getLaneletNetwork(), roadNetwork, 150, 100, 1, {}, 0);
+    return roadNetwork;
+}
+
+} // namespace
+
+static void BM_RoadNetworkFindLanesByContainedLanelet(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetworkWithLanes()};
+    const auto &lanelets{roadNetwork->getLaneletNetwork()};
+    for (auto _ : state) {
+        for (const auto &let : lanelets)
+            benchmark::DoNotOptimize(roadNetwork->findLanesByContainedLanelet(let->getId()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lanelets.size()));
+    state.counters["lanes"] = static_cast<double>(roadNetwork->getLanes().size());
+}
+BENCHMARK(BM_RoadNetworkFindLanesByContainedLanelet);
+
+static void BM_RoadNetworkFindLanesByContainedLaneletLinear(benchmark::State &state) {
+    // reference for the inverted lane index: scan over all lanes as previously used by the road network
+    auto roadNetwork{loadRoadNetworkWithLanes()};
+    const auto &lanelets{roadNetwork->getLaneletNetwork()};
+    const auto lanes{roadNetwork->getLanes()};
+    for (auto _ : state) {
+        for (const auto &let : lanelets) {
+            std::vector<std::shared_ptr<Lane>> relevantLanes;
+            for (const auto &lane : lanes)
+                if (lane->containsLanelet(let->getId()))
+                    relevantLanes.push_back(lane);
+            benchmark::DoNotOptimize(relevantLanes);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lanelets.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLanesByContainedLaneletLinear);
+
+static void BM_RoadNetworkFindLanesByBaseLanelet(benchmark::State &state) {
+    auto roadNetwork{loadRoadNetworkWithLanes()};
+    const auto &lanelets{roadNetwork->getLaneletNetwork()};
+    for (auto _ : state) {
+        for (const auto &let : lanelets)
+            benchmark::DoNotOptimize(roadNetwork->findLanesByBaseLanelet(let->getId()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lanelets.size()));
+}
+BENCHMARK(BM_RoadNetworkFindLanesByBaseLanelet);
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <exception>
+#include <filesystem>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/interfaces/commonroad/protobuf_reader.h"
+#include "commonroad_cpp/interfaces/commonroad/xml_reader.h"
+#include "commonroad_cpp/roadNetwork/intersection/intersection.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+#include "commonroad_cpp/roadNetwork/road_network_snapshot.h"
+#include "commonroad_cpp/world.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+// collects all scenario files with the given extension within the test scenario directory; for protobuf, only the
+// files containing dynamic obstacles are considered since the corresponding map and scenario files are loaded with them
+std::vector<std::string> findScenarioFiles(const std::string &extension) {
+    std::vector<std::string> paths;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(BenchmarkUtils::getScenarioDirectory())) {
+        const auto fileName{entry.path().filename().string()};
+        if (entry.path().extension() != extension or
+            (extension == ".pb" and (fileName.find("_T-") == std::string::npos or
+                                     fileName.find("-SC") != std::string::npos)))
+            continue;
+        paths.push_back(entry.path().string());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+// reads a scenario by parsing the file once per scenario element, as done before the single-pass loader existed
+Scenario readXMLFileSeparately(const std::string &path) {
+    auto trafficSigns{XMLReader::createTrafficSignFromXML(path)};
+    auto trafficLights{XMLReader::createTrafficLightFromXML(path)};
+    auto lanelets{XMLReader::createLaneletFromXML(path, trafficSigns, trafficLights)};
+    auto obstacles{XMLReader::createObstacleFromXML(path)};
+    auto intersections{XMLReader::createIntersectionFromXML(path, lanelets)};
+    auto roadNetwork{std::make_shared<RoadNetwork>(
+        RoadNetwork(lanelets, XMLReader::extractCountryFromXML(path), trafficSigns, trafficLights, intersections))};
+    for (const auto &inter : roadNetwork->getIntersections())
+        inter->computeMemberLanelets(roadNetwork);
+    return Scenario{obstacles, roadNetwork, XMLReader::extractTimeStepSize(path),
+                    XMLReader::createPlanningProblemFromXML(path)};
+}
+
+// path of the map file belonging to a protobuf scenario file; the map is stored in the directory of the scenario and
+// named like it
+std::string getMapFile(const std::string &scenarioFile) {
+    const std::filesystem::path directory{std::filesystem::path{scenarioFile}.parent_path()};
+    return (directory / (directory.filename().string() + ".pb")).string();
+}
+
+// path of the snapshot file belonging to a protobuf scenario file
+std::string getSnapshotFile(const std::string &scenarioFile) {
+    return (std::filesystem::temp_directory_path() /
+            (std::filesystem::path{getMapFile(scenarioFile)}.stem().string() + ".snapshot"))
+        .string();
+}
+
+// path through which a scenario is ingested
+enum class IngestionPath { xml, protobufHeap, protobufArena };
+
+// collects the scenarios which are available in both formats; the protobuf files of a scenario are stored in the
+// directory named after its map
+std::vector<std::pair<std::string, ProtobufReader::ScenarioFiles>> findXMLAndProtobufScenarios() {
+    std::vector<std::pair<std::string, ProtobufReader::ScenarioFiles>> scenarios;
+    for (const auto &xmlFile : findScenarioFiles(".xml")) {
+        const auto name{std::filesystem::path{xmlFile}.stem().string()};
+        const auto mapName{name.substr(0, name.find('_', name.find('_') + 1))};
+        const auto directory{std::filesystem::path{BenchmarkUtils::getScenarioDirectory()} / mapName};
+        ProtobufReader::ScenarioFiles files{(directory / (mapName + ".pb")).string(),
+                                            (directory / (name + ".pb")).string(),
+                                            (directory / (name + "-SC.pb")).string()};
+        if (!std::filesystem::exists(files.mapFile) or !std::filesystem::exists(files.dynamicFile))
+            continue;
+        if (!std::filesystem::exists(files.scenarioFile))
+            files.scenarioFile.clear();
+        scenarios.emplace_back(xmlFile, files);
+    }
+    return scenarios;
+}
+
+// reads a protobuf scenario with messages allocated on the heap, as done before arena parsing existed
+Scenario readProtobufFilesOnHeap(const ProtobufReader::ScenarioFiles &files) {
+    const auto scenarioMsg{files.scenarioFile.empty()
+                               ? commonroad_scenario::CommonRoadScenario{}
+                               : ProtobufReader::loadScenarioProtobufMessage(files.scenarioFile)};
+    return ProtobufReader::createCommonRoadFromMessage(ProtobufReader::loadDynamicProtobufMessage(files.dynamicFile),
+                                                       ProtobufReader::loadMapProtobufMessage(files.mapFile),
+                                                       scenarioMsg, files.scenarioFile.empty() ? 3 : 7);
+}
+
+} // namespace
+
+// loads all XML scenarios sequentially; compares parsing each file once per scenario element with parsing it once
+static void BM_LoadXMLScenarios(benchmark::State &state, bool singleParse) {
+    spdlog::set_level(spdlog::level::off);
+    const auto paths{findScenarioFiles(".xml")};
+    try {
+        for (auto _ : state)
+            for (const auto &path : paths)
+                benchmark::DoNotOptimize(singleParse ? XMLReader::createScenarioFromXML(path)
+                                                     : readXMLFileSeparately(path));
+    } catch (const std::exception &exception) {
+        state.SkipWithError(exception.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paths.size()));
+    state.counters["files"] = static_cast<double>(paths.size());
+}
+BENCHMARK_CAPTURE(BM_LoadXMLScenarios, separate_parsing, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadXMLScenarios, single_parse, true)->Unit(benchmark::kMillisecond);
+
+// loads all scenarios of a format with the bulk loading API for different numbers of threads
+static void BM_LoadScenarioFiles(benchmark::State &state, const std::string &extension) {
+    spdlog::set_level(spdlog::level::off);
+    const auto paths{findScenarioFiles(extension)};
+    try {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(
+                InputUtils::getDataFromCommonRoadFiles(paths, static_cast<size_t>(state.range(0))));
+    } catch (const std::exception &exception) {
+        state.SkipWithError(exception.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paths.size()));
+    state.counters["files"] = static_cast<double>(paths.size());
+}
+BENCHMARK_CAPTURE(BM_LoadScenarioFiles, xml, std::string{".xml"})
+    ->DenseRange(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadScenarioFiles, protobuf, std::string{".pb"})
+    ->DenseRange(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// loads the scenarios available in both formats sequentially; compares XML parsing with protobuf parsing into heap
+// allocated messages and into an arena
+static void BM_IngestScenarios(benchmark::State &state, IngestionPath ingestionPath) {
+    spdlog::set_level(spdlog::level::off);
+    const auto scenarios{findXMLAndProtobufScenarios()};
+    try {
+        for (auto _ : state)
+            for (const auto &[xmlFile, files] : scenarios)
+                switch (ingestionPath) {
+                case IngestionPath::xml:
+                    benchmark::DoNotOptimize(XMLReader::createScenarioFromXML(xmlFile));
+                    break;
+                case IngestionPath::protobufHeap:
+                    benchmark::DoNotOptimize(readProtobufFilesOnHeap(files));
+                    break;
+                case IngestionPath::protobufArena:
+                    benchmark::DoNotOptimize(ProtobufReader::createCommonRoadFromFiles(files));
+                    break;
+                }
+    } catch (const std::exception &exception) {
+        state.SkipWithError(exception.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scenarios.size()));
+    state.counters["scenarios"] = static_cast<double>(scenarios.size());
+}
+BENCHMARK_CAPTURE(BM_IngestScenarios, xml, IngestionPath::xml)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IngestScenarios, protobuf_heap, IngestionPath::protobufHeap)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IngestScenarios, protobuf_arena, IngestionPath::protobufArena)->Unit(benchmark::kMillisecond);
+
+// loads all protobuf scenarios from an explicit file list for different numbers of threads
+static void BM_LoadProtobufFileList(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    std::vector<ProtobufReader::ScenarioFiles> files;
+    for (const auto &scenario : findXMLAndProtobufScenarios())
+        files.push_back(scenario.second);
+    try {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(InputUtils::getDataFromProtobufFiles(files, static_cast<size_t>(state.range(0))));
+    } catch (const std::exception &exception) {
+        state.SkipWithError(exception.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * files.size()));
+    state.counters["scenarios"] = static_cast<double>(files.size());
+}
+BENCHMARK(BM_LoadProtobufFileList)
+    ->DenseRange(1, static_cast<int64_t>(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// loads all protobuf scenarios and creates their worlds, which includes creating all lanes and curvilinear coordinate
+// systems; the warm start restores the lanes from road network snapshots written before the measurement
+static void BM_WorldStartup(benchmark::State &state, bool warm) {
+    spdlog::set_level(spdlog::level::off);
+    auto paths{findScenarioFiles(".pb")};
+    paths.erase(std::remove_if(paths.begin(), paths.end(),
+                               [](const std::string &path) { return !std::filesystem::exists(getMapFile(path)); }),
+                paths.end());
+    size_t numLanes{0};
+    try {
+        if (warm)
+            for (const auto &path : paths) {
+                auto scenario{InputUtils::getDataFromCommonRoad(path)};
+                World world{path, 0, scenario.roadNetwork, {}, scenario.obstacles, scenario.timeStepSize};
+                RoadNetworkSnapshot::write(getSnapshotFile(path), scenario.roadNetwork,
+                                           RoadNetworkSnapshot::computeChecksum(getMapFile(path)));
+            }
+        for (auto _ : state) {
+            numLanes = 0;
+            for (const auto &path : paths) {
+                auto scenario{InputUtils::getDataFromCommonRoad(path)};
+                if (warm and
+                    !RoadNetworkSnapshot::restoreIfValid(getSnapshotFile(path), scenario.roadNetwork,
+                                                         RoadNetworkSnapshot::computeChecksum(getMapFile(path))))
+                    throw std::runtime_error("Snapshot of " + path + " cannot be restored.");
+                World world{path, 0, scenario.roadNetwork, {}, scenario.obstacles, scenario.timeStepSize};
+                numLanes += scenario.roadNetwork->getLanes().size();
+            }
+        }
+    } catch (const std::exception &exception) {
+        state.SkipWithError(exception.what());
+        return;
+    }
+    if (warm)
+        for (const auto &path : paths)
+            std::filesystem::remove(getSnapshotFile(path));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paths.size()));
+    state.counters["scenarios"] = static_cast<double>(paths.size());
+    state.counters["lanes"] = static_cast<double>(numLanes);
+}
+BENCHMARK_CAPTURE(BM_WorldStartup, cold, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_WorldStartup, warm, true)->Unit(benchmark::kMillisecond);
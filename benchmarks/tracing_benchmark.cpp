@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <vector>
+
+#include "commonroad_cpp/auxiliaryDefs/tracing.h"
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+#include "commonroad_cpp/world.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+// spans recorded per thread before the recorded spans are reset, so that the buffer does not grow without bound
+constexpr size_t spansPerReset{1 << 16};
+
+// span variants compared by BM_TraceSpan
+enum class SpanMode { none = 0, disabled = 1, enabled = 2 };
+
+} // namespace
+
+// cost of a single span: a scope without span, a span while recording is disabled, and a recorded span
+static void BM_TraceSpan(benchmark::State &state) {
+    const auto mode{static_cast<SpanMode>(state.range(0))};
+    if (mode == SpanMode::enabled)
+        TraceRecorder::enable();
+    size_t numSpans{0};
+    for (auto _ : state) {
+        if (mode == SpanMode::none) {
+            benchmark::ClobberMemory();
+            continue;
+        }
+        {
+            const TraceSpan span{"BM_TraceSpan", "benchmark"};
+            benchmark::ClobberMemory();
+        }
+        if (++numSpans == spansPerReset) {
+            state.PauseTiming();
+            TraceRecorder::reset();
+            numSpans = 0;
+            state.ResumeTiming();
+        }
+    }
+    TraceRecorder::disable();
+    TraceRecorder::reset();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceSpan)->DenseRange(0, 2)->ArgName("mode");
+
+// creation of a world including its lanes with and without recording; measures the overhead of the spans placed in
+// the library, which are only present if it is compiled with ENV_MODEL_TRACING
+static void BM_TraceWorldCreation(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    const bool recording{state.range(0) == 1};
+    const std::string path{BenchmarkUtils::getScenarioDirectory() + "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb"};
+    if (recording)
+        TraceRecorder::enable();
+    size_t numSpans{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto scenario{InputUtils::getDataFromCommonRoad(path)};
+        scenario.roadNetwork->setIdCounterRef(std::make_shared<size_t>(1000000));
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(World("DEU_Guetersloh-25_4_T-1", 0, scenario.roadNetwork,
+                                       std::vector<std::shared_ptr<Obstacle>>{}, scenario.obstacles,
+                                       scenario.timeStepSize));
+        state.PauseTiming();
+        numSpans += TraceRecorder::getEvents().size();
+        TraceRecorder::reset();
+        state.ResumeTiming();
+    }
+    TraceRecorder::disable();
+    state.counters["spans"] = benchmark::Counter(static_cast<double>(numSpans), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TraceWorldCreation)->DenseRange(0, 1)->ArgName("recording")->Unit(benchmark::kMillisecond);
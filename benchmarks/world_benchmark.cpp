@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include "commonroad_cpp/interfaces/commonroad/input_utils.h"
+#include "commonroad_cpp/obstacle/obstacle.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
+#include "commonroad_cpp/world.h"
+
+#include "benchmark_utils.h"
+
+namespace {
+
+World createWorld(const size_t numObstacles) {
+    auto roadNetwork{std::make_shared<RoadNetwork>(std::vector<std::shared_ptr<Lanelet>>{})};
+    return World("benchmark", 0, roadNetwork, {}, BenchmarkUtils::createObstacles(numObstacles, 0), 0.1);
+}
+
+} // namespace
+
+static void BM_WorldFindObstacle(benchmark::State &state) {
+    auto numObstacles{static_cast<size_t>(state.range(0))};
+    auto world{createWorld(numObstacles)};
+    for (auto _ : state) {
+        for (size_t obsId{1}; obsId <= numObstacles; ++obsId)
+            benchmark::DoNotOptimize(world.findObstacle(obsId));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numObstacles));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldFindObstacle)->RangeMultiplier(2)->Range(16, 1024)->Complexity();
+
+static void BM_WorldUpdateObstacles(benchmark::State &state) {
+    auto numObstacles{static_cast<size_t>(state.range(0))};
+    auto world{createWorld(numObstacles)};
+    size_t timeStep{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        // half of the obstacles are updated, the other half is new
+        auto updatedObstacles{BenchmarkUtils::createObstacles(numObstacles, ++timeStep, 1 + numObstacles / 2)};
+        state.ResumeTiming();
+        world.updateObstacles(updatedObstacles);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numObstacles));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldUpdateObstacles)->RangeMultiplier(2)->Range(16, 1024)->Complexity();
+
+static void BM_WorldUpdateObstaclesTraj(benchmark::State &state) {
+    auto numObstacles{static_cast<size_t>(state.range(0))};
+    auto world{createWorld(numObstacles)};
+    size_t timeStep{0};
+    for (auto _ : state) {
+        state.PauseTiming();
+        ++timeStep;
+        std::map<size_t, std::shared_ptr<State>> currentStates;
+        std::map<size_t, tsl::robin_map<time_step_t, std::shared_ptr<State>>> trajectoryPredictions;
+        for (const auto &obs : world.getObstacles()) {
+            currentStates[obs->getId()] = std::make_shared<State>(timeStep, 0.0, 0.0, 10.0, 0.0, 0.0);
+            trajectoryPredictions[obs->getId()] = {};
+        }
+        state.ResumeTiming();
+        world.updateObstaclesTraj({}, currentStates, trajectoryPredictions);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numObstacles));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldUpdateObstaclesTraj)->RangeMultiplier(2)->Range(16, 1024)->Complexity();
+
+static void BM_WorldConstruction(benchmark::State &state) {
+    auto numThreads{static_cast<size_t>(state.range(0))};
+    std::string scenario{"DEU_Guetersloh-25_4_T-1"};
+    std::string path{BenchmarkUtils::getScenarioDirectory() + "/DEU_Guetersloh-25/" + scenario + ".pb"};
+    for (auto _ : state) {
+        state.PauseTiming();
+        // lanes are stored in the road network, so each world requires a freshly loaded road network
+        const auto &[obstacles, roadNetwork, timeStepSize, planningProblems] = InputUtils::getDataFromCommonRoad(path);
+        state.ResumeTiming();
+        World world{scenario,
+                    0,
+                    roadNetwork,
+                    {},
+                    obstacles,
+                    timeStepSize,
+                    WorldParameters(RoadNetworkParameters(), SensorParameters::dynamicDefaults(),
+                                    ActuatorParameters::egoDefaults(), TimeParameters::dynamicDefaults(),
+                                    ActuatorParameters::vehicleDefaults(), numThreads)};
+        benchmark::DoNotOptimize(world);
+    }
+}
+BENCHMARK(BM_WorldConstruction)->Arg(1)->Arg(2)->Arg(4)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,22 @@
+include(FetchContent)
+
+# Only build the benchmark library itself
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+if(ENV_MODEL_SYSTEM_PACKAGES_FORCE)
+    find_package(benchmark 1.6.0 REQUIRED)
+else()
+    FetchContent_Declare(
+        benchmark
+
+        GIT_REPOSITORY  https://github.com/google/benchmark.git
+        GIT_TAG         v1.8.3
+
+        SYSTEM
+        FIND_PACKAGE_ARGS 1.6.0
+    )
+
+    FetchContent_MakeAvailable(benchmark)
+endif()
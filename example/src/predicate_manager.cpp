@@ -6,14 +6,15 @@
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/predicates/commonroad_predicate.h>
 #include <commonroad_cpp/world.h>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
-#include <omp.h>
-#include <random>
+#include <map>
 #include <spdlog/spdlog.h>
+#include <tuple>
 #include <utility>
 
-std::string PredicateManager::extractBenchmarkIdFromPath(std::string path) {
+std::string PredicateManager::extractBenchmarkIdFromPath(const std::string &path) {
     std::vector<std::string> pathSplit;
     boost::split(pathSplit, path, boost::is_any_of("/"));
     std::string fileName{pathSplit.back()};
@@ -24,158 +25,168 @@ std::string PredicateManager::extractBenchmarkIdFromPath(std::string path) {
 
 void PredicateManager::extractPredicateSatisfaction() {
     spdlog::info("Start evaluation.");
-    auto rng = std::default_random_engine{};
-    // evaluate scenarios
-    omp_set_num_threads(numThreads);
-#pragma omp parallel for schedule(guided) shared(predicates, rng) firstprivate(scenarios, relevantPredicates)
-    for (const auto &scen : scenarios) {
-        std::string benchmarkId{extractBenchmarkIdFromPath(scen)};
-        const auto &[obstacles, roadNetwork, timeStepSize, planningProblems] = InputUtils::getDataFromCommonRoad(scen);
-        // evaluate all obstacles
-        for (const auto &ego : obstacles) {
-            if (ego->isStatic())
-                continue;
-            size_t minTimeStep{ego->getFirstTimeStep()};
-            size_t maxTimeStep{ego->getFinalTimeStep()};
-            std::vector<std::shared_ptr<Obstacle>> others;
-            others.reserve(obstacles.size() - 1);
-            for (const auto &obs : obstacles) {
-                if (obs->getId() == ego->getId() or
-                    (obs->getFinalTimeStep() < minTimeStep and maxTimeStep < obs->getFirstTimeStep()))
-                    continue;
-                others.push_back(obs);
-            }
-            // setObstacleProperties(ego, others); // todo
-            const auto egoVehicles{std::vector<std::shared_ptr<Obstacle>>{ego}};
-            const auto world{std::make_shared<World>(benchmarkId, 0, roadNetwork, egoVehicles, others, timeStepSize)};
-            auto timer{std::make_shared<Timer>()};
-            auto stat{std::make_shared<PredicateStatistics>()};
-            for (size_t timeStep = ego->getCurrentState()->getTimeStep(); timeStep <= ego->getFinalTimeStep();
-                 ++timeStep) {
-                std::shuffle(std::begin(relevantPredicates), std::end(relevantPredicates), rng);
-                for (const auto &predName : relevantPredicates) {
-                    auto &pred{predicates[predName]};
-                    //                    const std::shared_ptr<OptionalPredicateParameters> opt{
-                    //                        std::make_shared<OptionalPredicateParameters>(
-                    //                            std::vector<TrafficSignTypes>{TrafficSignTypes::MIN_SPEED},
-                    //                            std::vector<LaneletType>{LaneletType::accessRamp},
-                    //                            std::vector<TurningDirection>{TurningDirection::all},
-                    //                            std::vector<TrafficLightState>{
-                    //                                TrafficLightState::red})}; // TODO generalize for arbitrary types
-                    try {
-                        if (!pred->isVehicleDependent())
-                            pred->statisticBooleanEvaluation(timeStep, world, ego, timer, stat, nullptr, {});
-                        else
-                            for (const auto &obs : world->getObstacles())
-                                if (obs->timeStepExists(timeStep))
-                                    pred->statisticBooleanEvaluation(timeStep, world, ego, timer, stat, obs, {});
-                    } catch (const std::runtime_error &re) {
-                        spdlog::error(std::string("PredicateManager::extractPredicateSatisfaction | Scenario: ")
-                                          .append(scen)
-                                          .append(" | ego vehicle: ")
-                                          .append(std::to_string(ego->getId()))
-                                          .append(" | predicate: ")
-                                          .append(predName)
-                                          .append(" | time step:")
-                                          .append(std::to_string(timeStep))
-                                          .append(" | Runtime Error: ")
-                                          .append(re.what()));
-                    } catch (const std::logic_error &le) {
-                        spdlog::error(std::string("PredicateManager::extractPredicateSatisfaction | Scenario: ")
-                                          .append(scen)
-                                          .append(" | ego vehicle: ")
-                                          .append(std::to_string(ego->getId()))
-                                          .append(" | predicate: ")
-                                          .append(predName)
-                                          .append(" | time step:")
-                                          .append(std::to_string(timeStep))
-                                          .append(" | Logic Error: ")
-                                          .append(le.what()));
-                    } catch (const std::exception &ex) {
-                        spdlog::error(std::string("PredicateManager::extractPredicateSatisfaction | Scenario: ")
-                                          .append(scen)
-                                          .append(" | ego vehicle: ")
-                                          .append(std::to_string(ego->getId()))
-                                          .append(" | predicate: ")
-                                          .append(predName)
-                                          .append(" | time step:")
-                                          .append(std::to_string(timeStep))
-                                          .append(" | General Error: ")
-                                          .append(ex.what()));
-                    } catch (...) {
-                        spdlog::error(std::string("PredicateManager::extractPredicateSatisfaction | Scenario: ")
-                                          .append(scen)
-                                          .append(" | ego vehicle: ")
-                                          .append(std::to_string(ego->getId()))
-                                          .append(" | predicate: ")
-                                          .append(predName)
-                                          .append(" | time step:")
-                                          .append(std::to_string(timeStep)));
-                        continue;
-                    }
-                }
-            }
+    TaskScheduler scheduler{static_cast<size_t>(numThreads)};
+    for (const auto &scen : scenarios)
+        scheduler.submit([this, &scheduler, scen]() { evaluateScenario(scheduler, scen); }, "scenario setup | " + scen);
+    scheduler.wait();
+    logTaskTimings(scheduler);
+    spdlog::info("Evaluation finished.");
+    writeFile();
+}
+
+void PredicateManager::evaluateScenario(TaskScheduler &scheduler, const std::string &scen) {
+    const auto scenario{std::make_shared<const Scenario>(InputUtils::getDataFromCommonRoad(scen))};
+    const std::string benchmarkId{extractBenchmarkIdFromPath(scen)};
+    // all worlds share the road network and obstacles of the scenario and modify them during construction;
+    // therefore, the worlds are created one after another before any predicate is evaluated
+    std::vector<std::pair<std::shared_ptr<Obstacle>, std::shared_ptr<World>>> egoWorlds;
+    for (const auto &ego : scenario->obstacles) {
+        if (ego->isStatic())
+            continue;
+        egoWorlds.emplace_back(ego, createWorld(benchmarkId, *scenario, ego));
+    }
+    for (const auto &[ego, world] : egoWorlds)
+        submitPredicateTasks(scheduler, scen, world, ego);
+}
+
+std::shared_ptr<World> PredicateManager::createWorld(const std::string &benchmarkId, const Scenario &scenario,
+                                                     const std::shared_ptr<Obstacle> &ego) {
+    size_t minTimeStep{ego->getFirstTimeStep()};
+    size_t maxTimeStep{ego->getFinalTimeStep()};
+    std::vector<std::shared_ptr<Obstacle>> others;
+    others.reserve(scenario.obstacles.size() - 1);
+    for (const auto &obs : scenario.obstacles) {
+        if (obs->getId() == ego->getId() or
+            (obs->getFinalTimeStep() < minTimeStep and maxTimeStep < obs->getFirstTimeStep()))
+            continue;
+        others.push_back(obs);
+    }
+    // setObstacleProperties(ego, others); // todo
+    const auto egoVehicles{std::vector<std::shared_ptr<Obstacle>>{ego}};
+    return std::make_shared<World>(benchmarkId, 0, scenario.roadNetwork, egoVehicles, others, scenario.timeStepSize);
+}
+
+void PredicateManager::submitPredicateTasks(TaskScheduler &scheduler, const std::string &scen,
+                                            const std::shared_ptr<World> &world,
+                                            const std::shared_ptr<Obstacle> &ego) {
+    std::string benchmarkId{extractBenchmarkIdFromPath(scen)};
+    size_t maxTimeStep{ego->getFinalTimeStep()};
+    // tasks of one ego vehicle share the world and thereby the caches of the road network and obstacles
+    for (const auto &predName : relevantPredicates)
+        for (size_t firstTimeStep{ego->getCurrentState()->getTimeStep()}; firstTimeStep <= maxTimeStep;
+             firstTimeStep += timeStepsPerTask) {
+            const size_t lastTimeStep{std::min(firstTimeStep + timeStepsPerTask - 1, maxTimeStep)};
+            scheduler.submit(
+                [this, scen, world, ego, predName, firstTimeStep, lastTimeStep]() {
+                    evaluatePredicate(scen, world, ego, predName, firstTimeStep, lastTimeStep);
+                },
+                std::string(predName)
+                    .append(" | ")
+                    .append(benchmarkId)
+                    .append(" | ego vehicle: ")
+                    .append(std::to_string(ego->getId()))
+                    .append(" | time steps: ")
+                    .append(std::to_string(firstTimeStep))
+                    .append("-")
+                    .append(std::to_string(lastTimeStep)));
         }
+}
+
+void PredicateManager::evaluatePredicate(const std::string &scen, const std::shared_ptr<World> &world,
+                                         const std::shared_ptr<Obstacle> &ego, const std::string &predName,
+                                         size_t firstTimeStep, size_t lastTimeStep) {
+    const auto predicate{predicates.find(predName)};
+    if (predicate == predicates.end()) {
+        spdlog::error("PredicateManager::evaluatePredicate | Unknown predicate: " + predName);
+        return;
     }
-    spdlog::info("Evaluation finished.");
-    //   writeFile();
+    const auto &pred{predicate->second};
+    auto timer{std::make_shared<Timer>()};
+    // statistics of the current thread, so that concurrent tasks do not contend
+    const auto &stat{statisticsCollector.getThreadStatistics(predName, extractBenchmarkIdFromPath(scen))};
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep) {
+        //                    const std::shared_ptr<OptionalPredicateParameters> opt{
+        //                        std::make_shared<OptionalPredicateParameters>(
+        //                            std::vector<TrafficSignTypes>{TrafficSignTypes::MIN_SPEED},
+        //                            std::vector<LaneletType>{LaneletType::accessRamp},
+        //                            std::vector<TurningDirection>{TurningDirection::all},
+        //                            std::vector<TrafficLightState>{
+        //                                TrafficLightState::red})}; // TODO generalize for arbitrary types
+        try {
+            if (!pred->isVehicleDependent())
+                pred->statisticBooleanEvaluation(timeStep, world, ego, timer, stat, nullptr, {});
+            else
+                for (const auto &obs : world->getObstacles())
+                    if (obs->timeStepExists(timeStep))
+                        pred->statisticBooleanEvaluation(timeStep, world, ego, timer, stat, obs, {});
+        } catch (const std::runtime_error &re) {
+            logEvaluationError(scen, ego->getId(), predName, timeStep, std::string(" | Runtime Error: ") + re.what());
+        } catch (const std::logic_error &le) {
+            logEvaluationError(scen, ego->getId(), predName, timeStep, std::string(" | Logic Error: ") + le.what());
+        } catch (const std::exception &ex) {
+            logEvaluationError(scen, ego->getId(), predName, timeStep, std::string(" | General Error: ") + ex.what());
+        } catch (...) {
+            logEvaluationError(scen, ego->getId(), predName, timeStep, "");
+        }
+    }
+}
+
+void PredicateManager::logEvaluationError(const std::string &scen, size_t egoId, const std::string &predName,
+                                          size_t timeStep, const std::string &error) {
+    spdlog::error(std::string("PredicateManager::extractPredicateSatisfaction | Scenario: ")
+                      .append(scen)
+                      .append(" | ego vehicle: ")
+                      .append(std::to_string(egoId))
+                      .append(" | predicate: ")
+                      .append(predName)
+                      .append(" | time step:")
+                      .append(std::to_string(timeStep))
+                      .append(error));
 }
 
-// void PredicateManager::writeFile() {
-//    std::ofstream file;
-//    double globalMinExecutionTime{std::numeric_limits<double>::max()};
-//    double globalMaxExecutionTime{std::numeric_limits<double>::lowest()};
-//    double globalMinAvgExecutionTime{std::numeric_limits<double>::max()};
-//    double globalMaxAvgExecutionTime{std::numeric_limits<double>::lowest()};
-//    if (std::filesystem::exists(simulationParameters.outputDirectory)) {
-//        file.open(simulationParameters.outputDirectory + "/" + simulationParameters.outputFileName);
-//        spdlog::info("Write evaluation results to " + simulationParameters.outputDirectory +
-//                     simulationParameters.outputFileName);
-//    } else {
-//        file.open(std::filesystem::current_path() / simulationParameters.outputFileName);
-//        spdlog::info(std::string("Write evaluation results to ")
-//                         .append(std::filesystem::current_path())
-//                         .append("/")
-//                         .append(simulationParameters.outputFileName));
-//    }
-//    file << "Predicate Name,Num. Satisfactions,Num. Executions,Satisfaction in %,Max. Comp. Time,"
-//            "Min. Comp. Time,Avg. Comp. Time,Weight Max. Comp. Time,Weight Avg. Comp. Time \n";
-//    std::map<std::string, std::tuple<size_t, size_t, double, double, double, double>> predicateStatistics;
-//    for (const auto &predName : relevantPredicates) {
-//        auto& pred{predicates[predName]};
-//        auto minExecutionTime{static_cast<double>(pred->getStatistics().minComputationTime) / 1e6};
-//        auto maxExecutionTime{static_cast<double>(pred->getStatistics().maxComputationTime) / 1e6};
-//        auto avgExecutionTime{(static_cast<double>(pred->getStatistics().totalComputationTime) / 1e6) /
-//                              static_cast<double>(pred->getStatistics().numExecutions)};
-//        if (minExecutionTime < globalMinExecutionTime)
-//            globalMinExecutionTime = minExecutionTime;
-//        if (maxExecutionTime > globalMaxExecutionTime)
-//            globalMaxExecutionTime = maxExecutionTime;
-//        if (avgExecutionTime < globalMinAvgExecutionTime)
-//            globalMinAvgExecutionTime = avgExecutionTime;
-//        if (avgExecutionTime > globalMaxAvgExecutionTime)
-//            globalMaxAvgExecutionTime = avgExecutionTime;
-//        predicateStatistics.insert({predName,
-//                                    {pred->getStatistics().numSatisfaction, pred->getStatistics().numExecutions,
-//                                     static_cast<double>(pred->getStatistics().numSatisfaction) /
-//                                         static_cast<double>(pred->getStatistics().numExecutions),
-//                                     maxExecutionTime, minExecutionTime, avgExecutionTime}});
-//    }
-//    for (const auto &[predName, pred] : predicateStatistics) {
-//        file << predName << "," << std::get<0>(pred) << "," << std::get<1>(pred) << "," << std::get<2>(pred) << ","
-//             << std::get<3>(pred) << " [ms]," << std::get<4>(pred) << " [ms]," << std::get<5>(pred) << " [ms],"
-//             << (std::get<3>(pred) - globalMinExecutionTime) / (globalMaxExecutionTime - globalMinExecutionTime) <<
-//             ","
-//             << (std::get<5>(pred) - globalMinAvgExecutionTime) /
-//                    (globalMaxAvgExecutionTime - globalMinAvgExecutionTime)
-//             << "\n";
-//    }
-//    file << "Global Max. Comp. Time:," << std::to_string(globalMaxExecutionTime) << '\n';
-//    file << "Global Min. Comp. Time:," << std::to_string(globalMinExecutionTime) << '\n';
-//    file << "Global Max. Avg Comp. Time:," << std::to_string(globalMaxAvgExecutionTime) << '\n';
-//    file << "Global Min. Avg Comp. Time:," << std::to_string(globalMinAvgExecutionTime) << '\n';
-//    file.close();
-//}
+void PredicateManager::logTaskTimings(const TaskScheduler &scheduler) {
+    // tasks are labeled with their kind, i.e., scenario setup (parsing and world construction) or the predicate name,
+    // followed by the scenario, ego vehicle, and time steps
+    std::map<std::string, std::tuple<size_t, long, long>> predicateTimings;
+    for (const auto &timing : scheduler.getTaskTimings()) {
+        auto &[numTasks, totalTime, maxTime]{predicateTimings[timing.label.substr(0, timing.label.find(" | "))]};
+        numTasks++;
+        totalTime += timing.duration;
+        maxTime = std::max(maxTime, timing.duration);
+    }
+    for (const auto &[label, timing] : predicateTimings)
+        spdlog::info("Tasks " + label + ": " + std::to_string(std::get<0>(timing)) + " tasks, total " +
+                     std::to_string(static_cast<double>(std::get<1>(timing)) / 1e6) + " ms, max " +
+                     std::to_string(static_cast<double>(std::get<2>(timing)) / 1e6) + " ms");
+    const auto workerStatistics{scheduler.getWorkerStatistics()};
+    for (size_t worker{0}; worker < workerStatistics.size(); ++worker)
+        spdlog::info("Worker " + std::to_string(worker) + ": " +
+                     std::to_string(workerStatistics[worker].numExecutedTasks) + " tasks (" +
+                     std::to_string(workerStatistics[worker].numStolenTasks) + " stolen), busy " +
+                     std::to_string(static_cast<double>(workerStatistics[worker].busyTime) / 1e6) + " ms");
+}
+
+void PredicateManager::writeFile() const {
+    std::filesystem::path csvPath{std::filesystem::exists(simulationParameters.outputDirectory)
+                                      ? std::filesystem::path(simulationParameters.outputDirectory)
+                                      : std::filesystem::current_path()};
+    csvPath /= simulationParameters.outputFileName;
+    csvPath.replace_extension(".csv");
+    auto jsonPath{csvPath};
+    jsonPath.replace_extension(".json");
+    spdlog::info("Write evaluation results to " + csvPath.string() + " and " + jsonPath.string());
+    std::ofstream csvFile{csvPath};
+    statisticsCollector.writeCsv(csvFile);
+    std::ofstream jsonFile{jsonPath};
+    statisticsCollector.writeJson(jsonFile);
+    for (const auto &[predName, stat] : statisticsCollector.getPredicateStatistics())
+        spdlog::info("Predicate " + predName + ": " + std::to_string(stat.numExecutions) + " executions, p50 " +
+                     std::to_string(static_cast<double>(stat.computationTimeHistogram.getQuantile(0.5)) / 1e6) +
+                     " ms, p99 " +
+                     std::to_string(static_cast<double>(stat.computationTimeHistogram.getQuantile(0.99)) / 1e6) +
+                     " ms, max " + std::to_string(static_cast<double>(stat.computationTimeHistogram.getMax()) / 1e6) +
+                     " ms");
+}
 
 PredicateManager::PredicateManager(int threads, const std::string &configPath)
     : numThreads(threads), simulationParameters(InputUtils::initializeSimulationParameters(configPath)) {
@@ -213,7 +224,4 @@ void PredicateManager::extractRelevantPredicates(const std::string &configPath)
             relevantPredicates.push_back(pred);
     }
 }
-void PredicateManager::reset() {
-    //   for (const auto &predName : relevantPredicates)
-    //       predicates[predName]->resetStatistics();
-}
+void PredicateManager::reset() { statisticsCollector.reset(); }
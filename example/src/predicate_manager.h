@@ -1,7 +1,10 @@
 #pragma once
 
+#include <commonroad_cpp/auxiliaryDefs/task_scheduler.h>
 #include <commonroad_cpp/predicates/commonroad_predicate.h>
 #include <commonroad_cpp/predicates/predicate_parameter_collection.h>
+#include <commonroad_cpp/predicates/predicate_statistics_collector.h>
+#include <commonroad_cpp/scenario.h>
 #include <memory>
 #include <vector>
 
@@ -39,15 +42,82 @@ class PredicateManager {
     void reset();
 
   private:
-    std::vector<std::string> scenarios;          //**< set of scenario which should be evaluated */
-    int numThreads;                              //**< number of threads which should be used for evaluation */
-    SimulationParameters simulationParameters;   //**< struct containing simulation-related parameters */
-    std::vector<std::string> relevantPredicates; //**< subset of relevant predicates which need to be evaluated */
+    std::vector<std::string> scenarios;               //**< set of scenario which should be evaluated */
+    int numThreads;                                   //**< number of threads which should be used for evaluation */
+    SimulationParameters simulationParameters;        //**< struct containing simulation-related parameters */
+    std::vector<std::string> relevantPredicates;      //**< subset of relevant predicates which need to be evaluated */
+    size_t timeStepsPerTask{10};                      //**< number of time steps evaluated by one task */
+    PredicateStatisticsCollector statisticsCollector; //**< statistics per predicate and scenario of all threads */
 
     /**
-     * Writes evaluation result to file.
+     * Reads a scenario, creates the worlds of all dynamic obstacles acting as ego vehicle, and submits their
+     * predicate evaluation tasks. The worlds are created sequentially since their construction modifies the road
+     * network and obstacles shared by all worlds of the scenario.
+     *
+     * @param scheduler Scheduler executing the tasks.
+     * @param scen Path to scenario.
+     */
+    void evaluateScenario(TaskScheduler &scheduler, const std::string &scen);
+
+    /**
+     * Creates the world for an ego vehicle.
+     *
+     * @param benchmarkId Benchmark ID of the scenario.
+     * @param scenario Scenario read from file.
+     * @param ego Obstacle acting as ego vehicle.
+     * @return World containing the ego vehicle and all other obstacles of the scenario.
+     */
+    static std::shared_ptr<World> createWorld(const std::string &benchmarkId, const Scenario &scenario,
+                                              const std::shared_ptr<Obstacle> &ego);
+
+    /**
+     * Submits one task per relevant predicate and chunk of time steps of an ego vehicle.
+     *
+     * @param scheduler Scheduler executing the tasks.
+     * @param scen Path to scenario.
+     * @param world World of the ego vehicle.
+     * @param ego Obstacle acting as ego vehicle.
+     */
+    void submitPredicateTasks(TaskScheduler &scheduler, const std::string &scen, const std::shared_ptr<World> &world,
+                              const std::shared_ptr<Obstacle> &ego);
+
+    /**
+     * Evaluates a predicate for an ego vehicle over a range of time steps.
+     *
+     * @param scen Path to scenario.
+     * @param world World object.
+     * @param ego Obstacle acting as ego vehicle.
+     * @param predName Name of predicate.
+     * @param firstTimeStep First time step to evaluate.
+     * @param lastTimeStep Last time step to evaluate.
+     */
+    void evaluatePredicate(const std::string &scen, const std::shared_ptr<World> &world,
+                           const std::shared_ptr<Obstacle> &ego, const std::string &predName, size_t firstTimeStep,
+                           size_t lastTimeStep);
+
+    /**
+     * Logs an error which occurred during predicate evaluation.
+     *
+     * @param scen Path to scenario.
+     * @param egoId ID of ego vehicle.
+     * @param predName Name of predicate.
+     * @param timeStep Time step of interest.
+     * @param error Description of error.
+     */
+    static void logEvaluationError(const std::string &scen, size_t egoId, const std::string &predName,
+                                   size_t timeStep, const std::string &error);
+
+    /**
+     * Logs the computation time of the executed tasks per task kind and the utilization of each worker.
+     *
+     * @param scheduler Scheduler which executed the tasks.
+     */
+    static void logTaskTimings(const TaskScheduler &scheduler);
+
+    /**
+     * Writes the statistics per predicate and scenario as CSV and JSON file to the output directory.
      */
-    void writeFile();
+    void writeFile() const;
 
     /**
      * Collects names of relevant predicates.
@@ -66,5 +136,5 @@ class PredicateManager {
      * @param path File path.
      * @return Benchmark/Scenario ID.
      */
-    std::string extractBenchmarkIdFromPath(std::string path);
+    static std::string extractBenchmarkIdFromPath(const std::string &path);
 };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Histogram of computation times with logarithmically sized buckets. Each power of two is split into a fixed number of
+ * linear sub-buckets so that quantiles are reported with a bounded relative error of 1/numSubBuckets while the
+ * memory consumption only grows with the logarithm of the largest recorded value.
+ */
+class LatencyHistogram {
+  public:
+    static constexpr size_t subBucketBits{3};                  //**< number of bits used for the linear sub-buckets */
+    static constexpr size_t numSubBuckets{1 << subBucketBits}; //**< number of sub-buckets per power of two */
+
+    /**
+     * Adds a computation time to the histogram.
+     *
+     * @param nanoseconds Computation time [ns]. Negative values are recorded as zero.
+     */
+    void record(long nanoseconds);
+
+    /**
+     * Adds all values of another histogram to this histogram.
+     *
+     * @param other Histogram to merge.
+     */
+    void merge(const LatencyHistogram &other);
+
+    /**
+     * Computes an upper bound of a quantile of the recorded values. The bound exceeds the exact quantile by at most
+     * 1/numSubBuckets relative to the exact value and never exceeds the maximum.
+     *
+     * @param quantile Quantile of interest, e.g., 0.95. Must be within [0, 1].
+     * @return Upper bound of quantile [ns]; zero if no value was recorded.
+     */
+    [[nodiscard]] long getQuantile(double quantile) const;
+
+    /**
+     * Getter for number of recorded values.
+     *
+     * @return Number of recorded values.
+     */
+    [[nodiscard]] size_t getCount() const;
+
+    /**
+     * Getter for largest recorded value.
+     *
+     * @return Largest recorded value [ns]; zero if no value was recorded.
+     */
+    [[nodiscard]] long getMax() const;
+
+    /**
+     * Removes all recorded values.
+     */
+    void reset();
+
+  private:
+    /**
+     * Computes the bucket of a value.
+     *
+     * @param value Non-negative value.
+     * @return Index of bucket.
+     */
+    static size_t bucketIndex(unsigned long value);
+
+    /**
+     * Computes the largest value of a bucket.
+     *
+     * @param index Index of bucket.
+     * @return Largest value which is assigned to the bucket.
+     */
+    static unsigned long bucketUpperBound(size_t index);
+
+    std::vector<size_t> buckets; //**< number of values per bucket; only grows up to the bucket of the maximum */
+    size_t count{0};             //**< number of recorded values */
+    long max{0};                 //**< largest recorded value [ns] */
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "latency_histogram.h"
 #include "string"
 #include "types_and_definitions.h"
 #include "vector"
@@ -68,12 +69,27 @@ struct PredicateStatistics {
     size_t totalComputationTime{0};      // ns
     size_t numExecutions{0};
     size_t numSatisfaction{0};
+    LatencyHistogram computationTimeHistogram; // ns
 
     void reset() {
         computationTime.clear();
         totalComputationTime = 0;
         numExecutions = 0;
         numSatisfaction = 0;
+        computationTimeHistogram.reset();
+    }
+
+    /**
+     * Adds the aggregated values of other statistics. The per-execution computation times are not merged since
+     * they grow with every execution; merged statistics rely on the computation time histogram instead.
+     *
+     * @param other Statistics which should be added.
+     */
+    void merge(const PredicateStatistics &other) {
+        totalComputationTime += other.totalComputationTime;
+        numExecutions += other.numExecutions;
+        numSatisfaction += other.numSatisfaction;
+        computationTimeHistogram.merge(other.computationTimeHistogram);
     }
 };
 
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "timer.h"
+
+/**
+ * Scheduler executing tasks on a fixed number of worker threads with work stealing. Each worker owns a queue of tasks
+ * and executes the most recently added task of its queue first. Idle workers steal the oldest task of another worker.
+ * Tasks can submit further tasks, so that work can be split recursively, e.g., by scenario, ego vehicle, predicate, and
+ * time steps.
+ */
+class TaskScheduler {
+  public:
+    using Task = std::function<void()>;
+
+    /**
+     * Computation time of an executed task.
+     */
+    struct TaskTiming {
+        std::string label; //**< label provided when submitting the task */
+        size_t worker;     //**< index of worker which executed the task */
+        long duration;     //**< computation time [ns] */
+    };
+
+    /**
+     * Statistics of a worker thread.
+     */
+    struct WorkerStatistics {
+        size_t numExecutedTasks{0}; //**< number of executed tasks */
+        size_t numStolenTasks{0};   //**< number of executed tasks which were stolen from other workers */
+        long busyTime{0};           //**< accumulated computation time of executed tasks [ns] */
+    };
+
+    /**
+     * Constructor starting the worker threads.
+     *
+     * @param numThreads Number of worker threads.
+     * @param recordTimings Boolean indicating whether the computation time of each task is stored. Long-lived
+     * schedulers executing many tasks should disable it since the timings are never released.
+     */
+    explicit TaskScheduler(size_t numThreads, bool recordTimings = true);
+
+    /**
+     * Destructor which waits until all submitted tasks are executed and stops the worker threads.
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /**
+     * Submits a task. Tasks submitted by a worker of this scheduler are added to the queue of the worker, other tasks
+     * are distributed round-robin.
+     *
+     * @param task Task to execute.
+     * @param label Label used for reporting the computation time of the task.
+     */
+    void submit(Task task, std::string label = {});
+
+    /**
+     * Blocks until all submitted tasks and the tasks submitted by them are executed. Must not be called by a task.
+     * Rethrows the first exception thrown by a task since the last call.
+     */
+    void wait();
+
+    /**
+     * Getter for number of worker threads.
+     *
+     * @return Number of worker threads.
+     */
+    [[nodiscard]] size_t getNumThreads() const;
+
+    /**
+     * Getter for computation times of all tasks executed so far. Must only be called while no tasks are pending.
+     *
+     * @return Computation times ordered by worker and execution. Empty if timings are not recorded.
+     */
+    [[nodiscard]] std::vector<TaskTiming> getTaskTimings() const;
+
+    /**
+     * Getter for statistics of worker threads. Must only be called while no tasks are pending.
+     *
+     * @return Statistics of each worker.
+     */
+    [[nodiscard]] std::vector<WorkerStatistics> getWorkerStatistics() const;
+
+  private:
+    /**
+     * Task together with its label.
+     */
+    struct Entry {
+        Task task;         //**< task to execute */
+        std::string label; //**< label of task */
+    };
+
+    /**
+     * Queue and statistics owned by a worker thread.
+     */
+    struct Worker {
+        std::mutex mutex;                //**< mutex protecting the queue */
+        std::deque<Entry> queue;         //**< tasks to execute */
+        std::vector<TaskTiming> timings; //**< computation times of executed tasks */
+        WorkerStatistics statistics;     //**< statistics of executed tasks */
+        Timer timer;                     //**< timer accumulating computation time of executed tasks */
+        std::thread thread;              //**< worker thread */
+    };
+
+    /**
+     * Executes tasks until the scheduler is stopped.
+     *
+     * @param index Index of worker.
+     */
+    void run(size_t index);
+
+    /**
+     * Removes the most recently added task from the queue of a worker.
+     *
+     * @param index Index of worker.
+     * @param entry Removed task. Only set if a task was available.
+     * @return Boolean indicating whether a task was removed.
+     */
+    bool pop(size_t index, Entry &entry);
+
+    /**
+     * Removes the oldest task from the queue of another worker.
+     *
+     * @param index Index of the stealing worker.
+     * @param entry Removed task. Only set if a task was available.
+     * @return Boolean indicating whether a task was removed.
+     */
+    bool steal(size_t index, Entry &entry);
+
+    /**
+     * Executes a task and records its computation time.
+     *
+     * @param index Index of executing worker.
+     * @param entry Task to execute.
+     */
+    void execute(size_t index, Entry &entry);
+
+    std::vector<std::unique_ptr<Worker>> workers; //**< workers with their queues */
+    const bool recordTimings;                     //**< flag indicating whether computation times of tasks are stored */
+    std::atomic_size_t nextWorker{0};             //**< worker receiving the next task submitted by other threads */
+    std::atomic_size_t numQueuedTasks{0};         //**< number of tasks in all queues */
+    std::atomic_size_t numPendingTasks{0};        //**< number of submitted tasks which are not finished */
+    bool stopped{false};                          //**< flag indicating whether workers should terminate */
+    std::mutex idleMutex;                         //**< mutex for idle workers and threads waiting for tasks */
+    std::condition_variable workAvailable;        //**< notifies idle workers about new tasks or termination */
+    std::condition_variable tasksFinished;        //**< notifies waiting threads when all tasks are finished */
+    std::exception_ptr exception;                 //**< first exception thrown by a task */
+};
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "timer.h"
+
+/**
+ * Trace span recorded by the trace recorder.
+ */
+struct TraceEvent {
+    const char *name;     //**< name of span */
+    const char *category; //**< category of span, e.g., world or predicate */
+    long start;           //**< start time relative to the start of the program [ns] */
+    long duration;        //**< duration [ns] */
+    size_t thread;        //**< index of recording thread */
+};
+
+/**
+ * Collects trace spans of all threads and exports them in the Chrome trace event format, which can be opened with
+ * Perfetto or chrome://tracing. Recording is disabled by default. Each thread records into its own buffer so that
+ * concurrent spans do not contend. Spans are only placed in the library if it is compiled with ENV_MODEL_TRACING.
+ */
+class TraceRecorder {
+  public:
+    /**
+     * Enables recording of spans.
+     */
+    static void enable();
+
+    /**
+     * Disables recording of spans. Spans which are already open are still recorded.
+     */
+    static void disable();
+
+    /**
+     * Returns whether spans are recorded.
+     *
+     * @return Boolean indicating whether recording is enabled.
+     */
+    [[nodiscard]] static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Records a completed span for the calling thread.
+     *
+     * @param name Name of span. Must stay valid until the recorded spans are reset, e.g., a string literal or an
+     * interned name.
+     * @param category Category of span. Same lifetime requirements as the name.
+     * @param startTime Start time of span.
+     * @param duration Duration of span [ns].
+     */
+    static void record(const char *name, const char *category,
+                       std::chrono::high_resolution_clock::time_point startTime, long duration);
+
+    /**
+     * Stores a copy of a name which stays valid until the end of the program, e.g., for names computed at runtime.
+     *
+     * @param name Name to store.
+     * @return Pointer to stored name. Equal names yield the same pointer.
+     */
+    static const char *internName(std::string_view name);
+
+    /**
+     * Getter for the recorded spans of all threads. Must only be called while no thread records spans.
+     *
+     * @return Recorded spans ordered by start time.
+     */
+    [[nodiscard]] static std::vector<TraceEvent> getEvents();
+
+    /**
+     * Writes the recorded spans as Chrome trace JSON with one complete event per span. Must only be called while no
+     * thread records spans.
+     *
+     * @param stream Output stream.
+     */
+    static void writeChromeTrace(std::ostream &stream);
+
+    /**
+     * Writes the recorded spans as Chrome trace JSON to a file. Must only be called while no thread records spans.
+     *
+     * @param filePath Path of output file.
+     */
+    static void writeChromeTrace(const std::string &filePath);
+
+    /**
+     * Removes the recorded spans of all threads. Must only be called while no thread records spans.
+     */
+    static void reset();
+
+  private:
+    inline static std::atomic_bool enabled{false}; //**< flag indicating whether spans are recorded */
+};
+
+/**
+ * Scoped span which measures the time until it is destroyed using Timer and passes it to the trace recorder. The span
+ * is only measured if recording is enabled when it is created.
+ */
+class TraceSpan {
+  public:
+    /**
+     * Constructor starting the span.
+     *
+     * @param name Name of span. Must fulfill the lifetime requirements of TraceRecorder::record.
+     * @param category Category of span.
+     */
+    TraceSpan(const char *name, const char *category)
+        : name(name), category(category), active(TraceRecorder::isEnabled()) {
+        if (active)
+            startTime = Timer::start();
+    }
+
+    /**
+     * Destructor recording the span.
+     */
+    ~TraceSpan() {
+        if (active) {
+            Timer timer;
+            TraceRecorder::record(name, category, startTime, timer.stop(startTime));
+        }
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+  private:
+    const char *name;                                           //**< name of span */
+    const char *category;                                       //**< category of span */
+    const bool active;                                          //**< flag indicating whether span is recorded */
+    std::chrono::high_resolution_clock::time_point startTime{}; //**< start time of span */
+};
+
+#define ENV_MODEL_TRACE_CONCAT_IMPL(a, b) a##b
+#define ENV_MODEL_TRACE_CONCAT(a, b) ENV_MODEL_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * Opens a span which ends at the end of the enclosing scope. Without ENV_MODEL_TRACING, the macro expands to nothing
+ * and its arguments are not evaluated.
+ */
+#ifdef ENV_MODEL_TRACING
+#define ENV_MODEL_TRACE_SPAN(name, category) const TraceSpan ENV_MODEL_TRACE_CONCAT(traceSpan, __LINE__)(name, category)
+#else
+#define ENV_MODEL_TRACE_SPAN(name, category) static_cast<void>(0)
+#endif
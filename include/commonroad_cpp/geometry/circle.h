@@ -66,6 +66,13 @@ class Circle : public Shape {
      */
     ShapeType getType() override;
 
+    /**
+     * Creates copy of circle.
+     *
+     * @return Copy of circle.
+     */
+    [[nodiscard]] std::unique_ptr<Shape> clone() const override;
+
     /**
      * Getter for center circle. Function can only be used for circles.
      *
@@ -5,6 +5,10 @@
 #include "commonroad_cpp/auxiliaryDefs/structs.h"
 #include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
 
+namespace geometry {
+class CurvilinearCoordinateSystem;
+}
+
 namespace geometric_operations {
 
 /**
@@ -160,4 +164,16 @@ bool is90Deg(double degree1, double degree2);
  */
 bool is180Deg(double degree1, double degree2);
 
+/**
+ * Converts points to a curvilinear coordinate system with a single batch projection. Instead of searching all segments
+ * of the reference path for each point separately, the candidate segments of all points are determined together.
+ *
+ * @param ccs Curvilinear coordinate system.
+ * @param points Points in Cartesian coordinates, e.g., the corners of an occupancy.
+ * @return Points in curvilinear coordinates with the longitudinal coordinate as x and the lateral coordinate as y.
+ * @throws std::invalid_argument if a point is outside of the projection domain.
+ */
+std::vector<vertex> convertPointsToCurvilinear(const geometry::CurvilinearCoordinateSystem &ccs,
+                                               const std::vector<vertex> &points);
+
 } // namespace geometric_operations
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
+#include "commonroad_cpp/geometry/types.h"
+
+/**
+ * Class representing an oriented bounding box, i.e., a rectangle with arbitrary orientation. Intersections with other
+ * boxes and convex polygons are evaluated with the separating axis theorem, which is considerably faster than general
+ * polygon intersection.
+ */
+class OrientedBoundingBox {
+  public:
+    /**
+     * Default constructor creating a box at the origin without extent.
+     */
+    OrientedBoundingBox() = default;
+
+    /**
+     * Constructor initializing the box with its corners.
+     *
+     * @param corners Corners of rectangle in consecutive order.
+     */
+    explicit OrientedBoundingBox(const std::array<vertex, 4> &corners);
+
+    /**
+     * Creates box from a rectangular polygon, e.g., the occupancy polygon of an obstacle with rectangle shape.
+     *
+     * @param polygon Polygon whose first four vertices are the corners of a rectangle in consecutive order.
+     * @return Oriented bounding box.
+     */
+    static OrientedBoundingBox fromRectangle(const polygon_type &polygon);
+
+    /**
+     * Getter for corners.
+     *
+     * @return Corners in consecutive order.
+     */
+    [[nodiscard]] const std::array<vertex, 4> &getCorners() const;
+
+    /**
+     * Getter for center.
+     *
+     * @return Center of box.
+     */
+    [[nodiscard]] vertex getCenter() const;
+
+    /**
+     * Getter for axis-aligned bounding box.
+     *
+     * @return Axis-aligned bounding box enclosing the box.
+     */
+    [[nodiscard]] box getAxisAlignedBoundingBox() const;
+
+    /**
+     * Checks whether two boxes intersect. Touching boxes intersect.
+     *
+     * @param other Other box.
+     * @return Boolean indicating whether boxes intersect.
+     */
+    [[nodiscard]] bool intersects(const OrientedBoundingBox &other) const;
+
+    /**
+     * Computes the largest gap between the projections of the box and a convex polygon onto the separating axes, i.e.,
+     * the edge normals of both. The shapes intersect iff the gap is not positive. A positive gap is a lower bound of
+     * the distance between the shapes.
+     *
+     * @param polygon Vertices of convex polygon in consecutive order without repetition of the first vertex.
+     * @return Largest gap [m].
+     */
+    [[nodiscard]] double separation(const std::vector<vertex> &polygon) const;
+
+  private:
+    /**
+     * Computes the interval covered by the projection of the corners onto an axis.
+     *
+     * @param axis Axis.
+     * @return Minimum and maximum projection.
+     */
+    [[nodiscard]] std::array<double, 2> project(const vertex &axis) const;
+
+    std::array<vertex, 4> corners{};                      //**< corners in consecutive order */
+    std::array<vertex, 2> axes{{{1.0, 0.0}, {0.0, 1.0}}}; //**< unit directions of the edges */
+    std::array<std::array<double, 2>, 2> extents{};       //**< projection interval of the corners onto each axis */
+};
@@ -45,6 +45,13 @@ class Polygon : public Shape {
      */
     ShapeType getType() override;
 
+    /**
+     * Creates copy of polygon.
+     *
+     * @return Copy of polygon.
+     */
+    [[nodiscard]] std::unique_ptr<Shape> clone() const override;
+
     /**
      * Print function. Prints vertices on console output.
      */
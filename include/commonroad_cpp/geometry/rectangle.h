@@ -58,6 +58,13 @@ class Rectangle : public Shape {
      */
     ShapeType getType() override;
 
+    /**
+     * Creates copy of rectangle.
+     *
+     * @return Copy of rectangle.
+     */
+    [[nodiscard]] std::unique_ptr<Shape> clone() const override;
+
     /**
      * Function for scaling a rectangle.
      *
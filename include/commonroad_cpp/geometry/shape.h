@@ -2,6 +2,8 @@
 
 #include "commonroad_cpp/auxiliaryDefs/structs.h"
 
+#include <memory>
+
 /**
  * Class representing a shape.
  */
@@ -80,6 +82,13 @@ class Shape {
      */
     [[nodiscard]] virtual ShapeType getType() = 0;
 
+    /**
+     * Virtual function for copying a shape.
+     *
+     * @return Copy of shape.
+     */
+    [[nodiscard]] virtual std::unique_ptr<Shape> clone() const = 0;
+
     /**
      * Virtual function for scaling a shape.
      *
@@ -41,6 +41,13 @@ class ShapeGroup : public Shape {
      */
     ShapeType getType() override;
 
+    /**
+     * Creates copy of shape group.
+     *
+     * @return Copy of shape group.
+     */
+    [[nodiscard]] std::unique_ptr<Shape> clone() const override;
+
     /**
      * Print function. Prints each individual group element on console output.
      */
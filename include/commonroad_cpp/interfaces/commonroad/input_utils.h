@@ -1,3 +1,5 @@
+#pragma once
+
 #include <string>
 #include <tuple>
 #include <vector>
@@ -8,6 +10,10 @@
 
 class RoadNetwork;
 
+namespace ProtobufReader {
+struct ScenarioFiles;
+} // namespace ProtobufReader
+
 // using Scenario = std::tuple<std::vector<std::shared_ptr<Obstacle>>, std::shared_ptr<RoadNetwork>, double>;
 
 namespace InputUtils {
@@ -20,6 +26,26 @@ namespace InputUtils {
  */
 Scenario getDataFromCommonRoad(const std::string &path);
 
+/**
+ * Loads and sets up multiple CR scenarios concurrently. Each file is parsed only once.
+ *
+ * @param paths Paths to CommonRoad files/directories.
+ * @param numThreads Number of threads used for loading.
+ * @return Scenarios in the order of the provided paths.
+ */
+std::vector<Scenario> getDataFromCommonRoadFiles(const std::vector<std::string> &paths, size_t numThreads = 1);
+
+/**
+ * Loads and sets up multiple CR scenarios in protobuf format from explicitly given files concurrently. In contrast to
+ * getDataFromCommonRoad, no directories are scanned for the files belonging to a scenario.
+ *
+ * @param files Paths of the protobuf files of each scenario.
+ * @param numThreads Number of threads used for loading.
+ * @return Scenarios in the order of the provided files.
+ */
+std::vector<Scenario> getDataFromProtobufFiles(const std::vector<ProtobufReader::ScenarioFiles> &files,
+                                               size_t numThreads = 1);
+
 PlanningProblem getPlanningProblemFromCommonRoad(const std::string &path);
 
 } // namespace InputUtils
@@ -17,6 +17,7 @@
 #include <commonroad_cpp/interfaces/commonroad/protobufFormat/generated/commonroad_scenario.pb.h>
 #include <commonroad_cpp/interfaces/commonroad/protobufFormat/generated/environment_obstacle.pb.h>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message_lite.h>
 
 class Obstacle;
@@ -37,12 +38,23 @@ using FloatExactOrInterval = std::variant<double, FloatInterval>;
 
 using LaneletContainer = std::unordered_map<size_t, std::shared_ptr<Lanelet>>;
 using BoundaryContainer = std::unordered_map<size_t, std::shared_ptr<Bound>>;
+using BoundaryMessageContainer = std::unordered_map<size_t, const commonroad_map::Bound *>;
+using StopLineMessageContainer = std::unordered_map<size_t, const commonroad_map::StopLine *>;
 using TrafficSignContainer = std::unordered_map<size_t, std::shared_ptr<TrafficSign>>;
 using TrafficLightContainer = std::unordered_map<size_t, std::shared_ptr<TrafficLight>>;
 using IncomingGroupContainer = std::unordered_map<size_t, std::shared_ptr<IncomingGroup>>;
 using OutgoingGroupContainer = std::unordered_map<size_t, std::shared_ptr<OutgoingGroup>>;
 using CrossingGroupContainer = std::unordered_map<size_t, std::shared_ptr<CrossingGroup>>;
 
+/**
+ * Paths of the protobuf files of a CommonRoad scenario. Files which are not given are left empty.
+ */
+struct ScenarioFiles {
+    std::string mapFile;      //**< path to map file */
+    std::string dynamicFile;  //**< path to dynamic file */
+    std::string scenarioFile; //**< path to scenario file with planning problems */
+};
+
 /**
  * Loads a CommonRoadDynamic message from protobuf file.
  *
@@ -67,6 +79,35 @@ commonroad_map::CommonRoadMap loadMapProtobufMessage(const std::string &filePath
  */
 commonroad_scenario::CommonRoadScenario loadScenarioProtobufMessage(const std::string &filePath);
 
+/**
+ * Loads a CommonRoadDynamic message from protobuf file into an arena. The message is owned by the arena.
+ *
+ * @param filePath File path
+ * @param arena Arena allocating the message and all of its fields
+ * @return Message
+ */
+commonroad_dynamic::CommonRoadDynamic *loadDynamicProtobufMessage(const std::string &filePath,
+                                                                  google::protobuf::Arena &arena);
+
+/**
+ * Loads a CommonRoadMap message from protobuf file into an arena. The message is owned by the arena.
+ *
+ * @param filePath File path
+ * @param arena Arena allocating the message and all of its fields
+ * @return Message
+ */
+commonroad_map::CommonRoadMap *loadMapProtobufMessage(const std::string &filePath, google::protobuf::Arena &arena);
+
+/**
+ * Loads a CommonRoadScenario message from protobuf file into an arena. The message is owned by the arena.
+ *
+ * @param filePath File path
+ * @param arena Arena allocating the message and all of its fields
+ * @return Message
+ */
+commonroad_scenario::CommonRoadScenario *loadScenarioProtobufMessage(const std::string &filePath,
+                                                                     google::protobuf::Arena &arena);
+
 /**
  * Initializes container of lanelets.
  *
@@ -120,6 +161,24 @@ void initOutgoingGroupContainer(OutgoingGroupContainer &outgoingGroupContainer,
 void initCrossingGroupContainer(CrossingGroupContainer &crossingGroupContainer,
                                 const commonroad_map::Intersection &intersectionMsg);
 
+/**
+ * Initializes container of boundary messages referenced by lanelets.
+ *
+ * @param boundaryContainer Boundary message container
+ * @param commonRoadMapMsg CommonRoad message
+ */
+void initBoundaryMessageContainer(BoundaryMessageContainer &boundaryContainer,
+                                  const commonroad_map::CommonRoadMap &commonRoadMapMsg);
+
+/**
+ * Initializes container of stop line messages referenced by lanelets.
+ *
+ * @param stopLineContainer Stop line message container
+ * @param commonRoadMapMsg CommonRoad message
+ */
+void initStopLineMessageContainer(StopLineMessageContainer &stopLineContainer,
+                                  const commonroad_map::CommonRoadMap &commonRoadMapMsg);
+
 /**
  * Returns lanelet from container of lanelets.
  *
@@ -162,6 +221,16 @@ Scenario createCommonRoadFromMessage(const commonroad_dynamic::CommonRoadDynamic
                                      const commonroad_scenario::CommonRoadScenario &commonRoadScenarioMsg,
                                      int fileGiven);
 
+/**
+ * Creates CR scenario from protobuf files. The messages are parsed into an arena, which is released at once after the
+ * scenario is created.
+ *
+ * @param files Paths of the map, dynamic, and scenario file. Only the combinations supported by
+ * createCommonRoadFromMessage can be used.
+ * @return Scenario
+ */
+Scenario createCommonRoadFromFiles(const ScenarioFiles &files);
+
 /**
  * Creates scenario information from protobuf message "ScenarioMetaInformation".
  *
@@ -178,15 +247,16 @@ createScenarioMetaInformationFromMessage(const commonroad_common::ScenarioMetaIn
  * @param laneletContainer Lanelet container
  * @param trafficSignContainer Traffic sign container
  * @param trafficLightContainer Traffic light container
- * @param boundaries Vector of boundaries.
+ * @param boundaryContainer Boundary message container
+ * @param stopLineContainer Stop line message container
  * @return Lanelet
  */
 std::shared_ptr<Lanelet> createLaneletFromMessage(const commonroad_map::Lanelet &laneletMsg,
                                                   LaneletContainer &laneletContainer,
                                                   TrafficSignContainer &trafficSignContainer,
                                                   TrafficLightContainer &trafficLightContainer,
-                                                  const std::vector<std::shared_ptr<Bound>> &boundaries,
-                                                  const commonroad_map::CommonRoadMap &commonRoadMapMsg);
+                                                  const BoundaryMessageContainer &boundaryContainer,
+                                                  const StopLineMessageContainer &stopLineContainer);
 
 /**
  * Creates boundary from protobuf message "Bound".
@@ -394,6 +464,15 @@ std::shared_ptr<SignalState> createSignalStateFromMessage(const commonroad_commo
  */
 vertex createPointFromMessage(const commonroad_common::Point &pointMsg);
 
+/**
+ * Creates vertices from repeated protobuf message "Point".
+ *
+ * @param pointsMsg Protobuf messages
+ * @return Vertices
+ */
+std::vector<vertex>
+createVerticesFromMessage(const google::protobuf::RepeatedPtrField<commonroad_common::Point> &pointsMsg);
+
 /**
  * Creates shape from protobuf message "Shape".
  *
@@ -7,6 +7,7 @@
 #include "commonroad_cpp/auxiliaryDefs/structs.h"
 #include "commonroad_cpp/obstacle/signal_state.h"
 #include "commonroad_cpp/planning_problem.h"
+#include "commonroad_cpp/scenario.h"
 
 class Intersection;
 class Obstacle;
@@ -50,6 +51,15 @@ std::vector<std::shared_ptr<Lanelet>>
 createLaneletFromXML(const std::string &xmlFile, std::vector<std::shared_ptr<TrafficSign>> trafficSigns = {},
                      std::vector<std::shared_ptr<TrafficLight>> trafficLights = {});
 
+/**
+ * Function for creating all elements of a scenario. In contrast to calling the functions for the individual elements,
+ * the file is loaded and parsed only once.
+ *
+ * @param xmlFile Path to CommonRoad XML file.
+ * @return Scenario containing obstacles, road network, time step size, and planning problems.
+ */
+Scenario createScenarioFromXML(const std::string &xmlFile);
+
 /*
  * Convenient function for creating a world from XML. Note: EgoVehicle is not initialized.
  * @param xmlFile Loaded CommonRoad XML file.
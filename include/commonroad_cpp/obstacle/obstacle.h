@@ -37,6 +37,8 @@ using state_map_t = time_step_map_t<std::shared_ptr<State>>;
 using occupancy_map_t = time_step_map_t<std::shared_ptr<Occupancy>>;
 //** type of history/trajectory prediction maps for signal states*/
 using signal_state_map_t = time_step_map_t<std::shared_ptr<SignalState>>;
+//** type of thread-safe maps for cached values */
+template <typename Value> using time_step_cache_t = ObstacleCache::time_step_cache_t<Value>;
 
 /**
  * Struct representing set-based prediction.
@@ -415,12 +417,13 @@ class Obstacle {
     [[nodiscard]] state_map_t getTrajectoryHistory() const;
 
     /**
-     * Getter for polygon shape of obstacle at given time step.
+     * Getter for polygon shape of obstacle at given time step. The shape is computed once and cached.
      *
      * @param timeStep Time step of interest.
-     * @return Boost polygon.
+     * @return Reference to cached Boost polygon. The reference stays valid until the time step is removed from the
+     * cache, e.g., by clearing the cache or updating the obstacle.
      */
-    [[nodiscard]] multi_polygon_type getOccupancyPolygonShape(time_step_t timeStep);
+    [[nodiscard]] const multi_polygon_type &getOccupancyPolygonShape(time_step_t timeStep);
 
     /**
      * Getter for obstacle shape.
@@ -840,9 +843,40 @@ class Obstacle {
      * @param timeStep time step of interest
      * @param ccs Reference curvilinear coordinate system (CCS) which should be used.
      * @param setBased Boolean indicating whether set-based prediction should be considered. Default is false.
+     * @return Converted curvilinear position.
      */
-    void convertPointToCurvilinear(size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
-                                   bool setBased = false) const;
+    ObstacleCache::curvilinear_position_t
+    convertPointToCurvilinear(size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                              bool setBased = false) const;
+
+    /**
+     * Converts positions at several time steps to curvilinear coordinate system given a reference CCS using a single
+     * batch projection. Points are stored locally in variable convertedPositions.
+     *
+     * @param timeSteps Time steps of interest.
+     * @param ccs Reference curvilinear coordinate system (CCS) which should be used.
+     * @param setBased Boolean indicating whether set-based prediction should be considered. Default is false.
+     * @return Converted curvilinear positions in the order of the time steps.
+     */
+    std::vector<ObstacleCache::curvilinear_position_t>
+    convertPointsToCurvilinear(const std::vector<size_t> &timeSteps,
+                               const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                               bool setBased = false) const;
+
+    /**
+     * Converts positions of several obstacles at a time step to curvilinear coordinate system given a reference CCS
+     * using a single batch projection, e.g., of all obstacles relevant for an ego vehicle. Points are stored locally
+     * in variable convertedPositions of each obstacle. Obstacles without state at the time step, with position outside
+     * of the projection domain, or with already converted position are skipped.
+     *
+     * @param obstacles Obstacles of interest.
+     * @param timeStep Time step of interest.
+     * @param ccs Reference curvilinear coordinate system (CCS) which should be used.
+     * @param setBased Boolean indicating whether set-based prediction should be considered. Default is false.
+     */
+    static void convertPointsToCurvilinear(const std::vector<std::shared_ptr<Obstacle>> &obstacles, size_t timeStep,
+                                           const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                                           bool setBased = false);
 
     /**
      * Getter for field of view area.
@@ -1045,9 +1079,9 @@ class Obstacle {
      *
      * @param timeStep Time step of interest.
      * @param setBased Boolean indicating whether set-based prediction should be considered. Default is false.
-     * @return Boost polygon.
+     * @return Reference to cached Boost polygon.
      */
-    multi_polygon_type setOccupancyPolygonShape(time_step_t timeStep, bool setBased = false);
+    const multi_polygon_type &setOccupancyPolygonShape(time_step_t timeStep, bool setBased = false);
 
     /**
      * Private setter for reference lane.
@@ -1070,6 +1104,34 @@ class Obstacle {
     std::string ccsErrorMsg(size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                             const std::string &func) const;
 
+    /**
+     * Getter for converted curvilinear position at a given time step. Converts and caches the position if required.
+     *
+     * @param timeStep Time step of interest.
+     * @param ccs Curvilinear coordinate system.
+     * @param setBased Boolean indicating whether set-based prediction should be considered.
+     * @param func Function requesting the position which is used in case of conversion errors.
+     * @return Longitudinal position, lateral position, and orientation within curvilinear coordinate system.
+     */
+    ObstacleCache::curvilinear_position_t
+    getConvertedPosition(size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                         bool setBased, const std::string &func) const;
+
+    /**
+     * Computes the curvilinear orientation for a converted position and stores the position locally in variable
+     * convertedPositions.
+     *
+     * @param timeStep Time step of position.
+     * @param ccs Curvilinear coordinate system.
+     * @param convertedPoint Position in curvilinear coordinates with longitudinal coordinate as x and lateral
+     * coordinate as y.
+     * @param setBased Boolean indicating whether set-based prediction should be considered.
+     * @return Converted curvilinear position.
+     */
+    ObstacleCache::curvilinear_position_t
+    storeConvertedPosition(size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                           const vertex &convertedPoint, bool setBased) const;
+
     /**
      * Extracts first and last time step of obstacle.
      */
@@ -1087,7 +1149,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of lanes per time step.
      */
-    time_step_map_t<std::vector<std::shared_ptr<Lane>>> &getOccupiedLanesCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<std::vector<std::shared_ptr<Lane>>> &getOccupiedLanesCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for lateral distance to other obstacles cache.
@@ -1096,7 +1158,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of distance per time step.
      */
-    time_step_map_t<std::map<size_t, double>> &getLateralDistanceToObjectCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<std::map<size_t, double>> &getLateralDistanceToObjectCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for rear position cache.
@@ -1105,7 +1167,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of position per time step.
      */
-    time_step_map_t<std::vector<double>> &getBackXYCoordinatesCache(time_step_t timeStep, bool setBased) const;
+    time_step_cache_t<std::vector<double>> &getBackXYCoordinatesCache(time_step_t timeStep, bool setBased) const;
 
     /**
      * Getter for front position cache.
@@ -1114,7 +1176,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of position per time step.
      */
-    time_step_map_t<std::vector<double>> &getFrontXYCoordinatesCache(time_step_t timeStep, bool setBased) const;
+    time_step_cache_t<std::vector<double>> &getFrontXYCoordinatesCache(time_step_t timeStep, bool setBased) const;
 
     /**
      * Getter for occupied lanelets not in driving direction cache.
@@ -1123,8 +1185,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    time_step_map_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsNotDrivingDirCache(size_t timeStep,
-                                                                                                  bool setBased) const;
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
+    getOccupiedLaneletsNotDrivingDirCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for occupied lanelets in driving direction cache.
@@ -1133,8 +1195,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    time_step_map_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsDrivingDirCache(size_t timeStep,
-                                                                                               bool setBased) const;
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsDrivingDirCache(size_t timeStep,
+                                                                                                 bool setBased) const;
 
     /**
      * Getter for converted curvilienar state position cache.
@@ -1143,8 +1205,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of converted curvilinear position per time step.
      */
-    time_step_map_t<ObstacleCache::curvilinear_position_map_t> &convertedPositionsCache(size_t timeStep,
-                                                                                        bool setBased) const;
+    time_step_cache_t<ObstacleCache::curvilinear_position_map_t> &convertedPositionsCache(size_t timeStep,
+                                                                                          bool setBased) const;
 
     /**
      * Getter for reference lane cache.
@@ -1153,7 +1215,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of reference lane per time step.
      */
-    time_step_map_t<std::shared_ptr<Lane>> &getReferenceLaneCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<std::shared_ptr<Lane>> &getReferenceLaneCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for rigtht lateral position cache.
@@ -1162,7 +1224,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of right lateral position per time step.
      */
-    time_step_map_t<double> &getRightLatPositionCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<double> &getRightLatPositionCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for left lateral position cache.
@@ -1171,7 +1233,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of left lateral position per time step.
      */
-    time_step_map_t<double> &getLeftLatPositionCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<double> &getLeftLatPositionCache(size_t timeStep, bool setBased) const;
 
     /**
      * Getter for occupied lanelets cache (rear position).
@@ -1180,8 +1242,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
-    getOccupiedLaneletsBackCache(size_t timeStep, bool setBased);
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsBackCache(size_t timeStep,
+                                                                                           bool setBased);
 
     /**
      * Getter for occupied lanelets cache (front position).
@@ -1190,8 +1252,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
-    getOccupiedLaneletsFrontCache(size_t timeStep, bool setBased);
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsFrontCache(size_t timeStep,
+                                                                                            bool setBased);
 
     /**
      * Getter for occupied lanelets cache (state occupancy).
@@ -1200,8 +1262,8 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
-    getOccupiedLaneletsStateCache(size_t timeStep, bool setBased);
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsStateCache(size_t timeStep,
+                                                                                            bool setBased);
 
     /**
      * Getter for occupied lanelets cache (shape occupancy).
@@ -1210,8 +1272,7 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Map of occupied lanelets per time step.
      */
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsCache(size_t timeStep,
-                                                                                                     bool setBased);
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &getOccupiedLaneletsCache(size_t timeStep, bool setBased);
 
     /**
      * Getter for occupancy polygon shape cache.
@@ -1220,5 +1281,6 @@ class Obstacle {
      * @param setBased Boolean indicating whether set-based prediction should be considered.
      * @return Mao of occupancy polygon shape as boost multi-polygon per time step.
      */
-    time_step_map_t<multi_polygon_type> &getOccupancyPolygonShapeCache(size_t timeStep, bool setBased) const;
+    time_step_cache_t<std::shared_ptr<const multi_polygon_type>> &getOccupancyPolygonShapeCache(size_t timeStep,
+                                                                                               bool setBased) const;
 };
@@ -1,7 +1,15 @@
 #pragma once
+#include <array>
 #include <commonroad_cpp/auxiliaryDefs/types_and_definitions.h>
 #include <commonroad_cpp/geometry/types.h>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
 #include <tsl/robin_map.h>
 
 class State;
@@ -12,60 +20,458 @@ namespace geometry {
 class CurvilinearCoordinateSystem;
 }
 
+/**
+ * Storage of cached values based on a hash map.
+ * Suitable for arbitrarily distributed time steps.
+ *
+ * @tparam Value Type of cached values.
+ * @tparam Allocator Allocator of the map entries.
+ */
+template <typename Value, typename Allocator = std::allocator<std::pair<time_step_t, Value>>>
+class HashTimeStepStorage {
+  public:
+    /**
+     * Getter for cached value.
+     *
+     * @param index Index of time step.
+     * @return Pointer to cached value or nullptr if no value is cached.
+     */
+    [[nodiscard]] const Value *find(const time_step_t index) const {
+        auto iter{map.find(index)};
+        return iter != map.end() ? &iter->second : nullptr;
+    }
+
+    /**
+     * Getter for cached value which inserts a default constructed value if no value is cached.
+     *
+     * @param index Index of time step.
+     * @return Reference to cached value.
+     */
+    Value &operator[](const time_step_t index) { return map[index]; }
+
+    /**
+     * Inserts a value if no value is cached yet.
+     *
+     * @param index Index of time step.
+     * @param value Value to insert.
+     * @return Reference to cached value.
+     */
+    const Value &tryEmplace(const time_step_t index, Value value) {
+        return map.try_emplace(index, std::move(value)).first->second;
+    }
+
+    /**
+     * Removes cached value.
+     *
+     * @param index Index of time step.
+     */
+    void erase(const time_step_t index) { map.erase(index); }
+
+    /**
+     * Removes all cached values.
+     */
+    void clear() { map.clear(); }
+
+    /**
+     * Getter for number of cached values.
+     *
+     * @return Number of cached values.
+     */
+    [[nodiscard]] size_t size() const { return map.size(); }
+
+  private:
+    tsl::robin_map<time_step_t, Value, std::hash<time_step_t>, std::equal_to<time_step_t>, Allocator>
+        map; //**< cached values */
+};
+
+/**
+ * Storage of cached values in a contiguous array indexed by the offset to the smallest stored time step.
+ * A validity bitset indicates which entries contain a cached value. Since time steps of obstacles are dense and bounded
+ * by the length of the trajectory, lookups require neither hashing nor pointer chasing. Unused entries at the beginning
+ * of the array are removed as soon as they make up half of the array, e.g., if old time steps are removed from the
+ * history, and the array is released as soon as no value is cached anymore.
+ *
+ * @tparam Value Type of cached values.
+ * @tparam Allocator Allocator of the array of cached values, which is also used for the validity bitset.
+ */
+template <typename Value, typename Allocator = std::allocator<Value>> class DenseTimeStepStorage {
+  public:
+    /**
+     * Getter for cached value.
+     *
+     * @param index Index of time step.
+     * @return Pointer to cached value or nullptr if no value is cached.
+     */
+    [[nodiscard]] const Value *find(const time_step_t index) const {
+        return isValid(index) ? &values[index - offset] : nullptr;
+    }
+
+    /**
+     * Getter for cached value which inserts a default constructed value if no value is cached.
+     *
+     * @param index Index of time step.
+     * @return Reference to cached value.
+     */
+    Value &operator[](const time_step_t index) {
+        const auto pos{reserveIndex(index)};
+        if (!valid[pos]) {
+            valid[pos] = true;
+            ++numValid;
+        }
+        return values[pos];
+    }
+
+    /**
+     * Inserts a value if no value is cached yet.
+     *
+     * @param index Index of time step.
+     * @param value Value to insert.
+     * @return Reference to cached value.
+     */
+    const Value &tryEmplace(const time_step_t index, Value value) {
+        const auto pos{reserveIndex(index)};
+        if (!valid[pos]) {
+            values[pos] = std::move(value);
+            valid[pos] = true;
+            ++numValid;
+        }
+        return values[pos];
+    }
+
+    /**
+     * Removes cached value.
+     *
+     * @param index Index of time step.
+     */
+    void erase(const time_step_t index) {
+        if (!isValid(index))
+            return;
+        values[index - offset] = Value{}; // releases memory held by the value
+        valid[index - offset] = false;
+        if (--numValid == 0)
+            clear();
+        else
+            shrinkFront();
+    }
+
+    /**
+     * Removes all cached values.
+     */
+    void clear() {
+        values = {};
+        valid = {};
+        offset = 0;
+        numValid = 0;
+    }
+
+    /**
+     * Getter for number of cached values.
+     *
+     * @return Number of cached values.
+     */
+    [[nodiscard]] size_t size() const { return numValid; }
+
+  private:
+    [[nodiscard]] bool isValid(const time_step_t index) const {
+        return index >= offset and index - offset < values.size() and valid[index - offset];
+    }
+
+    /**
+     * Extends the array so that it contains the provided index.
+     *
+     * @param index Index of time step.
+     * @return Position of index within array.
+     */
+    size_t reserveIndex(const time_step_t index) {
+        if (values.empty())
+            offset = index;
+        if (index < offset) {
+            values.insert(values.begin(), offset - index, Value{});
+            valid.insert(valid.begin(), offset - index, false);
+            offset = index;
+        } else if (index - offset >= values.size()) {
+            values.resize(index - offset + 1);
+            valid.resize(index - offset + 1, false);
+        }
+        return index - offset;
+    }
+
+    /**
+     * Removes unused entries at the beginning of the array if they make up at least half of the array.
+     * Requires at least one cached value.
+     */
+    void shrinkFront() {
+        size_t numUnused{0};
+        while (!valid[numUnused])
+            ++numUnused;
+        if (2 * numUnused < values.size())
+            return;
+        values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(numUnused));
+        valid.erase(valid.begin(), valid.begin() + static_cast<std::ptrdiff_t>(numUnused));
+        offset += numUnused;
+    }
+
+    time_step_t offset{0};     //**< time step index of first array entry */
+    std::vector<Value, Allocator> values; //**< cached values */
+    std::vector<bool, typename std::allocator_traits<Allocator>::template rebind_alloc<bool>>
+        valid; //**< bitset indicating whether array entries contain a cached value */
+    size_t numValid{0};        //**< number of cached values */
+};
+
+#ifdef ENV_MODEL_DENSE_OBSTACLE_CACHE
+template <typename Value> using DefaultTimeStepStorage = DenseTimeStepStorage<Value>;
+#else
+template <typename Value> using DefaultTimeStepStorage = HashTimeStepStorage<Value>;
+#endif
+
+/**
+ * Thread-safe map from time steps to cached values.
+ * The entries are distributed over several shards based on the time step so that threads working on different time
+ * steps rarely contend for the same lock. Within a shard, time steps are stored at index timeStep / NumShards so that
+ * consecutive time steps result in consecutive indices. Each shard is protected by a reader/writer lock, i.e., lookups
+ * of cached values can be executed concurrently. Values are always returned as copies since references into the map
+ * would be invalidated by concurrent insertions.
+ * The storage backend is selected via the CMake option ENV_MODEL_DENSE_OBSTACLE_CACHE by default.
+ *
+ * @tparam Value Type of cached values.
+ * @tparam Storage Storage backend of the shards, i.e., HashTimeStepStorage or DenseTimeStepStorage.
+ * @tparam NumShards Number of shards.
+ */
+template <typename Value, template <typename...> class Storage = DefaultTimeStepStorage, size_t NumShards = 4>
+class ShardedTimeStepMap {
+  public:
+    ShardedTimeStepMap() = default;
+
+    ShardedTimeStepMap(const ShardedTimeStepMap &other) {
+        for (size_t idx{0}; idx < NumShards; ++idx) {
+            std::shared_lock lock{other.shards[idx].mutex};
+            shards[idx].storage = other.shards[idx].storage;
+        }
+    }
+
+    ShardedTimeStepMap(ShardedTimeStepMap &&other) noexcept {
+        for (size_t idx{0}; idx < NumShards; ++idx)
+            shards[idx].storage = std::move(other.shards[idx].storage);
+    }
+
+    ShardedTimeStepMap &operator=(const ShardedTimeStepMap &other) {
+        if (this == &other)
+            return *this;
+        for (size_t idx{0}; idx < NumShards; ++idx) {
+            std::unique_lock lockThis{shards[idx].mutex, std::defer_lock};
+            std::shared_lock lockOther{other.shards[idx].mutex, std::defer_lock};
+            std::lock(lockThis, lockOther);
+            shards[idx].storage = other.shards[idx].storage;
+        }
+        return *this;
+    }
+
+    ShardedTimeStepMap &operator=(ShardedTimeStepMap &&other) noexcept {
+        for (size_t idx{0}; idx < NumShards; ++idx)
+            shards[idx].storage = std::move(other.shards[idx].storage);
+        return *this;
+    }
+
+    ~ShardedTimeStepMap() = default;
+
+    /**
+     * Checks whether a value is cached for a time step.
+     *
+     * @param timeStep Time step of interest.
+     * @return Boolean indicating whether value exists.
+     */
+    [[nodiscard]] bool contains(const time_step_t timeStep) const {
+        const auto &shard{getShard(timeStep)};
+        std::shared_lock lock{shard.mutex};
+        return shard.storage.find(timeStep / NumShards) != nullptr;
+    }
+
+    /**
+     * Getter for cached value of a time step.
+     *
+     * @param timeStep Time step of interest.
+     * @return Copy of cached value or std::nullopt if no value is cached.
+     */
+    [[nodiscard]] std::optional<Value> find(const time_step_t timeStep) const {
+        const auto &shard{getShard(timeStep)};
+        std::shared_lock lock{shard.mutex};
+        if (const auto *value{shard.storage.find(timeStep / NumShards)})
+            return *value;
+        return std::nullopt;
+    }
+
+    /**
+     * Inspects the cached value of a time step under a shared lock.
+     *
+     * @param timeStep Time step of interest.
+     * @param func Function which is called with a pointer to the cached value or nullptr if no value is cached.
+     * @return Return value of func.
+     */
+    template <typename Func> auto visit(const time_step_t timeStep, Func &&func) const {
+        const auto &shard{getShard(timeStep)};
+        std::shared_lock lock{shard.mutex};
+        return func(shard.storage.find(timeStep / NumShards));
+    }
+
+    /**
+     * Modifies the cached value of a time step under an exclusive lock.
+     * A default constructed value is inserted if no value is cached yet.
+     *
+     * @param timeStep Time step of interest.
+     * @param func Function which is called with a reference to the cached value.
+     * @return Return value of func.
+     */
+    template <typename Func> auto modify(const time_step_t timeStep, Func &&func) {
+        auto &shard{getShard(timeStep)};
+        std::unique_lock lock{shard.mutex};
+        return func(shard.storage[timeStep / NumShards]);
+    }
+
+    /**
+     * Inserts a value for a time step if no value is cached yet.
+     * If several threads compute the same value concurrently, the value inserted first is kept.
+     *
+     * @param timeStep Time step of interest.
+     * @param value Value to insert.
+     * @return Copy of cached value.
+     */
+    Value emplace(const time_step_t timeStep, Value value) {
+        auto &shard{getShard(timeStep)};
+        std::unique_lock lock{shard.mutex};
+        return shard.storage.tryEmplace(timeStep / NumShards, std::move(value));
+    }
+
+    /**
+     * Inserts a value for a time step or replaces the cached value.
+     *
+     * @param timeStep Time step of interest.
+     * @param value Value to insert.
+     */
+    void insertOrAssign(const time_step_t timeStep, Value value) {
+        auto &shard{getShard(timeStep)};
+        std::unique_lock lock{shard.mutex};
+        shard.storage[timeStep / NumShards] = std::move(value);
+    }
+
+    /**
+     * Getter for cached value of a time step which computes and caches the value if it does not exist.
+     * The computation is executed without holding a lock so that it can access the cache itself.
+     *
+     * @param timeStep Time step of interest.
+     * @param compute Function computing the value.
+     * @return Copy of cached value.
+     */
+    template <typename Func> Value getOrCompute(const time_step_t timeStep, Func &&compute) {
+        if (auto value{find(timeStep)})
+            return *value;
+        return emplace(timeStep, compute());
+    }
+
+    /**
+     * Removes cached value of a time step.
+     *
+     * @param timeStep Time step of interest.
+     */
+    void erase(const time_step_t timeStep) {
+        auto &shard{getShard(timeStep)};
+        std::unique_lock lock{shard.mutex};
+        shard.storage.erase(timeStep / NumShards);
+    }
+
+    /**
+     * Removes all cached values.
+     */
+    void clear() {
+        for (auto &shard : shards) {
+            std::unique_lock lock{shard.mutex};
+            shard.storage.clear();
+        }
+    }
+
+    /**
+     * Getter for number of cached values.
+     *
+     * @return Number of cached time steps.
+     */
+    [[nodiscard]] size_t size() const {
+        size_t num{0};
+        for (const auto &shard : shards) {
+            std::shared_lock lock{shard.mutex};
+            num += shard.storage.size();
+        }
+        return num;
+    }
+
+  private:
+    struct Shard {
+        mutable std::shared_mutex mutex; //**< lock protecting the storage */
+        Storage<Value> storage;          //**< cached values of the shard */
+    };
+
+    Shard &getShard(const time_step_t timeStep) { return shards[timeStep % NumShards]; }
+
+    const Shard &getShard(const time_step_t timeStep) const { return shards[timeStep % NumShards]; }
+
+    std::array<Shard, NumShards> shards; //**< shards containing the cached values */
+};
+
 /**
  * Class representing cached obstacle elements.
+ * All members can be accessed concurrently, e.g., when predicates are evaluated in parallel on the same world.
  */
 struct ObstacleCache {
     template <typename Value> using time_step_map_t = tsl::robin_map<time_step_t, Value>;
+    //** type of thread-safe maps for cached values */
+    template <typename Value> using time_step_cache_t = ShardedTimeStepMap<Value>;
     //** type of history/trajectory prediction maps for physical  states */
     using state_map_t = time_step_map_t<std::shared_ptr<State>>;
     //** type of prediction maps for occupancies */
     using occupancy_map_t = time_step_map_t<std::shared_ptr<Occupancy>>;
 
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>>
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLanelets{}; //**< map of time steps to lanelets occupied by the obstacle shape */
 
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>>
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLaneletsState{}; //**< map of time steps to lanelets occupied by the obstacle states (no shape
                                  // considered) */
 
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>>
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLaneletsFront{}; //**< map of time steps to lanelets in driving direction occupied by the obstacles
                                  // front
                                  //*/
 
-    std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>>
+    time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLaneletsBack{}; //**< map of time steps to lanelets in driving direction occupied by the obstacles back
                                 //*/
 
-    mutable time_step_map_t<std::vector<std::shared_ptr<Lane>>>
+    mutable time_step_cache_t<std::vector<std::shared_ptr<Lane>>>
         occupiedLanesDrivingDir{}; //**< map of time steps to lanelets occupied by the obstacle */
 
-    mutable time_step_map_t<std::vector<std::shared_ptr<Lanelet>>>
+    mutable time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLaneletsDrivingDir{}; //**< map of time steps to lanelets in driving direction occupied by the obstacle
                                       //*/
 
-    mutable time_step_map_t<std::vector<std::shared_ptr<Lanelet>>>
+    mutable time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>>
         occupiedLaneletsNotDrivingDir{}; //**< map of time steps to lanelets in not driving direction occupied by the
                                          // obstacle */
 
-    mutable time_step_map_t<std::shared_ptr<Lane>>
+    mutable time_step_cache_t<std::shared_ptr<Lane>>
         referenceLane{}; //**< lane which is used as reference for curvilinear projection */
 
-    mutable time_step_map_t<std::vector<std::shared_ptr<Lane>>>
+    mutable time_step_cache_t<std::vector<std::shared_ptr<Lane>>>
         occupiedLanes{}; //**< map of time steps to lanes occupied by the obstacle */
 
-    mutable time_step_map_t<std::vector<double>>
+    mutable time_step_cache_t<std::vector<double>>
         frontXYPositions{}; //**< map of time steps to frontXY position of the obstacle */
 
-    mutable time_step_map_t<std::vector<double>>
+    mutable time_step_cache_t<std::vector<double>>
         backXYPositions{}; //**< map of time steps to backXY position of the obstacle */
 
-    mutable time_step_map_t<double> leftLatPosition{}; //**< map of time step to left lat position */
+    mutable time_step_cache_t<double> leftLatPosition{}; //**< map of time step to left lat position */
 
-    mutable time_step_map_t<double> rightLatPosition{}; //**< map of time step to right lat position */
+    mutable time_step_cache_t<double> rightLatPosition{}; //**< map of time step to right lat position */
 
-    mutable time_step_map_t<std::map<size_t, double>>
+    mutable time_step_cache_t<std::map<size_t, double>>
         lateralDistanceToObjects{}; //**< map of time steps to map of other obstacles and the regarding distance to the
                                     // obstacle */
 
@@ -73,10 +479,11 @@ struct ObstacleCache {
     using curvilinear_position_map_t =
         tsl::robin_pg_map<std::shared_ptr<geometry::CurvilinearCoordinateSystem>,
                           curvilinear_position_t>; //**< map from CCS to curvilinear positions */
-    mutable time_step_map_t<curvilinear_position_map_t>
+    mutable time_step_cache_t<curvilinear_position_map_t>
         convertedPositions{}; //**< map of time steps to CCS to curvilinear positions */
 
-    mutable time_step_map_t<multi_polygon_type> shapeAtTimeStep{}; //**< occupied polygon shape at time steps */
+    mutable time_step_cache_t<std::shared_ptr<const multi_polygon_type>>
+        shapeAtTimeStep{}; //**< occupied polygon shape at time steps; shared so that it can be accessed without copy */
 
     /**
      * Resets helper mappings for specific obstacle time step
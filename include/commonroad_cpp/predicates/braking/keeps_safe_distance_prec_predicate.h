@@ -123,4 +123,22 @@ class KeepsSafeDistancePrecPredicate : public CommonRoadPredicate {
     static double robustEvaluation(double lonPosK, double lonPosP, double velocityK, double velocityP,
                                    double minAccelerationK, double minAccelerationP, double tReact, double lengthK,
                                    double lengthP);
+
+    /**
+     * Boolean evaluation of predicate for several obstacle pairs over a range of time steps. The velocities, the
+     * reference coordinate system, and the front position are computed once per obstacle and time step.
+     *
+     * @param firstTimeStep First time step of interest.
+     * @param lastTimeStep Last time step of interest.
+     * @param world World object.
+     * @param obstaclePairs Pairs of kth and pth obstacle.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @return Matrix with one row per time step and one column per obstacle pair.
+     */
+    PredicateEvaluationMatrix
+    batchBooleanEvaluation(size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+                           const std::vector<ObstaclePair> &obstaclePairs,
+                           const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                           bool setBased = false) override;
 };
@@ -1,15 +1,22 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "commonroad_cpp/auxiliaryDefs/structs.h"
 #include "commonroad_cpp/auxiliaryDefs/timer.h"
 
+#include "predicate_evaluation_matrix.h"
 #include "predicate_parameter_collection.h"
 
 class Obstacle;
 class World;
 
+using ObstaclePair = std::pair<std::shared_ptr<Obstacle>, std::shared_ptr<Obstacle>>;
+
 /**
  * Interface for a predicate.
  */
@@ -61,6 +68,69 @@ class CommonRoadPredicate {
                                  const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
                                  bool setBased = false);
 
+    /**
+     * Boolean evaluation of a predicate for several obstacle pairs over a range of time steps. The default
+     * implementation calls the boolean evaluation for each entry. Frequently used predicates override it to compute
+     * values which depend only on one obstacle once per time step.
+     *
+     * @param firstTimeStep First time step of interest.
+     * @param lastTimeStep Last time step of interest.
+     * @param world Contains road network, ego vehicle, and obstacle list.
+     * @param obstaclePairs Obstacles passed as kth and pth obstacle to the boolean evaluation. The pth obstacle can be
+     * empty for predicates which are not vehicle dependent.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @return Matrix with one row per time step and one column per obstacle pair. Entries for which an obstacle does
+     * not exist at the time step are undefined.
+     * @throws std::invalid_argument if an obstacle pair is incomplete.
+     */
+    virtual PredicateEvaluationMatrix
+    batchBooleanEvaluation(size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+                           const std::vector<ObstaclePair> &obstaclePairs,
+                           const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                           bool setBased = false);
+
+    /**
+     * Boolean evaluation of a predicate for a list of entries, each consisting of a time step and an obstacle pair.
+     * In contrast to the batch evaluation, the entries do not have to form a grid of time steps and obstacle pairs.
+     *
+     * @param timeSteps Time step of each entry.
+     * @param world Contains road network, ego vehicle, and obstacle list.
+     * @param obstaclePairs Obstacle pair of each entry. The pth obstacle can be empty for predicates which are not
+     * vehicle dependent. All obstacles must exist at the time step of their entry.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @param numThreads Number of threads evaluating the entries. With one thread, the calling thread evaluates them.
+     * The threads are kept per calling thread and number of threads for subsequent evaluations. Since distributing
+     * the entries has a constant overhead, multiple threads only pay off for many entries.
+     * @return Satisfaction (1) or violation (0) of the predicate for each entry.
+     */
+    std::vector<uint8_t>
+    vectorizedBooleanEvaluation(const std::vector<size_t> &timeSteps, const std::shared_ptr<World> &world,
+                                const std::vector<ObstaclePair> &obstaclePairs,
+                                const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                                bool setBased = false, size_t numThreads = 1);
+
+    /**
+     * Robustness evaluation of a predicate for a list of entries, each consisting of a time step and an obstacle pair.
+     *
+     * @param timeSteps Time step of each entry.
+     * @param world Contains road network, ego vehicle, and obstacle list.
+     * @param obstaclePairs Obstacle pair of each entry. The pth obstacle can be empty for predicates which are not
+     * vehicle dependent. All obstacles must exist at the time step of their entry.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @param numThreads Number of threads evaluating the entries. With one thread, the calling thread evaluates them.
+     * The threads are kept per calling thread and number of threads for subsequent evaluations. Since distributing
+     * the entries has a constant overhead, multiple threads only pay off for many entries.
+     * @return Robustness of the predicate for each entry.
+     */
+    std::vector<double>
+    vectorizedRobustEvaluation(const std::vector<size_t> &timeSteps, const std::shared_ptr<World> &world,
+                               const std::vector<ObstaclePair> &obstaclePairs,
+                               const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                               bool setBased = false, size_t numThreads = 1);
+
     /**
      * Virtual function for the robustness evaluation of a predicate.
      *
@@ -137,9 +207,59 @@ class CommonRoadPredicate {
      */
     [[nodiscard]] bool isVehicleDependent() const;
 
+    /**
+     * Getter for the name under which evaluations of the predicate are traced, i.e., the demangled class name.
+     *
+     * @return Name of predicate. Stays valid until the end of the program.
+     */
+    [[nodiscard]] const char *getTraceName() const;
+
+    /**
+     * Checks that the entries of a vectorized evaluation are consistent and that all obstacles exist at the time step
+     * of their entry. Vehicle-dependent predicates additionally require the pth obstacle of each entry.
+     *
+     * @param timeSteps Time step of each entry.
+     * @param obstaclePairs Obstacle pair of each entry.
+     * @throws std::invalid_argument if an entry cannot be evaluated.
+     */
+    void validateEntries(const std::vector<size_t> &timeSteps, const std::vector<ObstaclePair> &obstaclePairs) const;
+
   protected:
+    /**
+     * Checks that each obstacle pair contains a kth obstacle and, for vehicle-dependent predicates, a pth obstacle.
+     *
+     * @param obstaclePairs Obstacle pairs.
+     * @throws std::invalid_argument if an obstacle pair is incomplete.
+     */
+    void validateObstaclePairs(const std::vector<ObstaclePair> &obstaclePairs) const;
+
+    /**
+     * Checks whether all obstacles of an obstacle pair exist at a time step.
+     *
+     * @param timeStep Time step of interest.
+     * @param obstaclePair Obstacle pair. The pth obstacle can be empty.
+     * @return Boolean indicating whether the pair can be evaluated at the time step.
+     */
+    static bool existsAtTimeStep(size_t timeStep, const ObstaclePair &obstaclePair);
+
+    /**
+     * Collects the distinct obstacles of obstacle pairs so that batch evaluations can store values which depend only
+     * on one obstacle per distinct obstacle.
+     *
+     * @param obstaclePairs Obstacle pairs.
+     * @param obstacles Distinct obstacles. Filled by the function.
+     * @return Indices of the kth and pth obstacle of each pair within the distinct obstacles. Empty pth obstacles
+     * have index obstacles.size().
+     */
+    static std::vector<std::pair<size_t, size_t>> indexObstacles(const std::vector<ObstaclePair> &obstaclePairs,
+                                                                 std::vector<std::shared_ptr<Obstacle>> &obstacles);
+
     PredicateParameters parameters; //**< Struct containing parameters of all predicates. */
     const bool vehicleDependent; //**< Boolean indicating whether predicate depends on one specific obstacle or two. */
+
+  private:
+    mutable std::once_flag traceNameFlag; //**< flag for the initialization of the trace name */
+    mutable const char *traceName{};      //**< name of predicate within traces */
 };
 
 extern std::map<std::string, std::shared_ptr<CommonRoadPredicate>> predicates; //**< List of all predicates **/
@@ -60,4 +60,22 @@ class InSameLanePredicate : public CommonRoadPredicate {
                                     const std::shared_ptr<Obstacle> &obstacleP,
                                     const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
                                     bool setBased = false) override;
+
+    /**
+     * Boolean evaluation of predicate for several obstacle pairs over a range of time steps. The lanelets of the lanes
+     * of the kth obstacle and the lanelets occupied by the pth obstacle are computed once per obstacle and time step.
+     *
+     * @param firstTimeStep First time step of interest.
+     * @param lastTimeStep Last time step of interest.
+     * @param world World object.
+     * @param obstaclePairs Pairs of kth and pth obstacle.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @return Matrix with one row per time step and one column per obstacle pair.
+     */
+    PredicateEvaluationMatrix
+    batchBooleanEvaluation(size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+                           const std::vector<ObstaclePair> &obstaclePairs,
+                           const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                           bool setBased = false) override;
 };
@@ -56,4 +56,22 @@ class OnLaneletWithTypePredicate : public CommonRoadPredicate {
                                     const std::shared_ptr<Obstacle> &obstacleP = {},
                                     const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
                                     bool setBased = false) override;
+
+    /**
+     * Boolean evaluation of predicate for several obstacle pairs over a range of time steps. The lanelet type is parsed
+     * once and the occupied lanelets are checked once per obstacle and time step.
+     *
+     * @param firstTimeStep First time step of interest.
+     * @param lastTimeStep Last time step of interest.
+     * @param world World object.
+     * @param obstaclePairs Pairs of kth and pth obstacle. The pth obstacle is not considered and can be empty.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @return Matrix with one row per time step and one column per obstacle pair.
+     */
+    PredicateEvaluationMatrix
+    batchBooleanEvaluation(size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+                           const std::vector<ObstaclePair> &obstaclePairs,
+                           const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                           bool setBased = false) override;
 };
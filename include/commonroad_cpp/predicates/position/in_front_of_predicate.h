@@ -86,4 +86,22 @@ class InFrontOfPredicate : public CommonRoadPredicate {
      * @return Real value indicating robustness of the predicate.
      */
     static double robustEvaluation(double lonPositionP, double lonPositionK, double lengthP, double lengthK);
+
+    /**
+     * Boolean evaluation of predicate for several obstacle pairs over a range of time steps. The reference coordinate
+     * system and the front position of the pth obstacle are computed once per obstacle and time step.
+     *
+     * @param firstTimeStep First time step of interest.
+     * @param lastTimeStep Last time step of interest.
+     * @param world World object.
+     * @param obstaclePairs Pairs of pth and kth obstacle.
+     * @param additionalFunctionParameters Additional parameters.
+     * @param setBased Boolean indicating whether set-based evaluation should be used.
+     * @return Matrix with one row per time step and one column per obstacle pair.
+     */
+    PredicateEvaluationMatrix
+    batchBooleanEvaluation(size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+                           const std::vector<ObstaclePair> &obstaclePairs,
+                           const std::vector<std::string> &additionalFunctionParameters = {"0.0"},
+                           bool setBased = false) override;
 };
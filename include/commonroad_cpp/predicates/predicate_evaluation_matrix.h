@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * Dense matrix storing the results of a batch evaluation of a predicate with one row per time step and one column per
+ * obstacle pair. Entries for which an obstacle of the pair does not exist at the time step are undefined.
+ */
+class PredicateEvaluationMatrix {
+  public:
+    static constexpr uint8_t unsatisfied{0}; //**< value of entries for which the predicate is not satisfied */
+    static constexpr uint8_t satisfied{1};   //**< value of entries for which the predicate is satisfied */
+    static constexpr uint8_t undefined{2};   //**< value of entries which were not evaluated */
+
+    /**
+     * Constructor initializing all entries as undefined.
+     *
+     * @param firstTimeStep First time step covered by the matrix.
+     * @param lastTimeStep Last time step covered by the matrix.
+     * @param numPairs Number of obstacle pairs (columns).
+     */
+    PredicateEvaluationMatrix(size_t firstTimeStep, size_t lastTimeStep, size_t numPairs);
+
+    /**
+     * Getter for the result of an obstacle pair at a time step.
+     *
+     * @param timeStep Time step of interest.
+     * @param pairIndex Index of obstacle pair.
+     * @return Boolean indicating satisfaction of the predicate; empty if entry is undefined.
+     */
+    [[nodiscard]] std::optional<bool> at(size_t timeStep, size_t pairIndex) const;
+
+    /**
+     * Setter for the result of an obstacle pair at a time step.
+     *
+     * @param timeStep Time step of interest.
+     * @param pairIndex Index of obstacle pair.
+     * @param value Boolean indicating satisfaction of the predicate.
+     */
+    void set(size_t timeStep, size_t pairIndex, bool value);
+
+    /**
+     * Getter for first time step.
+     *
+     * @return First time step covered by the matrix.
+     */
+    [[nodiscard]] size_t getFirstTimeStep() const;
+
+    /**
+     * Getter for number of time steps.
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] size_t getNumTimeSteps() const;
+
+    /**
+     * Getter for number of obstacle pairs.
+     *
+     * @return Number of columns.
+     */
+    [[nodiscard]] size_t getNumPairs() const;
+
+    /**
+     * Getter for raw entries in row-major order.
+     *
+     * @return Entries with values unsatisfied, satisfied, or undefined.
+     */
+    [[nodiscard]] const std::vector<uint8_t> &getValues() const;
+
+  private:
+    /**
+     * Computes the position of an entry within the raw entries.
+     *
+     * @param timeStep Time step of interest.
+     * @param pairIndex Index of obstacle pair.
+     * @return Index of entry.
+     */
+    [[nodiscard]] size_t index(size_t timeStep, size_t pairIndex) const;
+
+    size_t firstTimeStep;        //**< first time step covered by the matrix */
+    size_t numTimeSteps;         //**< number of rows */
+    size_t numPairs;             //**< number of columns */
+    std::vector<uint8_t> values; //**< entries in row-major order */
+};
@@ -6,16 +6,26 @@
 #define _USE_MATH_DEFINES
 #endif
 #include <commonroad_cpp/predicates/predicate_parameter.h>
+#include <commonroad_cpp/predicates/predicate_parameter_ids.h>
 #include <map>
 #include <string>
 
-extern std::map<std::string, PredicateParam> paramMap;
+/**
+ * Getter for the default values of all predicate parameters. The parameters are constructed on first use since
+ * predicate parameter collections are also part of static objects, e.g., the global predicate map.
+ *
+ * @return Map of parameter names to parameters.
+ */
+const std::map<std::string, PredicateParam> &defaultPredicateParameters();
 
 struct PredicateParameters {
     /**
      * Constructor of predicate parameters colllection.
      */
-    PredicateParameters() { checkParameterValidity(); }
+    PredicateParameters() {
+        checkParameterValidity();
+        initializeValues();
+    }
 
     /**
      * Checks validity of all parameters.
@@ -37,6 +47,14 @@ struct PredicateParameters {
      */
     double getParam(const std::string &name);
 
+    /**
+     * Getter for predicate parameter without lookup by name. Should be used within predicates.
+     *
+     * @param param Identifier of parameter.
+     * @return Value of parameter.
+     */
+    [[nodiscard]] double getParam(PredicateParamId param) const { return values[static_cast<size_t>(param)]; }
+
     /**
      * Getter for all predicate names.
      *
@@ -68,6 +86,11 @@ struct PredicateParameters {
     std::map<std::string, double> getParameterCollectionComplete() const;
 
   private:
+    /**
+     * Copies the values of all parameters and constants to the array indexed by parameter identifiers.
+     */
+    void initializeValues();
+
     std::map<std::string, double> constantMap{
         {"epsilon", 1e-6},         // small value close to zero for different purposes
         {"fovSpeedLimit", 50},     // field of view speed limit; will be replaced by compute with calc_v_max_fov() [m/s]
@@ -75,5 +98,6 @@ struct PredicateParameters {
         {"roadConditionSpeedLimit",
          50}, // road condition speed limit; will be replaced by compute with calc_v_max_road_condition() [m/s]
     };
-    std::map<std::string, PredicateParam> parameterCollection = paramMap;
+    std::map<std::string, PredicateParam> parameterCollection = defaultPredicateParameters();
+    std::array<double, numPredicateParams> values{}; //**< values of parameters and constants indexed by identifier */
 };
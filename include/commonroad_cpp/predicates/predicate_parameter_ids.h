@@ -0,0 +1,76 @@
+#pragma once
+
+// generated from predicate_parameter.yaml via scripts/create_param_cpp_from_yaml.py
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Identifiers of predicate parameters and constants. Predicates access parameters via their identifier so that no
+ * names have to be compared during evaluation.
+ */
+enum class PredicateParamId : size_t {
+    aBrakingIntersection,
+    closeStopLineDistance,
+    closeToBicycle,
+    closeToLaneBorder,
+    closeToOtherVehicle,
+    curvilinearInSameDirOrientation,
+    dBrakingIntersection,
+    dCauseBrakingIntersection,
+    dCloseToCrossing,
+    desiredInterstateVelocity,
+    desiredUrbanVelocity,
+    globalInSameDirOrientation,
+    intersectionBrakingPossible,
+    laneMatchingOrientation,
+    minInterstateWidth,
+    minSafetyDistance,
+    minVelocityDif,
+    narrowRoad,
+    slightlyHigherSpeedDifference,
+    standstillError,
+    stopLineDistance,
+    uTurnLower,
+    uTurnUpper,
+    brakingSpeedLimit,
+    epsilon,
+    fovSpeedLimit,
+    roadConditionSpeedLimit,
+};
+
+constexpr size_t numPredicateParams{27};
+
+/**
+ * Names of predicate parameters and constants in the order of their identifiers.
+ */
+constexpr std::array<std::string_view, numPredicateParams> predicateParamNames{
+    "aBrakingIntersection",
+    "closeStopLineDistance",
+    "closeToBicycle",
+    "closeToLaneBorder",
+    "closeToOtherVehicle",
+    "curvilinearInSameDirOrientation",
+    "dBrakingIntersection",
+    "dCauseBrakingIntersection",
+    "dCloseToCrossing",
+    "desiredInterstateVelocity",
+    "desiredUrbanVelocity",
+    "globalInSameDirOrientation",
+    "intersectionBrakingPossible",
+    "laneMatchingOrientation",
+    "minInterstateWidth",
+    "minSafetyDistance",
+    "minVelocityDif",
+    "narrowRoad",
+    "slightlyHigherSpeedDifference",
+    "standstillError",
+    "stopLineDistance",
+    "uTurnLower",
+    "uTurnUpper",
+    "brakingSpeedLimit",
+    "epsilon",
+    "fovSpeedLimit",
+    "roadConditionSpeedLimit",
+};
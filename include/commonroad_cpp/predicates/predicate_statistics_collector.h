@@ -0,0 +1,92 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <commonroad_cpp/auxiliaryDefs/structs.h>
+
+/**
+ * Collects predicate statistics per predicate and scenario from several threads. Each thread records into its own
+ * statistics so that concurrent evaluations do not contend. The statistics of all threads are merged for reporting.
+ */
+class PredicateStatisticsCollector {
+  public:
+    using Key = std::pair<std::string, std::string>; //**< predicate name and scenario */
+
+    /**
+     * Constructor.
+     */
+    PredicateStatisticsCollector();
+
+    PredicateStatisticsCollector(const PredicateStatisticsCollector &) = delete;
+    PredicateStatisticsCollector &operator=(const PredicateStatisticsCollector &) = delete;
+
+    /**
+     * Getter for the statistics of the calling thread for a predicate and scenario. The statistics must only be
+     * updated by the calling thread.
+     *
+     * @param predicateName Name of predicate.
+     * @param scenario Scenario or benchmark ID.
+     * @return Statistics of the calling thread.
+     */
+    [[nodiscard]] const std::shared_ptr<PredicateStatistics> &getThreadStatistics(const std::string &predicateName,
+                                                                                  const std::string &scenario);
+
+    /**
+     * Merges the statistics of all threads. Must only be called while no thread updates its statistics.
+     *
+     * @return Statistics per predicate and scenario.
+     */
+    [[nodiscard]] std::map<Key, PredicateStatistics> getStatistics() const;
+
+    /**
+     * Merges the statistics of all threads and scenarios. Must only be called while no thread updates its statistics.
+     *
+     * @return Statistics per predicate.
+     */
+    [[nodiscard]] std::map<std::string, PredicateStatistics> getPredicateStatistics() const;
+
+    /**
+     * Writes the merged statistics as CSV with one row per predicate over all scenarios, followed by one row per
+     * scenario. Computation times are given in milliseconds.
+     *
+     * @param stream Output stream.
+     */
+    void writeCsv(std::ostream &stream) const;
+
+    /**
+     * Writes the merged statistics as JSON with one object per predicate containing the statistics over all
+     * scenarios and per scenario. Computation times are given in milliseconds.
+     *
+     * @param stream Output stream.
+     */
+    void writeJson(std::ostream &stream) const;
+
+    /**
+     * Resets the statistics of all threads. Must only be called while no thread updates its statistics.
+     */
+    void reset();
+
+  private:
+    using ThreadStatistics = std::map<Key, std::shared_ptr<PredicateStatistics>>;
+
+    /**
+     * Getter for the statistics of the calling thread. Registers the thread on its first call.
+     *
+     * @return Statistics of the calling thread.
+     */
+    ThreadStatistics &getThreadShard();
+
+    static thread_local std::unordered_map<size_t, ThreadStatistics *>
+        threadShards; //**< statistics of the current thread per collector ID */
+
+    const size_t id;                                       //**< unique ID used to find the statistics of a thread */
+    mutable std::mutex mutex;                              //**< mutex protecting the registration of threads */
+    std::vector<std::unique_ptr<ThreadStatistics>> shards; //**< statistics of each registered thread */
+};
@@ -47,6 +47,21 @@ class Lane : public Lanelet {
      */
     [[nodiscard]] const std::shared_ptr<CurvilinearCoordinateSystem> &getCurvilinearCoordinateSystem();
 
+    /**
+     * Computes the reference path of the curvilinear coordinate system by smoothing and resampling the center line.
+     *
+     * @return Reference path.
+     */
+    [[nodiscard]] std::vector<vertex> computeReferencePath() const;
+
+    /**
+     * Setter for a precomputed reference path, e.g., loaded from a road network snapshot. The curvilinear coordinate
+     * system is then created from this path without smoothing and resampling the center line again.
+     *
+     * @param path Reference path as computed by computeReferencePath.
+     */
+    void setReferencePath(std::vector<vertex> path);
+
     /**
      * Getter for lanelets contained in lane.
      *
@@ -107,6 +122,7 @@ class Lane : public Lanelet {
     mutable std::shared_ptr<CurvilinearCoordinateSystem>
         curvilinearCoordinateSystem;      //**< curvilinear coordinate system defined by lane */
     std::set<size_t> containedLaneletIds; //**< set of IDs of the lanelets constructing lane */
+    std::vector<vertex> referencePath;    //**< precomputed reference path of curvilinear coordinate system */
 
     std::mutex ccs_lock;
 };
@@ -11,7 +11,7 @@ namespace lane_operations {
  * @param curLanelet Lanelet which is currently at the end of list and for which successors should be added.
  * @param fov Field of view defining length of lane.
  * @param numIntersections Number of intersection which still can be considered for lane creation.
- * @param containedLanelets List of contained lanelets in lane. Required for recursive call.
+ * @param containedLanelets List of contained lanelets in lane preceding the current lanelet.
  * @param offset Offset from the beginning of the reference lanelet.
  * @return List containing a list of lanelets contained in lane.
  */
@@ -20,6 +20,15 @@ combineLaneletAndSuccessorsToLane(const std::shared_ptr<Lanelet> &curLanelet, do
                                   const std::vector<std::shared_ptr<Lanelet>> &containedLanelets = {},
                                   double offset = 0.0);
 
+/**
+ * Computes the lane along the shortest path between the lanelets at two points. The lane is interned in the road
+ * network so that repeated queries return the same lane.
+ *
+ * @param start Start point.
+ * @param end End point.
+ * @param road_network Road network.
+ * @return Pointer to lane or nullptr if end is not reachable from start.
+ */
 std::shared_ptr<Lane> computeLaneFromTwoPoints(const vertex &start, const vertex &end,
                                                const std::shared_ptr<RoadNetwork> &road_network);
 
@@ -29,7 +38,7 @@ std::shared_ptr<Lane> computeLaneFromTwoPoints(const vertex &start, const vertex
  *
  * @param curLanelet Lanelet which is currently at the end of list and for which predecessors should be added.
  * @param fov Field of view defining length of lane.
- * @param containedLanelets List of contained lanelets in lane. Required for recursive call.
+ * @param containedLanelets List of contained lanelets in lane preceding the current lanelet.
  * @param numIntersections Number of intersection which still can be considered for lane creation.
  * @param offset Offset from the end of the reference lanelet.
  * @return List containing a list of lanelets contained in lane.
@@ -38,6 +47,52 @@ std::vector<std::vector<std::shared_ptr<Lanelet>>>
 combineLaneletAndPredecessorsToLane(const std::shared_ptr<Lanelet> &curLanelet, double fov, int numIntersections,
                                     std::vector<std::shared_ptr<Lanelet>> containedLanelets = {}, double offset = 0.0);
 
+/**
+ * Lanelet sequences originating from the same lanelet stored as prefix tree. Each node references a lanelet and the
+ * node of the previous lanelet in the sequence, so that sequences with a common beginning share their nodes.
+ */
+struct LaneletSequenceTree {
+    std::vector<std::shared_ptr<Lanelet>> lanelets; //**< lanelet of each node */
+    std::vector<size_t> parents;                    //**< index of previous node; the root references itself */
+    std::vector<size_t> leaves;                     //**< last node of each sequence in order of enumeration */
+
+    /**
+     * Appends the lanelets of a sequence to a list.
+     *
+     * @param sequenceIdx Index of sequence.
+     * @param fromRoot Boolean indicating whether the lanelets are appended starting at the root or at the last lanelet.
+     * @param skipRoot Boolean indicating whether the root lanelet is omitted.
+     * @param sequence List to which lanelets are appended.
+     */
+    void appendSequence(size_t sequenceIdx, bool fromRoot, bool skipRoot,
+                        std::vector<std::shared_ptr<Lanelet>> &sequence) const;
+
+    /**
+     * Extracts all sequences starting at the root.
+     *
+     * @return List containing a list of lanelets for each sequence.
+     */
+    [[nodiscard]] std::vector<std::vector<std::shared_ptr<Lanelet>>> extractSequences() const;
+};
+
+/**
+ * Enumerates the lanelet sequences which are obtained by following successors or predecessors from a lanelet. A
+ * sequence ends if the last lanelet has no further successors/predecessors, closes a loop, the sequence reaches the
+ * length given by the parameter fov, or the number of allowed intersections is exceeded. Borders are not followed.
+ * The traversal extends a shared prefix tree, i.e., lanelets of common sequence beginnings are stored only once.
+ *
+ * @param lanelet Lanelet at which sequences start.
+ * @param fov Field of view defining length of sequences.
+ * @param numIntersections Number of intersection which still can be considered for sequence creation.
+ * @param successors Boolean indicating whether successors or predecessors are followed.
+ * @param offset Offset from the beginning (successors) or end (predecessors) of the lanelet.
+ * @param containedLanelets Lanelets preceding the start lanelet in each sequence.
+ * @return Prefix tree of sequences.
+ */
+LaneletSequenceTree enumerateLaneletSequences(const std::shared_ptr<Lanelet> &lanelet, double fov, int numIntersections,
+                                              bool successors, double offset = 0.0,
+                                              const std::vector<std::shared_ptr<Lanelet>> &containedLanelets = {});
+
 /**
  * Creates lanes which are originating from given set of lanelets.
  *
@@ -54,6 +109,23 @@ createLanesBySingleLanelets(const std::vector<std::shared_ptr<Lanelet>> &initial
                             const std::shared_ptr<RoadNetwork> &roadNetwork, double fovRear, double fovFront,
                             int numIntersections, vertex position);
 
+/**
+ * Creates and registers lanes in the road network for each of the given lanelets as initial lanelet. Equivalent to
+ * calling createLanesBySingleLanelets for each lanelet sequentially, i.e., lane IDs and the content of the road network
+ * do not depend on the number of threads.
+ *
+ * @param initialLanelets Initial lanelets based on which lanes should be created.
+ * @param roadNetwork Pointer to road network.
+ * @param fovRear Field of view behind obstacle which defines length of lanes.
+ * @param fovFront Field of view in front of obstacle which defines length of lanes.
+ * @param numIntersections Number of intersection which still can be considered for lane creation.
+ * @param position Position which should be used as offset.
+ * @param numThreads Number of threads used for lane creation. A value of 0 uses all available threads.
+ */
+void createLanesForAllLanelets(const std::vector<std::shared_ptr<Lanelet>> &initialLanelets,
+                               const std::shared_ptr<RoadNetwork> &roadNetwork, double fovRear, double fovFront,
+                               int numIntersections, vertex position, size_t numThreads);
+
 /**
  * Creates lane objects given set of lanelets which form lane.
  *
@@ -10,6 +10,7 @@
 #include <commonroad_cpp/roadNetwork/types.h>
 
 class Area;
+class OrientedBoundingBox;
 class TrafficLight;
 class TrafficSign;
 class StopLine;
@@ -346,6 +347,19 @@ class Lanelet : public std::enable_shared_from_this<Lanelet> {
      */
     [[nodiscard]] bool applyIntersectionTesting(const polygon_type &polygon_shape) const;
 
+    /**
+     * Given a rectangle, checks whether the rectangle intersects with the lanelet. Yields the same result as for the
+     * polygon of the rectangle, but most cases are decided by separating axis tests against the convex segments between
+     * consecutive border vertices. The polygon is only used if the segments are not convex or the rectangle is closer
+     * to the lanelet border than the tolerance of the outer polygon simplification.
+     *
+     * @param boundingBox Rectangle as oriented bounding box.
+     * @param polygon_shape Boost polygon of rectangle.
+     * @return boolean indicating whether lanelet is occupied
+     */
+    [[nodiscard]] bool applyIntersectionTesting(const OrientedBoundingBox &boundingBox,
+                                                const polygon_type &polygon_shape) const;
+
     /**
      * Given a polygon, checks whether the polygon intersects with the lanelet given an intersection category.
      *
@@ -356,6 +370,15 @@ class Lanelet : public std::enable_shared_from_this<Lanelet> {
      */
     [[nodiscard]] bool checkIntersection(const polygon_type &polygon_shape, ContainmentType intersection_type) const;
 
+    /**
+     * Checks whether a point is located within the lanelet or on its border.
+     *
+     * @param xPos x-coordinate of point
+     * @param yPos y-coordinate of point
+     * @return boolean indicating whether lanelet contains point
+     */
+    [[nodiscard]] bool containsPoint(double xPos, double yPos) const;
+
     /**
      * Calculates center vertices as the arithmetic mean between the vertex on the left and right border.
      */
@@ -439,6 +462,8 @@ class Lanelet : public std::enable_shared_from_this<Lanelet> {
 
     /**
      * Finds closest index on center line given 2D vertex. By default, function does not consider last index.
+     * If several vertices have the same distance, the smallest index is returned. Long center lines are searched
+     * using bounding boxes of consecutive vertex blocks, which are created at the first call.
      *
      * @param positionX X-position of point of interest.
      * @param positionY Y-position of point of interest.
@@ -510,6 +535,32 @@ class Lanelet : public std::enable_shared_from_this<Lanelet> {
     [[nodiscard]] std::vector<std::shared_ptr<Lanelet>> getAdjacentBothDir() const;
 
   private:
+    /**
+     * Acceleration structure for closest vertex queries on the center line. Stores the center vertex coordinates as
+     * separate arrays and the bounding box of each block of consecutive vertices.
+     */
+    struct CenterLineIndex;
+
+    /**
+     * Getter for acceleration structure of center line. Creates the structure if it does not exist yet.
+     *
+     * @return Pointer to acceleration structure.
+     */
+    std::shared_ptr<const CenterLineIndex> getCenterLineIndex() const;
+
+    /**
+     * Convex polygons between consecutive vertices of the left and right border, which together form the lanelet
+     * before simplification of the outer polygon.
+     */
+    struct ConvexSegments;
+
+    /**
+     * Getter for convex segments of lanelet. Creates the segments if they do not exist yet.
+     *
+     * @return Pointer to convex segments.
+     */
+    std::shared_ptr<const ConvexSegments> getConvexSegments() const;
+
     mutable lanelet_id_t laneletId{};                                  //**< unique ID of lanelet */
     mutable std::vector<vertex> centerVertices;                        //**< vertices of center line of lanelet */
     mutable std::vector<vertex> leftBorder;                            //**< vertices of left border */
@@ -546,6 +597,10 @@ class Lanelet : public std::enable_shared_from_this<Lanelet> {
     mutable std::vector<std::shared_ptr<Lanelet>>
         adjacentSameDir; //**< all adjacent lanelets with the same driving direction */
     mutable std::vector<std::shared_ptr<Lanelet>> adjacentBothDir; //**< all adjacent lanelets */
+    mutable std::shared_ptr<const CenterLineIndex>
+        centerLineIndex; //**< closest vertex acceleration structure; accessed atomically */
+    mutable std::shared_ptr<const ConvexSegments>
+        convexSegments; //**< segments for intersection tests with rectangles; accessed atomically */
 };
 
 extern const std::unordered_map<std::string, LaneletType> LaneletTypeNames;
@@ -1,23 +1,159 @@
 #pragma once
 
-#include "dijkstra.h"
-#include <map>
+#include <array>
+#include <atomic>
+#include <boost/container_hash/hash.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
 class Lanelet;
 
+/**
+ * Directed graph of a lanelet network used for shortest path queries. Lanelets are mapped to dense vertex indices and
+ * the edges are stored in compressed sparse row format. Two edge sets are maintained: successor relations only and
+ * successor relations together with lane changes between adjacent lanelets of the same driving direction.
+ *
+ * Path queries can be executed concurrently. Results are memoized in a sharded cache with bounded size.
+ */
 class LaneletGraph {
-    std::unordered_map<size_t, size_t> verticesAdjSuc;
-    std::unordered_map<size_t, size_t> verticesSuc;
-    std::unordered_map<size_t, size_t> verticesAdjSucRes;
-    std::unordered_map<size_t, size_t> verticesSucRes;
-    graph<std::size_t, size_t> graphAdjSuc;
-    graph<std::size_t, size_t> graphSuc;
-    std::map<std::array<size_t, 2>, std::vector<size_t>> queries;
-
   public:
-    explicit LaneletGraph(const std::vector<std::shared_ptr<Lanelet>> &lanelets);
+    static constexpr size_t defaultMemoCapacity{65536};          //**< default maximum number of memoized paths */
+    static constexpr size_t defaultReachabilityTableLimit{4096}; //**< default lanelet limit of reachability table */
+
+    /**
+     * Constructor creating the graph for a set of lanelets.
+     *
+     * @param lanelets Lanelets of the road network.
+     * @param memoCapacity Maximum number of memoized paths. A capacity of zero disables the memoization.
+     * @param reachabilityTableLimit Maximum number of lanelets for which a table containing the reachability via
+     * successors of all lanelet pairs is precomputed. The table requires number of lanelets squared bits.
+     */
+    explicit LaneletGraph(const std::vector<std::shared_ptr<Lanelet>> &lanelets,
+                          size_t memoCapacity = defaultMemoCapacity,
+                          size_t reachabilityTableLimit = defaultReachabilityTableLimit);
+
+    /**
+     * Computes the shortest path between two lanelets with Dijkstra's algorithm. Following a successor costs 1 and a
+     * lane change costs 4. The search state is kept in a thread-local workspace so that apart from the resulting path
+     * no memory is allocated.
+     *
+     * @param src ID of start lanelet.
+     * @param dst ID of target lanelet.
+     * @param considerAdjacency Boolean indicating whether lane changes to adjacent lanelets are allowed.
+     * @return IDs of lanelets along the path including start and target lanelet. Empty if target is not reachable.
+     */
     std::vector<size_t> findPaths(size_t src, size_t dst, bool considerAdjacency);
+
+    /**
+     * Checks whether a lanelet can be reached from another lanelet by following successors only. Uses the precomputed
+     * reachability table if available and a path query otherwise.
+     *
+     * @param src ID of start lanelet.
+     * @param dst ID of target lanelet.
+     * @return Boolean indicating whether target is reachable.
+     */
+    bool isReachable(size_t src, size_t dst);
+
+    /**
+     * Getter for availability of precomputed reachability table.
+     *
+     * @return Boolean indicating whether reachability table exists.
+     */
+    [[nodiscard]] bool hasReachabilityTable() const;
+
+    /**
+     * Getter for number of path queries answered by the memo.
+     *
+     * @return Number of memo hits.
+     */
+    [[nodiscard]] size_t getMemoHits() const;
+
+    /**
+     * Getter for number of path queries which required a search.
+     *
+     * @return Number of memo misses.
+     */
+    [[nodiscard]] size_t getMemoMisses() const;
+
+    /**
+     * Getter for number of currently memoized paths.
+     *
+     * @return Number of memoized paths.
+     */
+    [[nodiscard]] size_t getMemoSize() const;
+
+  private:
+    /**
+     * Edges in compressed sparse row format: the outgoing edges of vertex i are stored at the positions
+     * [offsets[i], offsets[i + 1]) of targets and weights.
+     */
+    struct CsrAdjacency {
+        std::vector<size_t> offsets; //**< start position of outgoing edges for each vertex */
+        std::vector<size_t> targets; //**< target vertex of each edge */
+        std::vector<size_t> weights; //**< cost of each edge */
+    };
+
+    using path_query = std::array<size_t, 3>; //**< source ID, target ID, and whether lane changes are considered */
+    using path_map = std::unordered_map<path_query, std::vector<size_t>, boost::hash<path_query>>;
+
+    /**
+     * Part of the path memo protected by its own reader/writer lock. If the shard is full, the path memoized first is
+     * evicted.
+     */
+    struct MemoShard {
+        mutable std::shared_mutex mutex;       //**< lock protecting the paths and insertion order */
+        path_map paths;                        //**< memoized paths */
+        std::deque<path_query> insertionOrder; //**< queries in order of insertion used for eviction */
+    };
+
+    static constexpr size_t numMemoShards{8}; //**< number of memo shards */
+
+    /**
+     * Creates the compressed sparse row representation for a list of edges. The order of outgoing edges of a vertex is
+     * the order in which they appear in the list.
+     *
+     * @param numVertices Number of vertices.
+     * @param edges Edges as source, target, and weight.
+     * @return Adjacency in compressed sparse row format.
+     */
+    static CsrAdjacency createCsrAdjacency(size_t numVertices, const std::vector<std::array<size_t, 3>> &edges);
+
+    /**
+     * Runs Dijkstra's algorithm on dense vertex indices.
+     *
+     * @param adjacency Edges to consider.
+     * @param srcIdx Index of start vertex.
+     * @param dstIdx Index of target vertex.
+     * @return Lanelet IDs along the shortest path. Empty if target is not reachable.
+     */
+    std::vector<size_t> searchShortestPath(const CsrAdjacency &adjacency, size_t srcIdx, size_t dstIdx) const;
+
+    /**
+     * Computes the reachability via successors of all vertex pairs by a breadth-first search from each vertex.
+     */
+    void createReachabilityTable();
+
+    /**
+     * Getter for memo shard responsible for a query.
+     *
+     * @param query Path query.
+     * @return Memo shard.
+     */
+    MemoShard &getMemoShard(const path_query &query);
+
+    std::vector<size_t> laneletIds;                   //**< lanelet ID of each vertex index */
+    std::unordered_map<size_t, size_t> vertexIndices; //**< mapping of lanelet ID to vertex index */
+    CsrAdjacency adjacencyAdjSuc;                     //**< successor and lane change edges */
+    CsrAdjacency adjacencySuc;                        //**< successor edges */
+    std::vector<uint64_t> reachabilityTable;          //**< bit matrix of vertices reachable from each vertex */
+    size_t reachabilityRowWidth{0};                   //**< number of 64 bit words per row of reachability table */
+    std::array<MemoShard, numMemoShards> memoShards;  //**< shards of path memo */
+    size_t memoShardCapacity;                         //**< maximum number of memoized paths per shard */
+    std::atomic<size_t> memoHits{0};                  //**< number of queries answered by the memo */
+    std::atomic<size_t> memoMisses{0};                //**< number of queries requiring a search */
 };
@@ -26,6 +26,8 @@ class IncomingGroup;
 class TrafficLight;
 class TrafficSign;
 class Intersection;
+class OrientedBoundingBox;
+struct vertex;
 
 /**
  * Class representing a road network.
@@ -35,7 +37,8 @@ class RoadNetwork {
     /**
      * Constructor for RoadNetwork. Takes a lanelet network and automatically generates lanes out of them.
      * Additionally, creates and Rtree from the lanelets for faster access of lanelets and faster
-     * occupancy computations of obstacles.
+     * occupancy computations of obstacles. Lanelets, traffic signs, traffic lights, and intersections are indexed by
+     * their IDs for constant time lookups.
      *
      * @param network List of pointers to lanelets.
      * @param cou Country where road network is located.
@@ -129,6 +132,18 @@ class RoadNetwork {
      */
     std::vector<std::shared_ptr<Lanelet>> findOccupiedLaneletsByShape(const multi_polygon_type &polygonShape);
 
+    /**
+     * Given a rectangle, finds the list of lanelets within the road network which intersect with the rectangle. Yields
+     * the same lanelets as for the polygon of the rectangle but evaluates most intersections with the oriented bounding
+     * box.
+     *
+     * @param polygonShape boost polygon of rectangle
+     * @param boundingBox rectangle as oriented bounding box
+     * @return list of lanelet pointers
+     */
+    std::vector<std::shared_ptr<Lanelet>> findOccupiedLaneletsByShape(const polygon_type &polygonShape,
+                                                                      const OrientedBoundingBox &boundingBox);
+
     /**
      * Given a position, finds the list of lanelets within the road network which contain the point.
      *
@@ -138,6 +153,15 @@ class RoadNetwork {
      */
     std::vector<std::shared_ptr<Lanelet>> findLaneletsByPosition(double xPos, double yPos);
 
+    /**
+     * Given a list of positions, finds for each position the list of lanelets within the road network which contain the
+     * point.
+     *
+     * @param positions list of points
+     * @return list of lanelet pointers for each point
+     */
+    std::vector<std::vector<std::shared_ptr<Lanelet>>> findLaneletsByPositions(const std::vector<vertex> &positions);
+
     /**
      * Returns the lanelet which corresponds to a given lanelet ID.
      *
@@ -154,6 +178,22 @@ class RoadNetwork {
      */
     std::shared_ptr<TrafficLight> findTrafficLightById(size_t lightID);
 
+    /**
+     * Returns the traffic sign which corresponds to a given traffic sign ID.
+     *
+     * @param signID traffic sign ID
+     * @return pointer to traffic sign
+     */
+    std::shared_ptr<TrafficSign> findTrafficSignById(size_t signID);
+
+    /**
+     * Returns the intersection which corresponds to a given intersection ID.
+     *
+     * @param intersectionID intersection ID
+     * @return pointer to intersection
+     */
+    std::shared_ptr<Intersection> findIntersectionById(size_t intersectionID);
+
     /**
      * Matches a string to country enum.
      *
@@ -172,6 +212,8 @@ class RoadNetwork {
 
     /**
      * Adds lanes to road network. It it is checked whether lane already exists.
+     * The lane registry is thread-safe, i.e., lanes can be added and queried concurrently. Added lanes are interned,
+     * see internLane.
      *
      * @param newLanes Pointers to lanes which should be added.
      * @param initialLanelet Lanelet based on which the lanes were created.
@@ -196,6 +238,40 @@ class RoadNetwork {
      */
     std::vector<std::shared_ptr<Lane>> findLanesByContainedLanelet(size_t laneletID);
 
+    /**
+     * Searches for the existing lane consisting of the lanelets with the provided IDs.
+     *
+     * @param laneletIDs Lanelet IDs of lane.
+     * @return Pointer to existing lane or nullptr if no such lane exists.
+     */
+    std::shared_ptr<Lane> findLaneByContainedLanelets(const lanelet_id_set &laneletIDs);
+
+    /**
+     * Searches for the canonical lane consisting of the lanelets with the provided IDs in the given order.
+     *
+     * @param laneletIDs Ordered lanelet IDs of lane.
+     * @return Pointer to canonical lane or nullptr if no such lane exists.
+     */
+    std::shared_ptr<Lane> findLaneByLaneletSequence(const std::vector<size_t> &laneletIDs);
+
+    /**
+     * Searches for the lanelets based on which a registered lane was created.
+     *
+     * @param lane Pointer to lane.
+     * @return IDs of base lanelets; empty if the lane is not registered.
+     */
+    lanelet_id_set findBaseLaneletsByLane(const std::shared_ptr<Lane> &lane);
+
+    /**
+     * Interns a lane: if a lane with the same ordered sequence of lanelets exists already, the existing lane is
+     * returned so that geometry and curvilinear coordinate system are shared. Otherwise, the provided lane becomes the
+     * canonical lane of its sequence. Interned lanes are not added to the lanes of the road network.
+     *
+     * @param lane Pointer to lane which should be interned.
+     * @return Pointer to canonical lane.
+     */
+    std::shared_ptr<Lane> internLane(const std::shared_ptr<Lane> &lane);
+
     /**
      * Setter for idCounterRef.
      *
@@ -210,6 +286,21 @@ class RoadNetwork {
      */
     std::shared_ptr<size_t> getIdCounterRef() const;
 
+    /**
+     * Increments the ID counter of the world object in a thread-safe way.
+     *
+     * @return New unique ID.
+     */
+    size_t generateId();
+
+    /**
+     * Reserves a block of consecutive IDs in a thread-safe way.
+     *
+     * @param numIds Number of IDs to reserve.
+     * @return First reserved ID.
+     */
+    size_t reserveIds(size_t numIds);
+
     /**
      * Finds incoming object to which lanelet belongs. Returns empty pointer if lanelet is part of incoming.
      *
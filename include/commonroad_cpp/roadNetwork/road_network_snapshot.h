@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class RoadNetwork;
+
+/**
+ * Versioned binary snapshot of the lanes of a road network. The snapshot contains the lane registry, i.e., the lanelets
+ * and base lanelets of each lane, the lane geometry, and the smoothed and resampled reference paths of the curvilinear
+ * coordinate systems. It is stored as flat arrays so that a loaded snapshot is memory-mapped and read in place.
+ * The snapshot stores a checksum of the map it was created for and the road network parameters affecting the reference
+ * paths so that outdated snapshots can be detected. Snapshots are only valid on machines with the same byte order.
+ */
+class RoadNetworkSnapshot {
+  public:
+    static constexpr uint32_t version{1}; //**< version of the snapshot format */
+
+    /**
+     * Constructor mapping a snapshot file into memory.
+     *
+     * @param file Path to snapshot file.
+     * @throws std::runtime_error if the file cannot be read or is no snapshot of the current version.
+     */
+    explicit RoadNetworkSnapshot(const std::string &file);
+
+    /**
+     * Destructor unmapping the snapshot file.
+     */
+    ~RoadNetworkSnapshot();
+
+    RoadNetworkSnapshot(const RoadNetworkSnapshot &) = delete;
+    RoadNetworkSnapshot &operator=(const RoadNetworkSnapshot &) = delete;
+
+    /**
+     * Writes a snapshot of the lanes of a road network. The file is replaced atomically so that processes loading the
+     * snapshot concurrently never read a partially written file.
+     *
+     * @param file Path to snapshot file.
+     * @param roadNetwork Road network whose lanes are stored.
+     * @param mapChecksum Checksum of the map from which the road network was created, see computeChecksum.
+     */
+    static void write(const std::string &file, const std::shared_ptr<RoadNetwork> &roadNetwork, uint64_t mapChecksum);
+
+    /**
+     * Restores the lanes of a road network from a snapshot file if the file exists and matches the map.
+     *
+     * @param file Path to snapshot file.
+     * @param roadNetwork Road network created from the map.
+     * @param mapChecksum Checksum of the map, see computeChecksum.
+     * @return Boolean indicating whether the lanes were restored.
+     */
+    static bool restoreIfValid(const std::string &file, const std::shared_ptr<RoadNetwork> &roadNetwork,
+                               uint64_t mapChecksum);
+
+    /**
+     * Computes the 64-bit FNV-1a checksum of a file, e.g., of a map file.
+     *
+     * @param file Path to file.
+     * @return Checksum of the file content.
+     */
+    static uint64_t computeChecksum(const std::string &file);
+
+    /**
+     * Getter for checksum of the map for which the snapshot was created.
+     *
+     * @return Map checksum.
+     */
+    [[nodiscard]] uint64_t getMapChecksum() const;
+
+    /**
+     * Getter for number of lanes.
+     *
+     * @return Number of lanes in snapshot.
+     */
+    [[nodiscard]] size_t getNumLanes() const;
+
+    /**
+     * Checks whether the snapshot can be used for a map, i.e., whether the snapshot was created for the same map and
+     * with the same road network parameters.
+     *
+     * @param mapChecksum Checksum of the map.
+     * @return Boolean indicating whether the snapshot is valid.
+     */
+    [[nodiscard]] bool isValidFor(uint64_t mapChecksum) const;
+
+    /**
+     * Adds the lanes of the snapshot to the lane registry of a road network. The curvilinear coordinate systems of the
+     * lanes are created from the stored reference paths when they are requested the first time.
+     *
+     * @param roadNetwork Road network created from the map of the snapshot.
+     * @throws std::runtime_error if the snapshot references lanelets which are not part of the road network.
+     */
+    void restore(const std::shared_ptr<RoadNetwork> &roadNetwork) const;
+
+  private:
+    struct impl;
+    std::unique_ptr<impl> pImpl; //**< mapped snapshot file */
+};
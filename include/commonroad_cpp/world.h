@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <tsl/robin_map.h>
+#include <tsl/robin_set.h>
 
 #include "commonroad_cpp/auxiliaryDefs/types_and_definitions.h"
 #include "commonroad_cpp/obstacle/actuator_parameters.h"
@@ -32,13 +33,14 @@ class WorldParameters {
      * @param actuatorParametersEgo Actuator parameters for ego vehicle.
      * @param timeParameters Time parameters for obstacles.
      * @param actuatorParametersObstacles Actuator parameters for obstacles.
+     * @param numberOfThreads Number of threads used for world construction. A value of 0 uses all available threads.
      */
     WorldParameters(const RoadNetworkParameters &roadNetworkParameters, const SensorParameters &sensorParameters,
                     const ActuatorParameters &actuatorParametersEgo, const TimeParameters &timeParameters,
-                    const ActuatorParameters &actuatorParametersObstacles)
+                    const ActuatorParameters &actuatorParametersObstacles, size_t numberOfThreads = 1)
         : roadNetworkParams(roadNetworkParameters), sensorParams(sensorParameters),
           actuatorParamsEgo(actuatorParametersEgo), timeParams(timeParameters),
-          actuatorParamsObstacles(actuatorParametersObstacles), defaultParams(false) {}
+          actuatorParamsObstacles(actuatorParametersObstacles), numThreads(numberOfThreads), defaultParams(false) {}
 
     /**
      * Getter for road network parameters.
@@ -81,6 +83,20 @@ class WorldParameters {
      */
     [[nodiscard]] ActuatorParameters getActuatorParamsObstacles() const { return actuatorParamsObstacles; }
 
+    /**
+     * Getter for number of threads used for world construction.
+     *
+     * @return Number of threads. A value of 0 indicates that all available threads are used.
+     */
+    [[nodiscard]] size_t getNumThreads() const { return numThreads; }
+
+    /**
+     * Setter for number of threads used for world construction.
+     *
+     * @param numberOfThreads Number of threads. A value of 0 uses all available threads.
+     */
+    void setNumThreads(const size_t numberOfThreads) { numThreads = numberOfThreads; }
+
     /**
      * Checks whether default parameters are set.
      *
@@ -95,6 +111,7 @@ class WorldParameters {
     TimeParameters timeParams{TimeParameters::dynamicDefaults()};            /** Parameters for obstacle time. */
     ActuatorParameters actuatorParamsObstacles{
         ActuatorParameters::vehicleDefaults()}; /** Parameters for obstacle actuators. */
+    size_t numThreads{1};                       /** Number of threads used for world construction. */
     bool defaultParams{true};                   /** Boolean indicating whether default parameters are set. */
 };
 
@@ -255,6 +272,14 @@ class World {
     std::vector<std::shared_ptr<Obstacle>> obstacles;   //**< pointers to obstacles *
     double dt;                                          //**<Time step size [s] *
     WorldParameters worldParameters; //**< General parameters for world, e.g. obstacles, road network. */
+    tsl::robin_map<size_t, std::shared_ptr<Obstacle>> obstacleIndex;   //**< ID-keyed index of obstacles */
+    tsl::robin_map<size_t, std::shared_ptr<Obstacle>> egoVehicleIndex; //**< ID-keyed index of ego vehicles */
+
+    /**
+     * Rebuilds the ID-keyed indices of obstacles and ego vehicles. Must be called whenever obstacles or egoVehicles
+     * are modified. If an ID occurs multiple times within one list, the first occurrence is indexed.
+     */
+    void updateObstacleIndex();
 
     /**
      * Initializes missing state information, e.g, acceleration or reaction time.
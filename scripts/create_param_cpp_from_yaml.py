@@ -1,8 +1,54 @@
+from pathlib import Path
+
 import yaml
 
+# constants which are not configurable via the yaml file but accessible via identifiers; must match the constant map
+# in predicate_parameter_collection.h
+CONSTANTS = ["brakingSpeedLimit", "epsilon", "fovSpeedLimit", "roadConditionSpeedLimit"]
+
+
+def parameter_names(params):
+    return sorted(params.keys()) + sorted(CONSTANTS)
+
+
+def generate_header_code(params):
+    names = parameter_names(params)
+    cpp_code = """#pragma once
+
+// generated from predicate_parameter.yaml via scripts/create_param_cpp_from_yaml.py
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Identifiers of predicate parameters and constants. Predicates access parameters via their identifier so that no
+ * names have to be compared during evaluation.
+ */
+enum class PredicateParamId : size_t {
+"""
+    for name in names:
+        cpp_code += f"    {name},\n"
+    cpp_code += f"""}};
+
+constexpr size_t numPredicateParams{{{len(names)}}};
+
+/**
+ * Names of predicate parameters and constants in the order of their identifiers.
+ */
+constexpr std::array<std::string_view, numPredicateParams> predicateParamNames{{
+"""
+    for name in names:
+        cpp_code += f'    "{name}",\n'
+    cpp_code += "};\n"
+    return cpp_code
+
 
 def generate_cpp_code(params):
-    cpp_code = """#include <commonroad_cpp/predicates/predicate_parameter_collection.h>
+    cpp_code = """#include <algorithm>
+#include <boost/range/adaptor/map.hpp>
+#include <boost/range/algorithm/copy.hpp>
+#include <commonroad_cpp/predicates/predicate_parameter_collection.h>
 #include <stdexcept>
 
 void PredicateParameters::checkParameterValidity() {
@@ -15,8 +61,13 @@ void PredicateParameters::updateParam(const std::string &name, double value) {
     if (parameterCollection.count(name) == 1) {
         parameterCollection.find(name)->second.updateValue(value);
         parameterCollection.find(name)->second.checkParameterValidity();
+    } else if (constantMap.count(name) == 1) {
+        constantMap.at(name) = value;
     } else
         throw std::runtime_error("No predicate " + name + " found for update");
+    if (const auto iter{std::find(predicateParamNames.begin(), predicateParamNames.end(), name)};
+        iter != predicateParamNames.end())
+        values.at(static_cast<size_t>(iter - predicateParamNames.begin())) = value;
 }
 
 double PredicateParameters::getParam(const std::string &name) {
@@ -28,25 +79,69 @@ double PredicateParameters::getParam(const std::string &name) {
         throw std::runtime_error("No predicate " + name + " found");
 }
 
+void PredicateParameters::initializeValues() {
+    for (size_t idx{0}; idx < numPredicateParams; ++idx)
+        values.at(idx) = getParam(std::string{predicateParamNames.at(idx)});
+}
+
+std::vector<std::string> PredicateParameters::getPredicateNames() const {
+    std::vector<std::string> keys;
+    boost::copy(parameterCollection | boost::adaptors::map_keys, std::back_inserter(keys));
+    return keys;
+}
+
+std::vector<std::string> PredicateParameters::getConstantNames() const {
+    std::vector<std::string> keys;
+    boost::copy(constantMap | boost::adaptors::map_keys, std::back_inserter(keys));
+    return keys;
+}
+
+std::map<std::string, std::tuple<std::string, std::string, double, double, std::vector<std::string>, std::string,
+                                 std::string, std::string, std::string, double>>
+PredicateParameters::getParameterCollection() const {
+    std::map<std::string, std::tuple<std::string, std::string, double, double, std::vector<std::string>, std::string,
+                                     std::string, std::string, std::string, double>>
+        parameterCollectionTuple;
+
+    for (const auto &[key, value] : parameterCollection)
+        parameterCollectionTuple.emplace(key, value.asTuple());
+
+    return parameterCollectionTuple;
+}
+std::map<std::string, double> PredicateParameters::getParameterCollectionComplete() const {
+    auto tmpMap{constantMap};
+    for (const auto &elem : parameterCollection)
+        tmpMap.insert({elem.first, elem.second.getValue()});
+    return tmpMap;
+}
+
 // when using a parameter in a new predicate or adding a new parameter, add it to the yaml file and generate the
 // cpp via the Python script
-std::map<std::string, PredicateParam> paramMap = {
+const std::map<std::string, PredicateParam> &defaultPredicateParameters() {
+    static const std::map<std::string, PredicateParam> paramMap{
 """
     for key, value in params.items():
         occurrences = ", ".join(['"' + str(i) + '"' for i in value["occurrences"]])
         cpp_code += (
-            f'    {{"{key}", PredicateParam("{key}", "{value["description"]}", {value["max"]}, '
+            f'        {{"{key}", PredicateParam("{key}", "{value["description"]}", {value["max"]}, '
             f'{value["min"]}, {{{occurrences}}}, "{value["property"]}", "{value["strictness"]}", '
             f'"{value["type"]}", "{value["unit"]}", {value["value"]})}},\n'
         )
-    cpp_code += "};"
+    cpp_code += """    };
+    return paramMap;
+}
+"""
     return cpp_code
 
 
-with open("predicate_parameter.yaml", "r") as file:
+# the generated files should be formatted with clang-format afterwards
+repository = Path(__file__).parent.parent
+
+with open(Path(__file__).parent / "predicate_parameter.yaml", "r") as file:
     data = yaml.safe_load(file)
 
-cpp_file_content = generate_cpp_code(data)
+with open(repository / "src/commonroad_cpp/predicates/predicate_parameter_collection.cpp", "w") as file:
+    file.write(generate_cpp_code(data))
 
-with open("predicate_parameter_collection.cpp", "w") as file:
-    file.write(cpp_file_content)
+with open(repository / "include/commonroad_cpp/predicates/predicate_parameter_ids.h", "w") as file:
+    file.write(generate_header_code(data))
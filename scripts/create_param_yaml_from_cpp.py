@@ -11,8 +11,8 @@ def search_cpp_files() -> Dict[str, List[str]]:
     # Dictionary to store results
     results = {}
 
-    # Regular expression pattern to match 'parameters.getParam("name"]'
-    pattern = re.compile(r'parameters\.getParam\("(.*?)"\)')
+    # Regular expression pattern to match 'parameters.getParam(PredicateParamId::name)' and 'parameters.getParam("name")'
+    pattern = re.compile(r'parameters\.getParam\((?:PredicateParamId::(\w+)|"(\w+)")\)')
 
     # Iterate over all .cpp files in the current directory
     for filename in (Path(__file__).parent.parent / "src/commonroad_cpp/predicates").rglob("**/*.cpp"):
@@ -20,7 +20,7 @@ def search_cpp_files() -> Dict[str, List[str]]:
             # Read the file
             content = file.read()
             # Find all matches of the pattern
-            matches = pattern.findall(content)
+            matches = [typed or named for typed, named in pattern.findall(content)]
             # For each match, add the filename to the list of files for that match
             for match in matches:
                 if match not in results:
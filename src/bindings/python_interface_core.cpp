@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 
 #include <commonroad_cpp/interfaces/commonroad/input_utils.h>
@@ -108,6 +112,14 @@ void updateObstacles(World *t, const nb::list &py_obstacles) {
     t->updateObstacles(obstacleList);
 }
 
+std::vector<std::vector<std::shared_ptr<Lanelet>>>
+findLaneletsByPositions(RoadNetwork *t, const nb::ndarray<const double, nb::shape<-1, 2>, nb::c_contig> &positions) {
+    std::vector<vertex> points(positions.shape(0));
+    for (size_t idx{0}; idx < points.size(); ++idx)
+        points[idx] = vertex{positions(idx, 0), positions(idx, 1)};
+    return t->findLaneletsByPositions(points);
+}
+
 void setReferenceLaneByLine(Obstacle *t, const nb::ndarray<double, nb::shape<2>> &start,
                             const nb::ndarray<double, nb::shape<2>> &end,
                             const std::shared_ptr<RoadNetwork> &roadNetwork) {
@@ -117,15 +129,182 @@ void setReferenceLaneByLine(Obstacle *t, const nb::ndarray<double, nb::shape<2>>
     const vertex end_vertex{end_data[0], end_data[1]};
     const auto newLane{lane_operations::computeLaneFromTwoPoints(start_vertex, end_vertex, roadNetwork)};
     if (newLane != nullptr) {
-        for (const auto &lane : roadNetwork->getLanes())
-            if (lane->getContainedLaneletIDs() == newLane->getContainedLaneletIDs()) {
-                t->setReferenceLane(lane);
-                return;
-            }
+        if (const auto lane{roadNetwork->findLaneByContainedLanelets(newLane->getContainedLaneletIDs())}) {
+            t->setReferenceLane(lane);
+            return;
+        }
     }
     t->setReferenceLane(newLane);
 }
 
+/**
+ * Creates NumPy array which owns the provided values.
+ *
+ * @param values Values in row-major order.
+ * @param numColumns Number of columns.
+ * @return Array of shape (values.size() / numColumns, numColumns).
+ */
+static nb::ndarray<nb::numpy, double, nb::ndim<2>> createOwnedArray(std::vector<double> values, size_t numColumns) {
+    auto *data{new std::vector<double>(std::move(values))};
+    nb::capsule owner(data, [](void *ptr) noexcept { delete static_cast<std::vector<double> *>(ptr); });
+    return nb::ndarray<nb::numpy, double, nb::ndim<2>>(data->data(), {data->size() / numColumns, numColumns}, owner);
+}
+
+/**
+ * Creates read-only NumPy view of vertices without copying them. Must be returned with rv_policy::reference_internal
+ * so that the object owning the vertices is kept alive. The view is invalidated if the vertices are modified.
+ *
+ * @param vertices Vertices.
+ * @return Array of shape (vertices.size(), 2).
+ */
+static nb::ndarray<nb::numpy, const double, nb::shape<-1, 2>> createVertexView(const std::vector<vertex> &vertices) {
+    return nb::ndarray<nb::numpy, const double, nb::shape<-1, 2>>(reinterpret_cast<const double *>(vertices.data()),
+                                                                  {vertices.size(), 2});
+}
+
+/**
+ * Record of a state array. Velocity and acceleration are NaN if they are not set.
+ */
+struct StateRecord {
+    int64_t timeStep;    //**< time step */
+    double xPosition;    //**< x-position */
+    double yPosition;    //**< y-position */
+    double orientation;  //**< global orientation */
+    double velocity;     //**< velocity */
+    double acceleration; //**< acceleration */
+};
+
+/**
+ * Record of an obstacle state array.
+ */
+struct ObstacleStateRecord {
+    int64_t id;        //**< obstacle ID */
+    StateRecord state; //**< state of obstacle */
+};
+
+static nb::handle stateDtype;         // data type of state arrays; created when the module is initialized
+static nb::handle obstacleStateDtype; // data type of obstacle state arrays; created when the module is initialized
+
+/**
+ * Creates NumPy structured data type matching the memory layout of StateRecord or ObstacleStateRecord.
+ *
+ * @param withId Boolean indicating whether the records contain the obstacle ID, i.e., are ObstacleStateRecord.
+ * @return Data type with one field per record value.
+ */
+static nb::object createStateDtype(bool withId) {
+    nb::list names;
+    nb::list formats;
+    nb::list offsets;
+    const auto addField{[&](const char *name, const char *format, size_t offset) {
+        names.append(name);
+        formats.append(format);
+        offsets.append(offset);
+    }};
+    const size_t stateOffset{withId ? offsetof(ObstacleStateRecord, state) : 0};
+    if (withId)
+        addField("id", "i8", offsetof(ObstacleStateRecord, id));
+    addField("time_step", "i8", stateOffset + offsetof(StateRecord, timeStep));
+    addField("x", "f8", stateOffset + offsetof(StateRecord, xPosition));
+    addField("y", "f8", stateOffset + offsetof(StateRecord, yPosition));
+    addField("orientation", "f8", stateOffset + offsetof(StateRecord, orientation));
+    addField("velocity", "f8", stateOffset + offsetof(StateRecord, velocity));
+    addField("acceleration", "f8", stateOffset + offsetof(StateRecord, acceleration));
+    nb::dict fields;
+    fields["names"] = names;
+    fields["formats"] = formats;
+    fields["offsets"] = offsets;
+    fields["itemsize"] = withId ? sizeof(ObstacleStateRecord) : sizeof(StateRecord);
+    return nb::module_::import_("numpy").attr("dtype")(fields);
+}
+
+/**
+ * Creates NumPy structured array which owns the provided records.
+ *
+ * @param records Records of array.
+ * @param dtype Structured data type matching the memory layout of Record.
+ * @return One-dimensional array with one element per record.
+ */
+template <typename Record> static nb::object createRecordArray(std::vector<Record> records, nb::handle dtype) {
+    auto *data{new std::vector<Record>(std::move(records))};
+    nb::capsule owner(data, [](void *ptr) noexcept { delete static_cast<std::vector<Record> *>(ptr); });
+    const nb::ndarray<nb::numpy, uint8_t, nb::ndim<1>> bytes(reinterpret_cast<uint8_t *>(data->data()),
+                                                             {data->size() * sizeof(Record)}, owner);
+    return nb::cast(bytes).attr("view")(dtype);
+}
+
+/**
+ * Converts state to state record.
+ *
+ * @param state State to convert.
+ * @return State record.
+ */
+static StateRecord createStateRecord(const State &state) {
+    constexpr double notSet{std::numeric_limits<double>::quiet_NaN()};
+    return {static_cast<int64_t>(state.getTimeStep()),
+            state.getXPosition(),
+            state.getYPosition(),
+            state.getGlobalOrientation(),
+            state.getValidStates().velocity ? state.getVelocity() : notSet,
+            state.getValidStates().acceleration ? state.getAcceleration() : notSet};
+}
+
+/**
+ * Converts states to structured state array ordered by time step.
+ *
+ * @param states States per time step.
+ * @return Array with one state per element, see STATE_DTYPE.
+ */
+static nb::object createStateArray(const state_map_t &states) {
+    std::vector<time_step_t> timeSteps;
+    timeSteps.reserve(states.size());
+    for (const auto &item : states)
+        timeSteps.push_back(item.first);
+    std::sort(timeSteps.begin(), timeSteps.end());
+    std::vector<StateRecord> records;
+    records.reserve(timeSteps.size());
+    for (const auto timeStep : timeSteps)
+        records.push_back(createStateRecord(*states.at(timeStep)));
+    return createRecordArray(std::move(records), stateDtype);
+}
+
+void updateTrajectoryArray(Obstacle *t, const TranslatePythonTypes::StateArray &states) {
+    tsl::robin_map<time_step_t, std::shared_ptr<State>> trajectory;
+    for (const auto &state : TranslatePythonTypes::extractStates(states))
+        trajectory[state->getTimeStep()] = state;
+    t->setTrajectoryPrediction(trajectory);
+}
+
+void updateTrajectoryRecords(Obstacle *t, const nb::handle &states) {
+    // structured arrays, e.g., returned by trajectory_prediction_array, are converted to the column layout
+    const auto fieldNames{nb::module_::import_("builtins").attr("list")(stateDtype.attr("names"))};
+    const auto columns{nb::module_::import_("numpy.lib.recfunctions")
+                           .attr("structured_to_unstructured")(states[fieldNames], nb::arg("dtype") = "f8")};
+    updateTrajectoryArray(t, nb::cast<TranslatePythonTypes::StateArray>(
+                                 nb::module_::import_("numpy").attr("ascontiguousarray")(columns)));
+}
+
+nb::list getOccupancyVertices(Obstacle *t, time_step_t timeStep) {
+    nb::list polygons;
+    for (const auto &polygon : t->getOccupancyPolygonShape(timeStep)) {
+        std::vector<double> values;
+        values.reserve(2 * polygon.outer().size());
+        for (const auto &point : polygon.outer())
+            values.insert(values.end(), {point.x(), point.y()});
+        polygons.append(createOwnedArray(std::move(values), 2));
+    }
+    return polygons;
+}
+
+nb::object getObstacleStateArray(const World *t, time_step_t timeStep) {
+    std::vector<ObstacleStateRecord> records;
+    records.reserve(t->getObstacles().size());
+    for (const auto &obs : t->getObstacles())
+        if (obs->timeStepExists(timeStep))
+            records.push_back(
+                {static_cast<int64_t>(obs->getId()), createStateRecord(*obs->getStateByTimeStep(timeStep))});
+    return createRecordArray(std::move(records), obstacleStateDtype);
+}
+
 nb::dict getTrajectoryPrediction(Obstacle *t) {
     nb::dict trajDict;
     for (const auto &item : t->getTrajectoryPrediction()) {
@@ -233,7 +412,19 @@ void init_python_interface_core(nb::module_ &m) {
 
     nb::class_<Polygon, Shape>(m, "Polygon")
         .def(nb::init<std::vector<vertex>>())
-        .def_prop_ro("vertices", &Polygon::getPolygonVertices);
+        .def(
+            "__init__",
+            [](Polygon *t, const TranslatePythonTypes::VertexArray &vertices) {
+                new (t) Polygon(TranslatePythonTypes::convertVertices(vertices));
+            },
+            "vertices")
+        .def_prop_ro("vertices", &Polygon::getPolygonVertices)
+        .def_prop_ro("vertices_array", [](const Polygon &polygon) {
+            std::vector<double> values;
+            for (const auto &vert : polygon.getPolygonVertices())
+                values.insert(values.end(), {vert.x, vert.y});
+            return createOwnedArray(std::move(values), 2);
+        });
 
     nb::class_<ShapeGroup, Shape>(m, "ShapeGroup")
         .def(nb::init<>())
@@ -300,6 +491,9 @@ void init_python_interface_core(nb::module_ &m) {
     nb::class_<WorldParameters>(m, "WorldParameters")
         .def(
             nb::init<RoadNetworkParameters, SensorParameters, ActuatorParameters, TimeParameters, ActuatorParameters>())
+        .def(nb::init<RoadNetworkParameters, SensorParameters, ActuatorParameters, TimeParameters, ActuatorParameters,
+                      size_t>())
+        .def_prop_rw("num_threads", &WorldParameters::getNumThreads, &WorldParameters::setNumThreads)
         .def_prop_ro("road_network_params", &WorldParameters::getRoadNetworkParams)
         .def_prop_ro("sensor_params", &WorldParameters::getSensorParams)
         .def_prop_ro("actuator_params_ego", &WorldParameters::getActuatorParamsEgo)
@@ -332,6 +526,10 @@ void init_python_interface_core(nb::module_ &m) {
         .def_prop_ro("trajectory_prediction", &getTrajectoryPrediction)
         .def_prop_ro("history", &getTrajectoryHistory)
         .def_prop_ro("set_based_prediction", &getSetBasedPrediction)
+        .def_prop_ro("trajectory_prediction_array",
+                     [](const Obstacle &obs) { return createStateArray(obs.getTrajectoryPrediction()); })
+        .def_prop_ro("history_array", [](const Obstacle &obs) { return createStateArray(obs.getTrajectoryHistory()); })
+        .def("occupancy_vertices", &getOccupancyVertices, "time_step")
         .def("shape", &Obstacle::getGeoShape)
         .def("occupied_lanes", &Obstacle::getOccupiedLanes)
         .def("occupied_lanelets", &Obstacle::getOccupiedLaneletsByShape)
@@ -345,6 +543,8 @@ void init_python_interface_core(nb::module_ &m) {
         .def("set_reference_lane_by_line", &setReferenceLaneByLine, "py_start", "py_end", "roadNetwork")
         .def("get_time_steps", &Obstacle::getTimeSteps)
         .def("update_trajectory", &updateTrajectory, "py_state_list")
+        .def("update_trajectory_array", &updateTrajectoryArray, "states")
+        .def("update_trajectory_array", &updateTrajectoryRecords, "states")
         .def("clear_cache", &Obstacle::clearCache)
         .def("update_current_state", &updateCurrentState, "py_current_state");
 
@@ -394,6 +594,18 @@ void init_python_interface_core(nb::module_ &m) {
         .def_prop_rw("left_border_vertices", &Lanelet::getLeftBorderVertices, &Lanelet::setLeftBorderVertices)
         .def_prop_rw("right_border_vertices", &Lanelet::getRightBorderVertices, &Lanelet::setRightBorderVertices)
         .def_prop_ro("center_vertices", &Lanelet::getCenterVertices)
+        .def_prop_ro(
+            "left_border_array",
+            [](const Lanelet &lanelet) { return createVertexView(lanelet.getLeftBorderVertices()); },
+            nb::rv_policy::reference_internal)
+        .def_prop_ro(
+            "right_border_array",
+            [](const Lanelet &lanelet) { return createVertexView(lanelet.getRightBorderVertices()); },
+            nb::rv_policy::reference_internal)
+        .def_prop_ro(
+            "center_vertices_array",
+            [](const Lanelet &lanelet) { return createVertexView(lanelet.getCenterVertices()); },
+            nb::rv_policy::reference_internal)
         .def_prop_rw("lanelet_types", &Lanelet::getLaneletTypes, &Lanelet::setLaneletTypes)
         .def_prop_rw("line_marking_left", &Lanelet::getLineMarkingLeft, &Lanelet::setLineMarkingLeft)
         .def_prop_rw("line_marking_right", &Lanelet::getLineMarkingRight, &Lanelet::setLineMarkingRight)
@@ -458,7 +670,12 @@ void init_python_interface_core(nb::module_ &m) {
         .def_prop_ro("traffic_signs", &RoadNetwork::getTrafficSigns)
         .def_prop_ro("intersections", &RoadNetwork::getIntersections)
         .def("update_traffic_lights", &updateTrafficLights)
-        .def("find_traffic_light_by_id", &RoadNetwork::findTrafficLightById);
+        .def("find_lanelet_by_id", &RoadNetwork::findLaneletById)
+        .def("find_lanelets_by_position", &RoadNetwork::findLaneletsByPosition)
+        .def("find_lanelets_by_positions", &findLaneletsByPositions)
+        .def("find_traffic_light_by_id", &RoadNetwork::findTrafficLightById)
+        .def("find_traffic_sign_by_id", &RoadNetwork::findTrafficSignById)
+        .def("find_intersection_by_id", &RoadNetwork::findIntersectionById);
 
     nb::class_<World>(m, "World")
         .def("__init__",
@@ -571,6 +788,7 @@ void init_python_interface_core(nb::module_ &m) {
         .def("update_obstacles", &World::updateObstacles)
         .def("update_obstacles", &updateObstacles)
         .def("reset_obstacle_cache", &World::resetObstacleCache)
+        .def("obstacle_state_array", &getObstacleStateArray, "time_step")
         .def("update_obstacles_traj", &updateObstaclesTraj);
 
     nb::class_<PlanningProblem>(m, "PlanningProblem");
@@ -581,6 +799,12 @@ void init_python_interface_core(nb::module_ &m) {
         .def_ro("time_step_size", &Scenario::timeStepSize)
         .def_ro("planning_problems", &Scenario::planningProblems);
 
+    // the data types are never released since the array conversions refer to them
+    stateDtype = createStateDtype(false).release();
+    obstacleStateDtype = createStateDtype(true).release();
+    m.attr("STATE_DTYPE") = stateDtype;
+    m.attr("OBSTACLE_STATE_DTYPE") = obstacleStateDtype;
+
     m.def("create_world", &XMLReader::createWorldFromXML);
 
     m.def("read_scenario", &InputUtils::getDataFromCommonRoad);
@@ -1,8 +1,13 @@
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/map.h>
+#include <nanobind/stl/optional.h>
 #include <nanobind/stl/shared_ptr.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
@@ -21,6 +26,119 @@ static std::shared_ptr<CommonRoadPredicate> lookup_predicate(const std::string &
 
 static decltype(predicates) get_predicates() { return predicates; }
 
+using IdArray = nb::ndarray<const int64_t, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+/**
+ * Converts array of non-negative integers, e.g., time steps or obstacle IDs.
+ *
+ * @param values Array of integers.
+ * @param name Name of the array used in error messages.
+ * @return Converted values.
+ */
+static std::vector<size_t> convertIds(const IdArray &values, const std::string &name) {
+    std::vector<size_t> result(values.shape(0));
+    for (size_t idx{0}; idx < result.size(); ++idx) {
+        if (values(idx) < 0)
+            throw std::invalid_argument("Negative value in " + name + " at index " + std::to_string(idx) + ".");
+        result[idx] = static_cast<size_t>(values(idx));
+    }
+    return result;
+}
+
+/**
+ * Looks up an obstacle of a vectorized evaluation.
+ *
+ * @param world World containing the obstacles.
+ * @param obstacleId ID of the obstacle.
+ * @param name Name of the ID array used in error messages.
+ * @param idx Index of the ID within the array used in error messages.
+ * @return Obstacle with the provided ID.
+ */
+static std::shared_ptr<Obstacle> findObstacle(const World &world, size_t obstacleId, const std::string &name,
+                                              size_t idx) {
+    try {
+        return world.findObstacle(obstacleId);
+    } catch (const std::logic_error &) {
+        throw std::invalid_argument("Unknown obstacle ID " + std::to_string(obstacleId) + " in " + name +
+                                    " at index " + std::to_string(idx) + ".");
+    }
+}
+
+/**
+ * Resolves the obstacle pairs of a vectorized evaluation.
+ *
+ * @param world World containing the obstacles.
+ * @param obstacleIdsK IDs of the kth obstacles.
+ * @param obstacleIdsP IDs of the pth obstacles. The pth obstacles are empty if no IDs are provided.
+ * @return Obstacle pairs.
+ */
+static std::vector<ObstaclePair> resolveObstaclePairs(const World &world, const IdArray &obstacleIdsK,
+                                                      const std::optional<IdArray> &obstacleIdsP) {
+    const auto idsK{convertIds(obstacleIdsK, "obstacleIdsK")};
+    std::vector<ObstaclePair> obstaclePairs(idsK.size());
+    for (size_t idx{0}; idx < idsK.size(); ++idx)
+        obstaclePairs[idx].first = findObstacle(world, idsK[idx], "obstacleIdsK", idx);
+    if (!obstacleIdsP)
+        return obstaclePairs;
+    const auto idsP{convertIds(*obstacleIdsP, "obstacleIdsP")};
+    if (idsP.size() != idsK.size())
+        throw std::invalid_argument("obstacleIdsK and obstacleIdsP must have the same length.");
+    for (size_t idx{0}; idx < idsP.size(); ++idx)
+        obstaclePairs[idx].second = findObstacle(world, idsP[idx], "obstacleIdsP", idx);
+    return obstaclePairs;
+}
+
+/**
+ * Creates one-dimensional NumPy array which owns the provided values.
+ *
+ * @param values Values of array.
+ * @return Array of type ArrayType, which must have the same size as ValueType.
+ */
+template <typename ArrayType, typename ValueType>
+static nb::ndarray<nb::numpy, ArrayType, nb::ndim<1>> createOwnedArray(std::vector<ValueType> values) {
+    static_assert(sizeof(ArrayType) == sizeof(ValueType), "Array and value type must have the same size.");
+    auto *data{new std::vector<ValueType>(std::move(values))};
+    nb::capsule owner(data, [](void *ptr) noexcept { delete static_cast<std::vector<ValueType> *>(ptr); });
+    return nb::ndarray<nb::numpy, ArrayType, nb::ndim<1>>(reinterpret_cast<ArrayType *>(data->data()), {data->size()},
+                                                          owner);
+}
+
+static nb::ndarray<nb::numpy, bool, nb::ndim<1>>
+vectorizedBooleanEvaluation(CommonRoadPredicate &predicate, const std::shared_ptr<World> &world,
+                            const IdArray &timeSteps, const IdArray &obstacleIdsK,
+                            const std::optional<IdArray> &obstacleIdsP,
+                            const std::vector<std::string> &additionalFunctionParameters, bool setBased,
+                            size_t numThreads) {
+    const auto steps{convertIds(timeSteps, "timeSteps")};
+    const auto obstaclePairs{resolveObstaclePairs(*world, obstacleIdsK, obstacleIdsP)};
+    predicate.validateEntries(steps, obstaclePairs);
+    std::vector<uint8_t> result;
+    {
+        nb::gil_scoped_release release;
+        result = predicate.vectorizedBooleanEvaluation(steps, world, obstaclePairs, additionalFunctionParameters,
+                                                       setBased, numThreads);
+    }
+    return createOwnedArray<bool>(std::move(result));
+}
+
+static nb::ndarray<nb::numpy, double, nb::ndim<1>>
+vectorizedRobustEvaluation(CommonRoadPredicate &predicate, const std::shared_ptr<World> &world,
+                           const IdArray &timeSteps, const IdArray &obstacleIdsK,
+                           const std::optional<IdArray> &obstacleIdsP,
+                           const std::vector<std::string> &additionalFunctionParameters, bool setBased,
+                           size_t numThreads) {
+    const auto steps{convertIds(timeSteps, "timeSteps")};
+    const auto obstaclePairs{resolveObstaclePairs(*world, obstacleIdsK, obstacleIdsP)};
+    predicate.validateEntries(steps, obstaclePairs);
+    std::vector<double> result;
+    {
+        nb::gil_scoped_release release;
+        result = predicate.vectorizedRobustEvaluation(steps, world, obstaclePairs, additionalFunctionParameters,
+                                                      setBased, numThreads);
+    }
+    return createOwnedArray<double>(std::move(result));
+}
+
 void init_python_interface_predicates(nb::module_ &m) {
     nb::class_<PredicateParameters>(m, "PredicateParameters");
 
@@ -34,6 +152,12 @@ void init_python_interface_predicates(nb::module_ &m) {
         .def_ro("total_computation_time", &PredicateStatistics::totalComputationTime)
         .def_ro("num_executions", &PredicateStatistics::numExecutions)
         .def_ro("num_satisfaction", &PredicateStatistics::numSatisfaction)
+        .def(
+            "computation_time_quantile",
+            [](const PredicateStatistics &statistics, double quantile) {
+                return statistics.computationTimeHistogram.getQuantile(quantile);
+            },
+            nb::arg("quantile"))
         .def("reset", &PredicateStatistics::reset);
 
     nb::class_<CommonRoadPredicate>(m, "CommonRoadPredicate")
@@ -50,6 +174,14 @@ void init_python_interface_predicates(nb::module_ &m) {
         .def("constraint_evaluation", &CommonRoadPredicate::constraintEvaluation, nb::arg("timeStep"), nb::arg("world"),
              nb::arg("obstacleK"), nb::arg("obstacleP"),
              nb::arg("additionalFunctionParameters") = std::vector<std::string>{"0.0"}, nb::arg("setBased") = false)
+        .def("boolean_evaluation_vectorized", &vectorizedBooleanEvaluation, nb::arg("world"), nb::arg("timeSteps"),
+             nb::arg("obstacleIdsK"), nb::arg("obstacleIdsP") = nb::none(),
+             nb::arg("additionalFunctionParameters") = std::vector<std::string>{"0.0"}, nb::arg("setBased") = false,
+             nb::arg("numThreads") = 1)
+        .def("robust_evaluation_vectorized", &vectorizedRobustEvaluation, nb::arg("world"), nb::arg("timeSteps"),
+             nb::arg("obstacleIdsK"), nb::arg("obstacleIdsP") = nb::none(),
+             nb::arg("additionalFunctionParameters") = std::vector<std::string>{"0.0"}, nb::arg("setBased") = false,
+             nb::arg("numThreads") = 1)
         .def_prop_ro("is_vehicle_dependent", &CommonRoadPredicate::isVehicleDependent);
 
     instantiate_predicates(m);
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 
 #include "commonroad_cpp/roadNetwork/intersection/crossing_group.h"
 #include "commonroad_cpp/roadNetwork/intersection/incoming_group.h"
@@ -27,6 +30,58 @@
 #include <spdlog/spdlog.h>
 namespace nb = nanobind;
 
+static_assert(sizeof(vertex) == 2 * sizeof(double), "Vertices must be layout-compatible with rows of NumPy arrays.");
+
+/**
+ * Converts Python 2D position. NumPy arrays are read in place.
+ *
+ * @param py_position Python array or sequence with x- and y-position.
+ * @return Position.
+ */
+static vertex extractPosition(nb::handle py_position) {
+    nb::ndarray<const double, nb::shape<2>, nb::device::cpu> position;
+    if (nb::try_cast(py_position, position))
+        return {position(0), position(1)};
+    return {nb::cast<double>(py_position[0]), nb::cast<double>(py_position[1])};
+}
+
+std::vector<vertex> TranslatePythonTypes::convertVertices(const VertexArray &vertices) {
+    std::vector<vertex> result(vertices.shape(0));
+    std::copy_n(vertices.data(), 2 * vertices.shape(0), reinterpret_cast<double *>(result.data()));
+    return result;
+}
+
+std::vector<vertex> TranslatePythonTypes::extractVertices(nb::handle py_vertices) {
+    VertexArray points;
+    if (nb::try_cast(py_vertices, points))
+        return convertVertices(points);
+    std::vector<vertex> vertices;
+    for (const auto &py_vertex : py_vertices)
+        vertices.push_back(extractPosition(py_vertex));
+    return vertices;
+}
+
+std::vector<std::shared_ptr<State>> TranslatePythonTypes::extractStates(const StateArray &states) {
+    std::vector<std::shared_ptr<State>> result;
+    result.reserve(states.shape(0));
+    for (size_t row{0}; row < states.shape(0); ++row) {
+        if (!std::isfinite(states(row, 0)) || states(row, 0) < 0 || std::floor(states(row, 0)) != states(row, 0))
+            throw std::invalid_argument("TranslatePythonTypes::extractStates: Invalid time step in row " +
+                                        std::to_string(row) + ".");
+        auto state{std::make_shared<State>()};
+        state->setTimeStep(static_cast<size_t>(states(row, 0)));
+        state->setXPosition(states(row, 1));
+        state->setYPosition(states(row, 2));
+        state->setGlobalOrientation(states(row, 3));
+        if (!std::isnan(states(row, 4)))
+            state->setVelocity(states(row, 4));
+        if (!std::isnan(states(row, 5)))
+            state->setAcceleration(states(row, 5));
+        result.push_back(state);
+    }
+    return result;
+}
+
 std::vector<std::shared_ptr<TrafficSign>>
 TranslatePythonTypes::convertTrafficSigns(const nb::handle &py_laneletNetwork) {
     std::vector<std::shared_ptr<TrafficSign>> trafficSignContainer;
@@ -126,19 +181,11 @@ TranslatePythonTypes::convertLanelets(const nb::handle &py_laneletNetwork,
     }
     arrayIndex = 0;
     for (nb::handle py_singleLanelet : py_lanelets) {
-        // add left vertices
-        auto leftVertices = nb::cast<std::vector<std::vector<double>>>(py_singleLanelet.attr("left_vertices"));
-        for (const auto &el : leftVertices) {
-            vertex newVertex{el.at(0), el.at(1)};
-            tempLaneletContainer[arrayIndex]->addLeftVertex(newVertex);
-        }
-        // add right vertices
-        auto py_rightVertices =
-            nb::cast<std::vector<std::vector<double>>>(nb::getattr(py_singleLanelet, "right_vertices"));
-        for (const auto &el : py_rightVertices) {
-            vertex newVertex{el.at(0), el.at(1)};
-            tempLaneletContainer[arrayIndex]->addRightVertex(newVertex);
-        }
+        // add left and right vertices
+        tempLaneletContainer[arrayIndex]->setLeftBorderVertices(
+            TranslatePythonTypes::extractVertices(py_singleLanelet.attr("left_vertices")));
+        tempLaneletContainer[arrayIndex]->setRightBorderVertices(
+            TranslatePythonTypes::extractVertices(py_singleLanelet.attr("right_vertices")));
         // add users one way
         const nb::set &py_laneletUserOneWay = nb::cast<nb::set>(py_singleLanelet.attr("user_one_way"));
         std::set<ObstacleType> usersOneWay;
@@ -392,11 +439,10 @@ std::shared_ptr<State> createInitialState(nb::handle py_singleObstacle) {
     // TODO add support for uncertain states
     std::shared_ptr<State> initialState = std::make_shared<State>();
 
-    auto xPos = nb::cast<std::vector<double>>(py_singleObstacle.attr("initial_state").attr("position"));
-    auto yPos = nb::cast<std::vector<double>>(py_singleObstacle.attr("initial_state").attr("position"));
+    const auto position{extractPosition(py_singleObstacle.attr("initial_state").attr("position"))};
     auto timeStep = nb::cast<size_t>(py_singleObstacle.attr("initial_state").attr("time_step"));
-    initialState->setXPosition(xPos.at(0));
-    initialState->setYPosition(yPos.at(1));
+    initialState->setXPosition(position.x);
+    initialState->setYPosition(position.y);
     initialState->setTimeStep(timeStep);
     initialState->setGlobalOrientation(nb::cast<double>(py_singleObstacle.attr("initial_state").attr("orientation")));
     if (nb::hasattr(py_singleObstacle.attr("initial_state"), "velocity"))
@@ -417,11 +463,7 @@ std::shared_ptr<Shape> extractOccupancyShape(nb::handle py_occupancyShape) {
         auto radius{nb::cast<double>(py_occupancyShape.attr("radius"))};
         return std::make_shared<Circle>(radius);
     } else if (commonroadShape.substr(commonroadShape.find_last_of('.') + 1) == "Polygon") {
-        auto verticesRaw = nb::cast<std::vector<std::vector<double>>>(py_occupancyShape.attr("vertices"));
-        std::vector<vertex> vertices;
-        for (const auto &el : verticesRaw)
-            vertices.push_back({el.at(0), el.at(1)});
-        return std::make_shared<Polygon>(vertices);
+        return std::make_shared<Polygon>(TranslatePythonTypes::extractVertices(py_occupancyShape.attr("vertices")));
     } else if (commonroadShape.substr(commonroadShape.find_last_of('.') + 1) == "ShapeGroup") {
         std::vector<std::shared_ptr<Shape>> shapes;
         for (const auto &shape : py_occupancyShape.attr("shapes"))
@@ -441,10 +483,7 @@ std::unique_ptr<Shape> extractObstacleShape(nb::handle py_obstacleShape) {
         auto radius{nb::cast<double>(py_obstacleShape.attr("radius"))};
         return std::make_unique<Circle>(radius);
     } else if (commonroadShape.substr(commonroadShape.find_last_of('.') + 1) == "Polygon") {
-        std::vector<vertex> vertices;
-        for (const auto &vertex : py_obstacleShape.attr("vertices"))
-            vertices.push_back({nb::cast<double>(vertex[0]), nb::cast<double>(vertex[1])});
-        return std::make_unique<Polygon>(vertices);
+        return std::make_unique<Polygon>(TranslatePythonTypes::extractVertices(py_obstacleShape.attr("vertices")));
     } else if (commonroadShape.substr(commonroadShape.find_last_of('.') + 1) == "ShapeGroup") {
         std::vector<std::shared_ptr<Shape>> shapes;
         for (const auto &shape : py_obstacleShape.attr("shapes"))
@@ -468,8 +507,9 @@ std::shared_ptr<Obstacle> createCommonObstaclePart(nb::handle py_singleObstacle)
 
 std::shared_ptr<State> TranslatePythonTypes::extractState(nb::handle py_state) {
     auto state{std::make_shared<State>()};
-    state->setXPosition(nb::cast<std::vector<double>>(py_state.attr("position")).at(0));
-    state->setYPosition(nb::cast<std::vector<double>>(py_state.attr("position")).at(1));
+    const auto position{extractPosition(py_state.attr("position"))};
+    state->setXPosition(position.x);
+    state->setYPosition(position.y);
     state->setGlobalOrientation(nb::cast<double>(py_state.attr("orientation")));
     if (nb::hasattr(py_state, "velocity"))
         state->setVelocity(nb::cast<double>(py_state.attr("velocity")));
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <vector>
 
 namespace nb = nanobind;
@@ -16,8 +18,45 @@ class TrafficLight;
 class Intersection;
 class StopLine;
 class TrafficLightCycleElement;
+struct vertex;
 
 namespace TranslatePythonTypes {
+
+/**
+ * Number of columns of state arrays passed from Python. The columns are the fields of the structured state arrays
+ * returned to Python, i.e., time step, x-position, y-position, orientation, velocity, and acceleration. Velocity and
+ * acceleration are NaN if they are not set.
+ */
+constexpr size_t numStateColumns{6};
+
+using StateArray = nb::ndarray<const double, nb::shape<-1, numStateColumns>, nb::c_contig, nb::device::cpu>;
+using VertexArray = nb::ndarray<const double, nb::shape<-1, 2>, nb::c_contig, nb::device::cpu>;
+
+/**
+ * Converts an array of 2D points to vertices with a single copy of the array data.
+ *
+ * @param vertices Array with one point per row.
+ * @return Vertices.
+ */
+std::vector<vertex> convertVertices(const VertexArray &vertices);
+
+/**
+ * Converts Python 2D points to vertices. NumPy arrays of shape (n, 2) are read in place, other sequences of points
+ * are converted point by point.
+ *
+ * @param py_vertices Python array or sequence of points.
+ * @return Vertices.
+ */
+std::vector<vertex> extractVertices(nb::handle py_vertices);
+
+/**
+ * Converts an array of states to C++ representation.
+ *
+ * @param states Array with one state per row, see numStateColumns.
+ * @return C++ states.
+ */
+std::vector<std::shared_ptr<State>> extractStates(const StateArray &states);
+
 /**
  * Converts Python lanelet objects to C++ representation.
  *
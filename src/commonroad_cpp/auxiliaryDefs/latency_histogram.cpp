@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <commonroad_cpp/auxiliaryDefs/latency_histogram.h>
+
+void LatencyHistogram::record(long nanoseconds) {
+    const auto value{static_cast<unsigned long>(std::max(nanoseconds, 0L))};
+    const size_t index{bucketIndex(value)};
+    if (index >= buckets.size())
+        buckets.resize(index + 1, 0);
+    buckets[index]++;
+    count++;
+    max = std::max(max, static_cast<long>(value));
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    if (other.buckets.size() > buckets.size())
+        buckets.resize(other.buckets.size(), 0);
+    for (size_t index{0}; index < other.buckets.size(); ++index)
+        buckets[index] += other.buckets[index];
+    count += other.count;
+    max = std::max(max, other.max);
+}
+
+long LatencyHistogram::getQuantile(double quantile) const {
+    if (quantile < 0.0 or quantile > 1.0)
+        throw std::invalid_argument("LatencyHistogram::getQuantile: Quantile " + std::to_string(quantile) +
+                                    " is not within [0, 1].");
+    if (count == 0)
+        return 0;
+    // rank of the value representing the quantile, starting at one
+    const auto rank{std::max(static_cast<size_t>(std::ceil(quantile * static_cast<double>(count))), size_t{1})};
+    size_t numValues{0};
+    for (size_t index{0}; index < buckets.size(); ++index) {
+        numValues += buckets[index];
+        if (numValues >= rank)
+            return std::min(static_cast<long>(bucketUpperBound(index)), max);
+    }
+    return max;
+}
+
+size_t LatencyHistogram::getCount() const { return count; }
+
+long LatencyHistogram::getMax() const { return max; }
+
+void LatencyHistogram::reset() {
+    buckets.clear();
+    count = 0;
+    max = 0;
+}
+
+size_t LatencyHistogram::bucketIndex(unsigned long value) {
+    // values below numSubBuckets have their own bucket
+    if (value < numSubBuckets)
+        return value;
+    size_t exponent{subBucketBits};
+    while ((value >> (exponent + 1)) != 0)
+        ++exponent;
+    const size_t shift{exponent - subBucketBits};
+    return (shift + 1) * numSubBuckets + ((value >> shift) & (numSubBuckets - 1));
+}
+
+unsigned long LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < numSubBuckets)
+        return index;
+    const size_t shift{index / numSubBuckets - 1};
+    const size_t subBucket{index % numSubBuckets};
+    return ((numSubBuckets + subBucket + 1) << shift) - 1;
+}
@@ -0,0 +1,136 @@
+#include <stdexcept>
+#include <utility>
+
+#include <commonroad_cpp/auxiliaryDefs/task_scheduler.h>
+
+namespace {
+thread_local const TaskScheduler *currentScheduler{nullptr}; // scheduler owning the current thread
+thread_local size_t currentWorker{0};                        // index of the current thread within its scheduler
+} // namespace
+
+TaskScheduler::TaskScheduler(size_t numThreads, bool recordTimings) : recordTimings(recordTimings) {
+    if (numThreads == 0)
+        throw std::invalid_argument("TaskScheduler: At least one worker thread is required.");
+    workers.reserve(numThreads);
+    for (size_t index{0}; index < numThreads; ++index)
+        workers.push_back(std::make_unique<Worker>());
+    // threads are started after all workers exist since workers access the queues of each other
+    for (size_t index{0}; index < numThreads; ++index)
+        workers[index]->thread = std::thread{&TaskScheduler::run, this, index};
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::unique_lock lock{idleMutex};
+        tasksFinished.wait(lock, [this] { return numPendingTasks == 0; });
+        stopped = true;
+    }
+    workAvailable.notify_all();
+    for (auto &worker : workers)
+        worker->thread.join();
+}
+
+void TaskScheduler::submit(Task task, std::string label) {
+    const size_t index{currentScheduler == this ? currentWorker : nextWorker++ % workers.size()};
+    ++numPendingTasks;
+    // the counter is incremented first so that it cannot underflow if the task is taken immediately
+    {
+        std::lock_guard lock{idleMutex};
+        ++numQueuedTasks;
+    }
+    {
+        std::lock_guard lock{workers[index]->mutex};
+        workers[index]->queue.push_back(Entry{std::move(task), std::move(label)});
+    }
+    workAvailable.notify_one();
+}
+
+void TaskScheduler::wait() {
+    std::unique_lock lock{idleMutex};
+    tasksFinished.wait(lock, [this] { return numPendingTasks == 0; });
+    if (exception)
+        std::rethrow_exception(std::exchange(exception, nullptr));
+}
+
+size_t TaskScheduler::getNumThreads() const { return workers.size(); }
+
+std::vector<TaskScheduler::TaskTiming> TaskScheduler::getTaskTimings() const {
+    std::vector<TaskTiming> timings;
+    for (const auto &worker : workers)
+        timings.insert(timings.end(), worker->timings.begin(), worker->timings.end());
+    return timings;
+}
+
+std::vector<TaskScheduler::WorkerStatistics> TaskScheduler::getWorkerStatistics() const {
+    std::vector<WorkerStatistics> statistics;
+    statistics.reserve(workers.size());
+    for (const auto &worker : workers) {
+        statistics.push_back(worker->statistics);
+        statistics.back().busyTime = worker->timer.getTotalTime();
+    }
+    return statistics;
+}
+
+void TaskScheduler::run(size_t index) {
+    currentScheduler = this;
+    currentWorker = index;
+    Entry entry;
+    while (true) {
+        if (pop(index, entry) or steal(index, entry)) {
+            execute(index, entry);
+            continue;
+        }
+        std::unique_lock lock{idleMutex};
+        workAvailable.wait(lock, [this] { return stopped or numQueuedTasks > 0; });
+        if (stopped and numQueuedTasks == 0)
+            return;
+    }
+}
+
+bool TaskScheduler::pop(size_t index, Entry &entry) {
+    auto &worker{*workers[index]};
+    std::lock_guard lock{worker.mutex};
+    if (worker.queue.empty())
+        return false;
+    entry = std::move(worker.queue.back());
+    worker.queue.pop_back();
+    --numQueuedTasks;
+    return true;
+}
+
+bool TaskScheduler::steal(size_t index, Entry &entry) {
+    for (size_t offset{1}; offset < workers.size(); ++offset) {
+        auto &victim{*workers[(index + offset) % workers.size()]};
+        std::lock_guard lock{victim.mutex};
+        if (victim.queue.empty())
+            continue;
+        entry = std::move(victim.queue.front());
+        victim.queue.pop_front();
+        --numQueuedTasks;
+        workers[index]->statistics.numStolenTasks++;
+        return true;
+    }
+    return false;
+}
+
+void TaskScheduler::execute(size_t index, Entry &entry) {
+    auto &worker{*workers[index]};
+    const auto startTime{Timer::start()};
+    try {
+        entry.task();
+    } catch (...) {
+        std::lock_guard lock{idleMutex};
+        if (!exception)
+            exception = std::current_exception();
+    }
+    // captured objects are released before the task is reported as finished
+    entry.task = nullptr;
+    const auto duration{worker.timer.stop(startTime)};
+    if (recordTimings)
+        worker.timings.push_back(TaskTiming{std::move(entry.label), index, duration});
+    worker.statistics.numExecutedTasks++;
+    if (--numPendingTasks == 0) {
+        std::lock_guard lock{idleMutex};
+        tasksFinished.notify_all();
+    }
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
+
+using namespace std::chrono;
+
+namespace {
+
+/**
+ * Spans recorded by a thread.
+ */
+struct ThreadBuffer {
+    size_t thread;                  //**< index of thread */
+    std::vector<TraceEvent> events; //**< recorded spans */
+};
+
+/**
+ * Buffers of all threads and interned names. Constructed on first use and never destroyed, so that spans can be
+ * recorded during static destruction.
+ */
+struct TraceState {
+    const high_resolution_clock::time_point epoch{high_resolution_clock::now()}; //**< reference for start times */
+    std::mutex mutex; //**< mutex protecting the registration of threads and interned names */
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers; //**< buffers of registered threads */
+    std::unordered_set<std::string> names;              //**< interned names */
+};
+
+TraceState &getState() {
+    static auto *state{new TraceState};
+    return *state;
+}
+
+ThreadBuffer &getThreadBuffer() {
+    thread_local ThreadBuffer *buffer{nullptr};
+    if (buffer == nullptr) {
+        auto &state{getState()};
+        std::lock_guard lock{state.mutex};
+        state.buffers.push_back(std::make_unique<ThreadBuffer>(ThreadBuffer{state.buffers.size(), {}}));
+        buffer = state.buffers.back().get();
+    }
+    return *buffer;
+}
+
+std::string escapeJson(const char *value) {
+    std::string escaped;
+    for (; *value != '\0'; ++value) {
+        if (*value == '"' or *value == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(*value);
+        } else if (static_cast<unsigned char>(*value) < 0x20) {
+            char code[7];
+            std::snprintf(code, sizeof(code), "\\u%04x", *value);
+            escaped.append(code);
+        } else
+            escaped.push_back(*value);
+    }
+    return escaped;
+}
+
+} // namespace
+
+void TraceRecorder::enable() {
+    getState(); // the epoch is set before the first span
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::disable() { enabled.store(false, std::memory_order_relaxed); }
+
+void TraceRecorder::record(const char *name, const char *category, const high_resolution_clock::time_point startTime,
+                           const long duration) {
+    auto &buffer{getThreadBuffer()};
+    buffer.events.push_back(
+        {name, category, duration_cast<nanoseconds>(startTime - getState().epoch).count(), duration, buffer.thread});
+}
+
+const char *TraceRecorder::internName(const std::string_view name) {
+    auto &state{getState()};
+    std::lock_guard lock{state.mutex};
+    return state.names.emplace(name).first->c_str();
+}
+
+std::vector<TraceEvent> TraceRecorder::getEvents() {
+    auto &state{getState()};
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard lock{state.mutex};
+        for (const auto &buffer : state.buffers)
+            events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+    }
+    // enclosing spans are placed before the spans they contain
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent &first, const TraceEvent &second) {
+        return first.start < second.start or (first.start == second.start and first.duration > second.duration);
+    });
+    return events;
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream &stream) {
+    stream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool firstEvent{true};
+    for (const auto &event : getEvents()) {
+        stream << (firstEvent ? "\n" : ",\n") << "  {\"name\": \"" << escapeJson(event.name) << "\", \"cat\": \""
+               << escapeJson(event.category) << "\", \"ph\": \"X\", \"ts\": " << std::to_string(event.start / 1e3)
+               << ", \"dur\": " << std::to_string(event.duration / 1e3) << ", \"pid\": 1, \"tid\": " << event.thread
+               << "}";
+        firstEvent = false;
+    }
+    stream << "\n]}\n";
+}
+
+void TraceRecorder::writeChromeTrace(const std::string &filePath) {
+    std::ofstream file{filePath};
+    if (!file)
+        throw std::runtime_error("TraceRecorder::writeChromeTrace: Cannot open file " + filePath);
+    writeChromeTrace(file);
+}
+
+void TraceRecorder::reset() {
+    auto &state{getState()};
+    std::lock_guard lock{state.mutex};
+    for (const auto &buffer : state.buffers)
+        buffer->events.clear();
+}
@@ -13,3 +13,5 @@ double Circle::getCircumradius() const { return radius; }
 void Circle::scaleShape(double factor) { this->setRadius(this->getRadius() * factor); }
 
 ShapeType Circle::getType() { return ShapeType::circle; }
+
+std::unique_ptr<Shape> Circle::clone() const { return std::make_unique<Circle>(*this); }
@@ -3,6 +3,7 @@
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <cmath>
+#include <stdexcept>
 #include <commonroad_cpp/geometry/types.h>
 #include <geometry/curvilinear_coordinate_system.h>
 
@@ -316,3 +317,28 @@ bool geometric_operations::is180Deg(const double degree1, const double degree2)
            (std::abs(std::abs(degree1) - std::abs(degree2)) >= -5 &&
             std::abs(std::abs(degree1) - std::abs(degree2)) <= 5);
 }
+
+std::vector<vertex> geometric_operations::convertPointsToCurvilinear(const CurvilinearCoordinateSystem &ccs,
+                                                                     const std::vector<vertex> &points) {
+    if (points.empty())
+        return {};
+    // the batch projection does not pay off for a single point
+    if (points.size() == 1) {
+        const auto convertedPoint{ccs.convertToCurvilinearCoords(points.front().x, points.front().y)};
+        return {{convertedPoint.x(), convertedPoint.y()}};
+    }
+    geometry::EigenPolyline cartesianPoints;
+    cartesianPoints.reserve(points.size());
+    for (const auto &point : points)
+        cartesianPoints.emplace_back(point.x, point.y);
+    // points outside of the projection domain are omitted by the batch projection
+    const auto convertedPoints{ccs.convertListOfPointsToCurvilinearCoords(cartesianPoints, 1)};
+    if (convertedPoints.size() != points.size())
+        throw std::invalid_argument(
+            "geometric_operations::convertPointsToCurvilinear: Coordinate outside of projection domain.");
+    std::vector<vertex> curvilinearPoints;
+    curvilinearPoints.reserve(convertedPoints.size());
+    for (const auto &point : convertedPoints)
+        curvilinearPoints.push_back({point.x(), point.y()});
+    return curvilinearPoints;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <commonroad_cpp/geometry/oriented_bounding_box.h>
+
+namespace {
+
+/**
+ * Normalizes a direction.
+ *
+ * @param direction Direction.
+ * @param normalized Unit direction; unchanged if the direction has zero length.
+ * @return Boolean indicating whether direction has non-zero length.
+ */
+bool normalize(const vertex &direction, vertex &normalized) {
+    const double length{std::hypot(direction.x, direction.y)};
+    if (length == 0.0)
+        return false;
+    normalized = direction / length;
+    return true;
+}
+
+} // namespace
+
+OrientedBoundingBox::OrientedBoundingBox(const std::array<vertex, 4> &corners) : corners(corners) {
+    // degenerate boxes keep the default axes or the axis perpendicular to the non-degenerate edge
+    const bool lengthAxis{normalize(corners[1] - corners[0], axes[0])};
+    if (normalize(corners[2] - corners[1], axes[1])) {
+        if (!lengthAxis)
+            axes[0] = vertex{axes[1].y, -axes[1].x};
+    } else if (lengthAxis)
+        axes[1] = vertex{-axes[0].y, axes[0].x};
+    for (size_t idx{0}; idx < axes.size(); ++idx)
+        extents[idx] = project(axes[idx]);
+}
+
+OrientedBoundingBox OrientedBoundingBox::fromRectangle(const polygon_type &polygon) {
+    if (polygon.outer().size() < 4)
+        throw std::invalid_argument("OrientedBoundingBox::fromRectangle: Polygon has less than four vertices.");
+    std::array<vertex, 4> corners;
+    for (size_t idx{0}; idx < corners.size(); ++idx)
+        corners[idx] = vertex{polygon.outer()[idx].x(), polygon.outer()[idx].y()};
+    return OrientedBoundingBox{corners};
+}
+
+const std::array<vertex, 4> &OrientedBoundingBox::getCorners() const { return corners; }
+
+vertex OrientedBoundingBox::getCenter() const { return (corners[0] + corners[2]) * 0.5; }
+
+box OrientedBoundingBox::getAxisAlignedBoundingBox() const {
+    const auto [minX, maxX]{std::minmax({corners[0].x, corners[1].x, corners[2].x, corners[3].x})};
+    const auto [minY, maxY]{std::minmax({corners[0].y, corners[1].y, corners[2].y, corners[3].y})};
+    return box{point_type{minX, minY}, point_type{maxX, maxY}};
+}
+
+bool OrientedBoundingBox::intersects(const OrientedBoundingBox &other) const {
+    for (size_t idx{0}; idx < axes.size(); ++idx) {
+        const auto otherExtent{other.project(axes[idx])};
+        if (otherExtent[0] > extents[idx][1] or extents[idx][0] > otherExtent[1])
+            return false;
+        const auto extent{project(other.axes[idx])};
+        if (extent[0] > other.extents[idx][1] or other.extents[idx][0] > extent[1])
+            return false;
+    }
+    return true;
+}
+
+double OrientedBoundingBox::separation(const std::vector<vertex> &polygon) const {
+    const auto projectPolygon{[&polygon](const vertex &axis) {
+        std::array<double, 2> extent{std::numeric_limits<double>::infinity(),
+                                     -std::numeric_limits<double>::infinity()};
+        for (const auto &vert : polygon) {
+            const double projection{vert.x * axis.x + vert.y * axis.y};
+            extent[0] = std::min(extent[0], projection);
+            extent[1] = std::max(extent[1], projection);
+        }
+        return extent;
+    }};
+
+    double gap{-std::numeric_limits<double>::infinity()};
+    for (size_t idx{0}; idx < axes.size(); ++idx) {
+        const auto polygonExtent{projectPolygon(axes[idx])};
+        gap = std::max({gap, polygonExtent[0] - extents[idx][1], extents[idx][0] - polygonExtent[1]});
+    }
+    for (size_t idx{0}; idx < polygon.size(); ++idx) {
+        const auto &edgeStart{polygon[idx]};
+        const auto &edgeEnd{polygon[(idx + 1) % polygon.size()]};
+        vertex normal;
+        if (!normalize(vertex{edgeEnd.y - edgeStart.y, edgeStart.x - edgeEnd.x}, normal))
+            continue;
+        const auto polygonExtent{projectPolygon(normal)};
+        const auto extent{project(normal)};
+        gap = std::max({gap, polygonExtent[0] - extent[1], extent[0] - polygonExtent[1]});
+    }
+    return gap;
+}
+
+std::array<double, 2> OrientedBoundingBox::project(const vertex &axis) const {
+    std::array<double, 2> extent{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+    for (const auto &corner : corners) {
+        const double projection{corner.x * axis.x + corner.y * axis.y};
+        extent[0] = std::min(extent[0], projection);
+        extent[1] = std::max(extent[1], projection);
+    }
+    return extent;
+}
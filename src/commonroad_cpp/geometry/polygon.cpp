@@ -10,6 +10,8 @@ void Polygon::printParameters() {
 
 ShapeType Polygon::getType() { return ShapeType::polygon; }
 
+std::unique_ptr<Shape> Polygon::clone() const { return std::make_unique<Polygon>(*this); }
+
 Polygon::Polygon(const std::vector<vertex> &pol) {
     this->polygon.outer().resize(pol.size());
     size_t idx{0};
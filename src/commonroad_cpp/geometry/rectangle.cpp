@@ -27,3 +27,5 @@ void Rectangle::printParameters() {
 }
 
 ShapeType Rectangle::getType() { return ShapeType::rectangle; }
+
+std::unique_ptr<Shape> Rectangle::clone() const { return std::make_unique<Rectangle>(*this); }
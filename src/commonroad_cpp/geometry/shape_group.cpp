@@ -10,6 +10,8 @@ void ShapeGroup::printParameters() {
 
 ShapeType ShapeGroup::getType() { return ShapeType::shapeGroup; }
 
+std::unique_ptr<Shape> ShapeGroup::clone() const { return std::make_unique<ShapeGroup>(*this); }
+
 std::vector<std::shared_ptr<Shape>> &ShapeGroup::getShapes() { return shapeGroup; }
 
 void ShapeGroup::addShape(const std::shared_ptr<Shape> &shape) { shapeGroup.push_back(shape); };
@@ -1,4 +1,6 @@
 #include <boost/algorithm/string.hpp>
+#include <commonroad_cpp/auxiliaryDefs/task_scheduler.h>
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/interfaces/commonroad/input_utils.h>
 #include <commonroad_cpp/interfaces/commonroad/protobuf_reader.h>
 #include <commonroad_cpp/interfaces/commonroad/xml_reader.h>
@@ -6,40 +8,12 @@
 #include <commonroad_cpp/roadNetwork/intersection/intersection.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lanelet.h>
 #include <commonroad_cpp/roadNetwork/road_network.h>
+#include <algorithm>
 #include <filesystem>
 #include <spdlog/spdlog.h>
 
 namespace {
 
-/**
- * Reads CR scenario from file in xml format.
- *
- * @param xmlFilePath File path
- * @return Scenario
- */
-Scenario readFromXMLFile(const std::string &xmlFilePath) {
-    std::vector<std::shared_ptr<TrafficSign>> trafficSigns = XMLReader::createTrafficSignFromXML(xmlFilePath);
-    std::vector<std::shared_ptr<TrafficLight>> trafficLights = XMLReader::createTrafficLightFromXML(xmlFilePath);
-    std::vector<std::shared_ptr<Lanelet>> lanelets =
-        XMLReader::createLaneletFromXML(xmlFilePath, trafficSigns, trafficLights);
-    std::vector<std::shared_ptr<Obstacle>> obstacles = XMLReader::createObstacleFromXML(xmlFilePath);
-    std::vector<std::shared_ptr<Intersection>> intersections =
-        XMLReader::createIntersectionFromXML(xmlFilePath, lanelets);
-    auto country{XMLReader::extractCountryFromXML(xmlFilePath)};
-
-    std::shared_ptr<RoadNetwork> roadNetwork{
-        std::make_shared<RoadNetwork>(RoadNetwork(lanelets, country, trafficSigns, trafficLights, intersections))};
-    for (const auto &inter : roadNetwork->getIntersections())
-        inter->computeMemberLanelets(roadNetwork);
-
-    auto timeStepSize{XMLReader::extractTimeStepSize(xmlFilePath)};
-
-    std::vector<std::shared_ptr<PlanningProblem>> planningProblems{
-        XMLReader::createPlanningProblemFromXML(xmlFilePath)};
-
-    return Scenario{obstacles, roadNetwork, timeStepSize, planningProblems};
-}
-
 /**
  * Reads CR scenario from file in protobuf format.
  *
@@ -47,13 +21,10 @@ Scenario readFromXMLFile(const std::string &xmlFilePath) {
  * @return Scenario
  */
 Scenario readFromProtobufFile(const std::string &pbFilePath) {
-    commonroad_dynamic::CommonRoadDynamic commonRoadDynamicMsg;
-    commonroad_map::CommonRoadMap commonRoadMapMsg;
-    commonroad_scenario::CommonRoadScenario commonRoadScenarioMsg;
+    ProtobufReader::ScenarioFiles files;
     std::vector<std::string> dirSplit;
     boost::split(dirSplit, pbFilePath, boost::is_any_of("/"));
     std::string dir;
-    int fileGiven{0};
     for (size_t idx{0}; idx < dirSplit.size() - 1; ++idx)
         dir += dirSplit[idx] + "/";
     std::string name;
@@ -64,32 +35,28 @@ Scenario readFromProtobufFile(const std::string &pbFilePath) {
     for (const auto &entry : std::filesystem::directory_iterator(dir)) {
         std::vector<std::string> pathSplit;
         boost::split(pathSplit, entry.path().string(), boost::is_any_of("/"));
-        if (std::count(pathSplit.back().begin(), pathSplit.back().end(), '_') == 1) {
-            fileGiven = fileGiven | 1;
-            commonRoadMapMsg = ProtobufReader::loadMapProtobufMessage(entry.path().string());
-        } else if (pathSplit.back().find("SC") != std::string::npos and
-                   pathSplit.back().find(name) != std::string::npos) {
-            fileGiven = fileGiven | 4;
-            commonRoadScenarioMsg = ProtobufReader::loadScenarioProtobufMessage(entry.path().string());
-        } else if (pathSplit.back().find(name) != std::string::npos) {
-            commonRoadDynamicMsg = ProtobufReader::loadDynamicProtobufMessage(entry.path().string());
-            fileGiven = fileGiven | 2;
-        }
+        if (std::count(pathSplit.back().begin(), pathSplit.back().end(), '_') == 1)
+            files.mapFile = entry.path().string();
+        else if (pathSplit.back().find("SC") != std::string::npos and
+                 pathSplit.back().find(name) != std::string::npos)
+            files.scenarioFile = entry.path().string();
+        else if (pathSplit.back().find(name) != std::string::npos)
+            files.dynamicFile = entry.path().string();
     }
 
-    return ProtobufReader::createCommonRoadFromMessage(commonRoadDynamicMsg, commonRoadMapMsg, commonRoadScenarioMsg,
-                                                       fileGiven);
+    return ProtobufReader::createCommonRoadFromFiles(files);
 }
 
 } // namespace
 
 Scenario InputUtils::getDataFromCommonRoad(const std::string &path) {
+    ENV_MODEL_TRACE_SPAN("InputUtils::getDataFromCommonRoad", "input");
     spdlog::debug("Read file: {}", path);
     std::vector<std::string> fileEndingSplit;
     boost::split(fileEndingSplit, path, boost::is_any_of("."));
     Scenario scenario;
     if (fileEndingSplit.back() == "xml")
-        scenario = readFromXMLFile(path);
+        scenario = XMLReader::createScenarioFromXML(path);
     else if (fileEndingSplit.back() == "pb")
         scenario = readFromProtobufFile(path);
     else
@@ -98,3 +65,26 @@ Scenario InputUtils::getDataFromCommonRoad(const std::string &path) {
     spdlog::debug("File successfully read: {}", path);
     return scenario;
 }
+
+std::vector<Scenario> InputUtils::getDataFromCommonRoadFiles(const std::vector<std::string> &paths,
+                                                             size_t numThreads) {
+    std::vector<Scenario> scenarios(paths.size());
+    TaskScheduler scheduler{std::max(std::min(numThreads, paths.size()), size_t{1})};
+    for (size_t idx{0}; idx < paths.size(); ++idx)
+        scheduler.submit([&scenarios, &paths, idx]() { scenarios[idx] = getDataFromCommonRoad(paths[idx]); },
+                         paths[idx]);
+    scheduler.wait();
+    return scenarios;
+}
+
+std::vector<Scenario> InputUtils::getDataFromProtobufFiles(const std::vector<ProtobufReader::ScenarioFiles> &files,
+                                                           size_t numThreads) {
+    std::vector<Scenario> scenarios(files.size());
+    TaskScheduler scheduler{std::max(std::min(numThreads, files.size()), size_t{1})};
+    for (size_t idx{0}; idx < files.size(); ++idx)
+        scheduler.submit(
+            [&scenarios, &files, idx]() { scenarios[idx] = ProtobufReader::createCommonRoadFromFiles(files[idx]); },
+            files[idx].dynamicFile.empty() ? files[idx].mapFile : files[idx].dynamicFile);
+    scheduler.wait();
+    return scenarios;
+}
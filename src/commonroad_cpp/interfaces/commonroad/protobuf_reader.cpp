@@ -16,51 +16,75 @@
 #include <stdexcept>
 #include <utility>
 
-commonroad_dynamic::CommonRoadDynamic ProtobufReader::loadDynamicProtobufMessage(const std::string &filePath) {
+namespace {
+
+/**
+ * Parses a protobuf message from a file. The file is read at once so that the message is parsed from a single buffer.
+ *
+ * @param filePath File path
+ * @param message Message to fill
+ */
+void parseProtobufFile(const std::string &filePath, google::protobuf::MessageLite &message) {
     std::ifstream pbFile(filePath, std::ios::binary | std::ios::ate);
-    std::streamsize size = pbFile.tellg();
+    if (!pbFile)
+        throw std::runtime_error("ProtobufReader: Cannot open file " + filePath + ".");
+    const std::streamsize size{pbFile.tellg()};
     pbFile.seekg(0, std::ios::beg);
 
-    std::vector<char> buffer((size_t)size);
-    pbFile.read(buffer.data(), size);
+    std::string buffer(static_cast<size_t>(size), '\0');
+    if (!pbFile.read(buffer.data(), size) or !message.ParseFromArray(buffer.data(), static_cast<int>(size)))
+        throw std::runtime_error("ProtobufReader: Cannot parse file " + filePath + ".");
+}
 
-    std::string commonRoadStr(buffer.begin(), buffer.end());
+/**
+ * Matches protobuf line marking to line marking.
+ *
+ * @param lineMarkingMsg Protobuf line marking
+ * @return Line marking
+ */
+LineMarking matchLineMarking(commonroad_map::LineMarkingEnum_LineMarking lineMarkingMsg) {
+    return lanelet_operations::matchStringToLineMarking(
+        boost::algorithm::to_lower_copy(commonroad_map::LineMarkingEnum_LineMarking_Name(lineMarkingMsg)));
+}
 
-    commonroad_dynamic::CommonRoadDynamic commonRoadMsg = commonroad_dynamic::CommonRoadDynamic();
-    commonRoadMsg.ParseFromString(commonRoadStr);
+} // namespace
 
+commonroad_dynamic::CommonRoadDynamic ProtobufReader::loadDynamicProtobufMessage(const std::string &filePath) {
+    commonroad_dynamic::CommonRoadDynamic commonRoadMsg;
+    parseProtobufFile(filePath, commonRoadMsg);
     return commonRoadMsg;
 }
 
 commonroad_map::CommonRoadMap ProtobufReader::loadMapProtobufMessage(const std::string &filePath) {
-    std::ifstream pbFile(filePath, std::ios::binary | std::ios::ate);
-    std::streamsize size = pbFile.tellg();
-    pbFile.seekg(0, std::ios::beg);
-
-    std::vector<char> buffer((size_t)size);
-    pbFile.read(buffer.data(), size);
-
-    std::string commonRoadStr(buffer.begin(), buffer.end());
-
-    commonroad_map::CommonRoadMap commonRoadMsg = commonroad_map::CommonRoadMap();
-    commonRoadMsg.ParseFromString(commonRoadStr);
-
+    commonroad_map::CommonRoadMap commonRoadMsg;
+    parseProtobufFile(filePath, commonRoadMsg);
     return commonRoadMsg;
 }
 
 commonroad_scenario::CommonRoadScenario ProtobufReader::loadScenarioProtobufMessage(const std::string &filePath) {
-    std::ifstream pbFile(filePath, std::ios::binary | std::ios::ate);
-    std::streamsize size = pbFile.tellg();
-    pbFile.seekg(0, std::ios::beg);
-
-    std::vector<char> buffer((size_t)size);
-    pbFile.read(buffer.data(), size);
+    commonroad_scenario::CommonRoadScenario commonRoadMsg;
+    parseProtobufFile(filePath, commonRoadMsg);
+    return commonRoadMsg;
+}
 
-    std::string commonRoadStr(buffer.begin(), buffer.end());
+commonroad_dynamic::CommonRoadDynamic *ProtobufReader::loadDynamicProtobufMessage(const std::string &filePath,
+                                                                                  google::protobuf::Arena &arena) {
+    auto *commonRoadMsg{google::protobuf::Arena::CreateMessage<commonroad_dynamic::CommonRoadDynamic>(&arena)};
+    parseProtobufFile(filePath, *commonRoadMsg);
+    return commonRoadMsg;
+}
 
-    commonroad_scenario::CommonRoadScenario commonRoadMsg = commonroad_scenario::CommonRoadScenario();
-    commonRoadMsg.ParseFromString(commonRoadStr);
+commonroad_map::CommonRoadMap *ProtobufReader::loadMapProtobufMessage(const std::string &filePath,
+                                                                      google::protobuf::Arena &arena) {
+    auto *commonRoadMsg{google::protobuf::Arena::CreateMessage<commonroad_map::CommonRoadMap>(&arena)};
+    parseProtobufFile(filePath, *commonRoadMsg);
+    return commonRoadMsg;
+}
 
+commonroad_scenario::CommonRoadScenario *
+ProtobufReader::loadScenarioProtobufMessage(const std::string &filePath, google::protobuf::Arena &arena) {
+    auto *commonRoadMsg{google::protobuf::Arena::CreateMessage<commonroad_scenario::CommonRoadScenario>(&arena)};
+    parseProtobufFile(filePath, *commonRoadMsg);
     return commonRoadMsg;
 }
 
@@ -101,6 +125,18 @@ void ProtobufReader::initCrossingGroupContainer(CrossingGroupContainer &crossing
         crossingGroupContainer.emplace(crossingGroupMsg.crossing_group_id(), std::make_shared<CrossingGroup>());
 }
 
+void ProtobufReader::initBoundaryMessageContainer(BoundaryMessageContainer &boundaryContainer,
+                                                  const commonroad_map::CommonRoadMap &commonRoadMapMsg) {
+    for (const auto &boundMsg : commonRoadMapMsg.boundaries())
+        boundaryContainer.emplace(static_cast<size_t>(boundMsg.boundary_id()), &boundMsg);
+}
+
+void ProtobufReader::initStopLineMessageContainer(StopLineMessageContainer &stopLineContainer,
+                                                  const commonroad_map::CommonRoadMap &commonRoadMapMsg) {
+    for (const auto &stopLineMsg : commonRoadMapMsg.stop_lines())
+        stopLineContainer.emplace(stopLineMsg.stop_line_id(), &stopLineMsg);
+}
+
 std::shared_ptr<Lanelet> ProtobufReader::getLaneletFromContainer(size_t laneletId,
                                                                  ProtobufReader::LaneletContainer &laneletContainer) {
     if (laneletContainer.find(laneletId) != laneletContainer.end())
@@ -173,14 +209,18 @@ ProtobufReader::createCommonRoadFromMessage(const commonroad_dynamic::CommonRoad
     TrafficLightContainer trafficLightContainer;
     initTrafficLightContainer(trafficLightContainer, commonRoadMapMsg);
 
-    std::vector<std::shared_ptr<Bound>> boundaries;
-    for (const auto &boundMsg : commonRoadMapMsg.boundaries())
-        boundaries.push_back(ProtobufReader::createBoundFromMessage(boundMsg));
+    BoundaryMessageContainer boundaryContainer;
+    initBoundaryMessageContainer(boundaryContainer, commonRoadMapMsg);
+
+    StopLineMessageContainer stopLineContainer;
+    initStopLineMessageContainer(stopLineContainer, commonRoadMapMsg);
 
     std::vector<std::shared_ptr<Lanelet>> lanelets;
+    lanelets.reserve(static_cast<size_t>(commonRoadMapMsg.lanelets_size()));
     for (const auto &laneletMsg : commonRoadMapMsg.lanelets())
-        lanelets.push_back(ProtobufReader::createLaneletFromMessage(
-            laneletMsg, laneletContainer, trafficSignContainer, trafficLightContainer, boundaries, commonRoadMapMsg));
+        lanelets.push_back(ProtobufReader::createLaneletFromMessage(laneletMsg, laneletContainer,
+                                                                    trafficSignContainer, trafficLightContainer,
+                                                                    boundaryContainer, stopLineContainer));
 
     std::vector<std::shared_ptr<TrafficSign>> trafficSigns;
     for (const auto &trafficSignMsg : commonRoadMapMsg.traffic_signs())
@@ -228,6 +268,29 @@ ProtobufReader::createCommonRoadFromMessage(const commonroad_dynamic::CommonRoad
     return Scenario{obstacles, roadNetwork, timeStepSize, planningProblems};
 }
 
+Scenario ProtobufReader::createCommonRoadFromFiles(const ScenarioFiles &files) {
+    google::protobuf::Arena arena;
+    int fileGiven{0};
+    const commonroad_map::CommonRoadMap *commonRoadMapMsg{&commonroad_map::CommonRoadMap::default_instance()};
+    if (!files.mapFile.empty()) {
+        commonRoadMapMsg = loadMapProtobufMessage(files.mapFile, arena);
+        fileGiven = fileGiven | 1;
+    }
+    const commonroad_dynamic::CommonRoadDynamic *commonRoadDynamicMsg{
+        &commonroad_dynamic::CommonRoadDynamic::default_instance()};
+    if (!files.dynamicFile.empty()) {
+        commonRoadDynamicMsg = loadDynamicProtobufMessage(files.dynamicFile, arena);
+        fileGiven = fileGiven | 2;
+    }
+    const commonroad_scenario::CommonRoadScenario *commonRoadScenarioMsg{
+        &commonroad_scenario::CommonRoadScenario::default_instance()};
+    if (!files.scenarioFile.empty()) {
+        commonRoadScenarioMsg = loadScenarioProtobufMessage(files.scenarioFile, arena);
+        fileGiven = fileGiven | 4;
+    }
+    return createCommonRoadFromMessage(*commonRoadDynamicMsg, *commonRoadMapMsg, *commonRoadScenarioMsg, fileGiven);
+}
+
 std::tuple<std::string, double> ProtobufReader::createScenarioMetaInformationFromMessage(
     const commonroad_common::ScenarioMetaInformation &scenarioMetaInformationMsg) {
     std::string benchmarkId = createScenarioIDFromMessage(scenarioMetaInformationMsg.benchmark_id());
@@ -252,50 +315,15 @@ std::string ProtobufReader::createMapIDFromMessage(const commonroad_common::MapI
 std::shared_ptr<Lanelet> ProtobufReader::createLaneletFromMessage(
     const commonroad_map::Lanelet &laneletMsg, LaneletContainer &laneletContainer,
     TrafficSignContainer &trafficSignContainer, TrafficLightContainer &trafficLightContainer,
-    const std::vector<std::shared_ptr<Bound>> &boundaries, const commonroad_map::CommonRoadMap &commonRoadMapMsg) {
+    const BoundaryMessageContainer &boundaryContainer, const StopLineMessageContainer &stopLineContainer) {
     std::shared_ptr<Lanelet> lanelet = laneletContainer[laneletMsg.lanelet_id()];
 
-    lanelet->setId(laneletMsg.lanelet_id());
-
-    int bordersFound = 0;
-    for (const auto &bound : boundaries) {
-        if (bound->getBoundaryId() == (size_t)laneletMsg.left_bound()) {
-            lanelet->setLeftBorderVertices(bound->getVertices());
-            lanelet->setLineMarkingLeft(bound->getLineMarking());
-            bordersFound++;
-        }
-        if (bound->getBoundaryId() == (size_t)laneletMsg.right_bound()) {
-            lanelet->setRightBorderVertices(bound->getVertices());
-            lanelet->setLineMarkingRight(bound->getLineMarking());
-            bordersFound++;
-        }
-        if (bordersFound == 2) {
-            for (size_t vertex_i = 0; vertex_i < lanelet->getLeftBorderVertices().size(); vertex_i++)
-                lanelet->addCenterVertex(
-                    (lanelet->getLeftBorderVertices()[vertex_i] + lanelet->getRightBorderVertices()[vertex_i]) / 2.);
-            break;
-        }
-    }
-
-    for (size_t laneletId : laneletMsg.successors()) {
-        auto containerLanelet = getLaneletFromContainer(laneletId, laneletContainer);
-        if (containerLanelet != nullptr)
-            lanelet->addSuccessor(getLaneletFromContainer(laneletId, laneletContainer));
-    }
-
-    for (size_t laneletId : laneletMsg.predecessors()) {
-        auto containerLanelet = getLaneletFromContainer(laneletId, laneletContainer);
-        if (containerLanelet != nullptr)
-            lanelet->addPredecessor(containerLanelet);
-    }
-
     std::set<LaneletType> laneletTypes;
     for (const auto &laneletType : laneletMsg.lanelet_types()) {
         std::string laneletTypeName =
             commonroad_map::LaneletTypeEnum_LaneletType_Name((commonroad_map::LaneletTypeEnum_LaneletType)laneletType);
         laneletTypes.emplace(lanelet_operations::matchStringToLaneletType(laneletTypeName));
     }
-    lanelet->setLaneletTypes(laneletTypes);
 
     std::set<ObstacleType> userOneWays;
     for (const auto &userOneWay : laneletMsg.user_one_way()) {
@@ -303,7 +331,6 @@ std::shared_ptr<Lanelet> ProtobufReader::createLaneletFromMessage(
             (commonroad_dynamic::ObstacleTypeEnum_ObstacleType)userOneWay);
         userOneWays.emplace(obstacle_operations::matchStringToObstacleType(userOneWayName));
     }
-    lanelet->setUsersOneWay(userOneWays);
 
     std::set<ObstacleType> usersBidirectionals;
     for (const auto &usersBidirectional : laneletMsg.user_bidirectional()) {
@@ -311,7 +338,41 @@ std::shared_ptr<Lanelet> ProtobufReader::createLaneletFromMessage(
             (commonroad_dynamic::ObstacleTypeEnum_ObstacleType)usersBidirectional);
         usersBidirectionals.emplace(obstacle_operations::matchStringToObstacleType(userBidirectionalName));
     }
-    lanelet->setUsersBidirectional(usersBidirectionals);
+
+    const auto leftBound{boundaryContainer.find(static_cast<size_t>(laneletMsg.left_bound()))};
+    const auto rightBound{boundaryContainer.find(static_cast<size_t>(laneletMsg.right_bound()))};
+    if (leftBound != boundaryContainer.end() and rightBound != boundaryContainer.end()) {
+        // the borders are moved into the lanelet, which computes its center vertices and polygon once
+        *lanelet = Lanelet{laneletMsg.lanelet_id(), createVerticesFromMessage(leftBound->second->points()),
+                           createVerticesFromMessage(rightBound->second->points()), std::move(laneletTypes),
+                           std::move(userOneWays), std::move(usersBidirectionals)};
+    } else {
+        lanelet->setId(laneletMsg.lanelet_id());
+        if (leftBound != boundaryContainer.end())
+            lanelet->setLeftBorderVertices(createVerticesFromMessage(leftBound->second->points()));
+        if (rightBound != boundaryContainer.end())
+            lanelet->setRightBorderVertices(createVerticesFromMessage(rightBound->second->points()));
+        lanelet->setLaneletTypes(laneletTypes);
+        lanelet->setUsersOneWay(userOneWays);
+        lanelet->setUsersBidirectional(usersBidirectionals);
+        lanelet->constructOuterPolygon();
+    }
+    if (leftBound != boundaryContainer.end())
+        lanelet->setLineMarkingLeft(matchLineMarking(leftBound->second->line_marking()));
+    if (rightBound != boundaryContainer.end())
+        lanelet->setLineMarkingRight(matchLineMarking(rightBound->second->line_marking()));
+
+    for (size_t laneletId : laneletMsg.successors()) {
+        auto containerLanelet = getLaneletFromContainer(laneletId, laneletContainer);
+        if (containerLanelet != nullptr)
+            lanelet->addSuccessor(getLaneletFromContainer(laneletId, laneletContainer));
+    }
+
+    for (size_t laneletId : laneletMsg.predecessors()) {
+        auto containerLanelet = getLaneletFromContainer(laneletId, laneletContainer);
+        if (containerLanelet != nullptr)
+            lanelet->addPredecessor(containerLanelet);
+    }
 
     if (laneletMsg.has_adjacent_left()) {
         auto containerLanelet = getLaneletFromContainer(laneletMsg.adjacent_left(), laneletContainer);
@@ -326,12 +387,9 @@ std::shared_ptr<Lanelet> ProtobufReader::createLaneletFromMessage(
     }
 
     if (laneletMsg.has_stop_line()) {
-        for (const auto &lane : commonRoadMapMsg.stop_lines()) {
-            if (lane.stop_line_id() == laneletMsg.stop_line()) {
-                lanelet->setStopLine(ProtobufReader::createStopLineFromMessage(lane));
-                break;
-            }
-        }
+        const auto stopLine{stopLineContainer.find(laneletMsg.stop_line())};
+        if (stopLine != stopLineContainer.end())
+            lanelet->setStopLine(ProtobufReader::createStopLineFromMessage(*stopLine->second));
     }
 
     for (size_t trafficSignId : laneletMsg.traffic_sign_refs()) {
@@ -346,20 +404,12 @@ std::shared_ptr<Lanelet> ProtobufReader::createLaneletFromMessage(
             lanelet->addTrafficLight(containerTrafficLight);
     }
 
-    lanelet->constructOuterPolygon();
     return lanelet;
 }
 
 std::shared_ptr<Bound> ProtobufReader::createBoundFromMessage(const commonroad_map::Bound &boundMsg) {
-    std::vector<vertex> points;
-    for (const auto &pointMsg : boundMsg.points())
-        points.push_back(ProtobufReader::createPointFromMessage(pointMsg));
-
-    std::string lineMarkingName{
-        boost::algorithm::to_lower_copy(commonroad_map::LineMarkingEnum_LineMarking_Name(boundMsg.line_marking()))};
-    LineMarking lineMarking{lanelet_operations::matchStringToLineMarking(lineMarkingName)};
-
-    return std::make_shared<Bound>(boundMsg.boundary_id(), points, lineMarking);
+    return std::make_shared<Bound>(boundMsg.boundary_id(), createVerticesFromMessage(boundMsg.points()),
+                                   matchLineMarking(boundMsg.line_marking()));
 }
 
 std::shared_ptr<StopLine> ProtobufReader::createStopLineFromMessage(const commonroad_map::StopLine &stopLineMsg) {
@@ -368,10 +418,7 @@ std::shared_ptr<StopLine> ProtobufReader::createStopLineFromMessage(const common
     stopLine->setPoints({{stopLineMsg.start_point().x(), stopLineMsg.start_point().y()},
                          {stopLineMsg.end_point().x(), stopLineMsg.end_point().y()}});
 
-    std::string lineMarkingName{
-        boost::algorithm::to_lower_copy(commonroad_map::LineMarkingEnum_LineMarking_Name(stopLineMsg.line_marking()))};
-    LineMarking lineMarking{lanelet_operations::matchStringToLineMarking(lineMarkingName)};
-    stopLine->setLineMarking(lineMarking);
+    stopLine->setLineMarking(matchLineMarking(stopLineMsg.line_marking()));
 
     return stopLine;
 }
@@ -775,6 +822,15 @@ vertex ProtobufReader::createPointFromMessage(const commonroad_common::Point &po
     return vertex;
 }
 
+std::vector<vertex> ProtobufReader::createVerticesFromMessage(
+    const google::protobuf::RepeatedPtrField<commonroad_common::Point> &pointsMsg) {
+    std::vector<vertex> vertices;
+    vertices.reserve(static_cast<size_t>(pointsMsg.size()));
+    for (const auto &pointMsg : pointsMsg)
+        vertices.push_back({pointMsg.x(), pointMsg.y()});
+    return vertices;
+}
+
 std::unique_ptr<Shape> ProtobufReader::createShapeFromMessage(const commonroad_common::Shape &shapeMsg) {
     std::unique_ptr<Shape> shape;
 
@@ -48,6 +48,22 @@ std::unique_ptr<CommonRoadFactory> createCommonRoadFactory(const std::string &xm
     throw std::runtime_error("This CommonRoad version is not supported.");
 }
 
+Scenario XMLReader::createScenarioFromXML(const std::string &xmlFile) {
+    // all elements are created from the same parsed document
+    const auto factory = createCommonRoadFactory(xmlFile);
+    auto trafficSigns = factory->createTrafficSigns();
+    auto trafficLights = factory->createTrafficLights();
+    auto lanelets = factory->createLanelets(trafficSigns, trafficLights);
+    auto obstacles = factory->createObstacles();
+    auto intersections = factory->createIntersections(lanelets);
+    auto country{extractCountryFromXML(xmlFile)};
+    auto roadNetwork{
+        std::make_shared<RoadNetwork>(RoadNetwork(lanelets, country, trafficSigns, trafficLights, intersections))};
+    for (const auto &inter : roadNetwork->getIntersections())
+        inter->computeMemberLanelets(roadNetwork);
+    return Scenario{obstacles, roadNetwork, factory->getTimeStepSize(), factory->createPlanningProblems()};
+}
+
 std::vector<std::shared_ptr<Obstacle>> XMLReader::createObstacleFromXML(const std::string &xmlFile) {
     const auto factory = createCommonRoadFactory(xmlFile);
     return factory->createObstacles();
@@ -16,7 +16,9 @@
 #include <boost/geometry/geometries/ring.hpp> // for ring
 
 #include <commonroad_cpp/auxiliaryDefs/structs.h>
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/geometry/geometric_operations.h>
+#include <commonroad_cpp/geometry/oriented_bounding_box.h>
 #include <commonroad_cpp/geometry/rectangle.h>
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/obstacle/obstacle_operations.h>
@@ -264,12 +266,12 @@ state_map_t Obstacle::getTrajectoryHistory() const { return recordedStates.traje
 
 size_t Obstacle::getTrajectoryLength() const { return trajectoryPrediction.trajectoryPrediction.size(); }
 
-multi_polygon_type Obstacle::getOccupancyPolygonShape(const size_t timeStep) {
+const multi_polygon_type &Obstacle::getOccupancyPolygonShape(const size_t timeStep) {
     return setOccupancyPolygonShape(timeStep);
 }
 
-time_step_map_t<multi_polygon_type> &Obstacle::getOccupancyPolygonShapeCache(const size_t timeStep,
-                                                                             const bool setBased) const {
+time_step_cache_t<std::shared_ptr<const multi_polygon_type>> &
+Obstacle::getOccupancyPolygonShapeCache(const size_t timeStep, const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.shapeAtTimeStep;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -277,17 +279,19 @@ time_step_map_t<multi_polygon_type> &Obstacle::getOccupancyPolygonShapeCache(con
     return trajectoryPrediction.obstacleCache.shapeAtTimeStep;
 }
 
-multi_polygon_type Obstacle::setOccupancyPolygonShape(const size_t timeStep, const bool setBased) {
+const multi_polygon_type &Obstacle::setOccupancyPolygonShape(const size_t timeStep, const bool setBased) {
     auto &shapeAtTimeStep{getOccupancyPolygonShapeCache(timeStep, setBased)};
-    if (shapeAtTimeStep.count(timeStep) == 1)
-        return shapeAtTimeStep[timeStep];
+    // the cache owns the shape, so the pointer stays valid after the lock is released
+    if (const auto *shape{shapeAtTimeStep.visit(
+            timeStep, [](const auto *cachedShape) { return cachedShape != nullptr ? cachedShape->get() : nullptr; })})
+        return *shape;
 
+    ENV_MODEL_TRACE_SPAN("Obstacle::setOccupancyPolygonShape", "obstacle");
     if (timeStep > recordedStates.currentState->getTimeStep() and
         setBasedPrediction.setBasedPrediction.count(timeStep) == 1) {
-        multi_polygon_type polygonShape{setBasedPrediction.setBasedPrediction.at(timeStep)->getOccupancyPolygonShape()};
-
-        shapeAtTimeStep[timeStep] = polygonShape;
-        return polygonShape;
+        return *shapeAtTimeStep.emplace(timeStep, std::make_shared<const multi_polygon_type>(
+                                                      setBasedPrediction.setBasedPrediction.at(timeStep)
+                                                          ->getOccupancyPolygonShape()));
     }
 
     multi_polygon_type polygonShape{polygon_type{}};
@@ -321,26 +325,15 @@ multi_polygon_type Obstacle::setOccupancyPolygonShape(const size_t timeStep, con
     if (!adjustedBoundingVertices.empty()) {
         polygonShape.at(0).outer().back() = point_type{adjustedBoundingVertices[0].x, adjustedBoundingVertices[0].y};
     }
-    shapeAtTimeStep[timeStep] = {polygonShape};
-    return polygonShape;
+    return *shapeAtTimeStep.emplace(timeStep, std::make_shared<const multi_polygon_type>(std::move(polygonShape)));
 }
 
 Shape &Obstacle::getGeoShape() const { return *geoShape; }
 
-std::unique_ptr<Shape> Obstacle::getShapePtr() const {
-    if (geoShape->getType() == ShapeType::rectangle)
-        return std::make_unique<Rectangle>(dynamic_cast<const Rectangle &>(*geoShape));
-    if (geoShape->getType() == ShapeType::circle)
-        return std::make_unique<Circle>(dynamic_cast<const Circle &>(*geoShape));
-    if (geoShape->getType() == ShapeType::polygon)
-        return std::make_unique<Polygon>(dynamic_cast<const Polygon &>(*geoShape));
-    if (geoShape->getType() == ShapeType::shapeGroup)
-        return std::make_unique<ShapeGroup>(dynamic_cast<const ShapeGroup &>(*geoShape));
-    return nullptr;
-}
+std::unique_ptr<Shape> Obstacle::getShapePtr() const { return geoShape != nullptr ? geoShape->clone() : nullptr; }
 
-std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
-Obstacle::getOccupiedLaneletsCache(const size_t timeStep, const bool setBased) {
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &Obstacle::getOccupiedLaneletsCache(const size_t timeStep,
+                                                                                             const bool setBased) {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLanelets;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -352,12 +345,17 @@ std::vector<std::shared_ptr<Lanelet>>
 Obstacle::setOccupiedLaneletsByShape(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep,
                                      const bool setBased) {
     auto &occupiedLanelets{getOccupiedLaneletsCache(timeStep, setBased)};
-    if (occupiedLanelets.find(timeStep) != occupiedLanelets.end())
-        return occupiedLanelets.at(timeStep);
-    const multi_polygon_type polygonShape{getOccupancyPolygonShape(timeStep)};
-    auto occupied{roadNetwork->findOccupiedLaneletsByShape(polygonShape)};
-    occupiedLanelets.insert(std::pair<int, std::vector<std::shared_ptr<Lanelet>>>(timeStep, occupied));
-    return occupied;
+    return occupiedLanelets.getOrCompute(timeStep, [&]() {
+        ENV_MODEL_TRACE_SPAN("Obstacle::setOccupiedLaneletsByShape", "obstacle");
+        const auto &shape{getOccupancyPolygonShape(timeStep)};
+        // occupancies of rectangles which are not given by set-based predictions are rectangles themselves
+        if (getGeoShape().getType() == ShapeType::rectangle and
+            (timeStep <= recordedStates.currentState->getTimeStep() or
+             setBasedPrediction.setBasedPrediction.count(timeStep) == 0))
+            return roadNetwork->findOccupiedLaneletsByShape(shape.front(),
+                                                            OrientedBoundingBox::fromRectangle(shape.front()));
+        return roadNetwork->findOccupiedLaneletsByShape(shape);
+    });
 }
 
 std::vector<std::shared_ptr<Lanelet>>
@@ -366,7 +364,7 @@ Obstacle::getOccupiedLaneletsByShape(const std::shared_ptr<RoadNetwork> &roadNet
     return setOccupiedLaneletsByShape(roadNetwork, timeStep, setBased);
 }
 
-std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
 Obstacle::getOccupiedLaneletsStateCache(const size_t timeStep, const bool setBased) {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLaneletsState;
@@ -379,27 +377,23 @@ std::vector<std::shared_ptr<Lanelet>>
 Obstacle::getOccupiedLaneletsByState(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep,
                                      const bool setBased) {
     auto &occupiedLaneletsState{getOccupiedLaneletsStateCache(timeStep, setBased)};
-    if (occupiedLaneletsState.find(timeStep) != occupiedLaneletsState.end())
-        return occupiedLaneletsState.at(timeStep);
-    std::vector<std::shared_ptr<Lanelet>> occ{roadNetwork->findLaneletsByPosition(
-        getStateByTimeStep(timeStep)->getXPosition(), getStateByTimeStep(timeStep)->getYPosition())};
-    occupiedLaneletsState.insert(std::pair<int, std::vector<std::shared_ptr<Lanelet>>>(timeStep, occ));
-    return occ;
+    return occupiedLaneletsState.getOrCompute(timeStep, [&]() {
+        return roadNetwork->findLaneletsByPosition(getStateByTimeStep(timeStep)->getXPosition(),
+                                                   getStateByTimeStep(timeStep)->getYPosition());
+    });
 }
 
 std::vector<std::shared_ptr<Lanelet>>
 Obstacle::getOccupiedLaneletsByFront(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep,
                                      const bool setBased) {
     auto &occupiedLaneletsFront{getOccupiedLaneletsFrontCache(timeStep, setBased)};
-    if (occupiedLaneletsFront.find(timeStep) != occupiedLaneletsFront.end())
-        return occupiedLaneletsFront.at(timeStep);
-    const std::vector<double> front = getFrontXYCoordinates(timeStep, setBased);
-    auto occ{roadNetwork->findLaneletsByPosition(front[0], front[1])};
-    occupiedLaneletsFront.insert(std::pair<int, std::vector<std::shared_ptr<Lanelet>>>(timeStep, occ));
-    return occ;
+    return occupiedLaneletsFront.getOrCompute(timeStep, [&]() {
+        const std::vector<double> front = getFrontXYCoordinates(timeStep, setBased);
+        return roadNetwork->findLaneletsByPosition(front[0], front[1]);
+    });
 }
 
-std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
 Obstacle::getOccupiedLaneletsFrontCache(const size_t timeStep, const bool setBased) {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLaneletsFront;
@@ -408,7 +402,7 @@ Obstacle::getOccupiedLaneletsFrontCache(const size_t timeStep, const bool setBas
     return trajectoryPrediction.obstacleCache.occupiedLaneletsFront;
 }
 
-std::unordered_map<time_step_t, std::vector<std::shared_ptr<Lanelet>>> &
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
 Obstacle::getOccupiedLaneletsBackCache(const size_t timeStep, const bool setBased) {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLaneletsBack;
@@ -421,12 +415,10 @@ std::vector<std::shared_ptr<Lanelet>>
 Obstacle::getOccupiedLaneletsByBack(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep,
                                     const bool setBased) {
     auto &occupiedLaneletsBack{getOccupiedLaneletsBackCache(timeStep, setBased)};
-    if (occupiedLaneletsBack.find(timeStep) != occupiedLaneletsBack.end())
-        return occupiedLaneletsBack.at(timeStep);
-    const auto back{getBackXYCoordinates(timeStep, setBased)};
-    auto occ{roadNetwork->findLaneletsByPosition(back[0], back[1])};
-    occupiedLaneletsBack.insert(std::pair<int, std::vector<std::shared_ptr<Lanelet>>>(timeStep, occ));
-    return occ;
+    return occupiedLaneletsBack.getOrCompute(timeStep, [&]() {
+        const auto back{getBackXYCoordinates(timeStep, setBased)};
+        return roadNetwork->findLaneletsByPosition(back[0], back[1]);
+    });
 }
 
 std::vector<std::shared_ptr<Lanelet>>
@@ -441,18 +433,72 @@ Obstacle::getOccupiedLaneletsNotDrivingDirectionByShape(const std::shared_ptr<Ro
     return setOccupiedLaneletsNotDrivingDirectionByShape(roadNetwork, timeStep, setBased);
 }
 
-void Obstacle::convertPointToCurvilinear(const size_t timeStep,
-                                         const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
-                                         const bool setBased) const {
+ObstacleCache::curvilinear_position_t
+Obstacle::convertPointToCurvilinear(const size_t timeStep,
+                                    const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                                    const bool setBased) const {
     const auto state{getStateByTimeStep(timeStep)};
     Eigen::Vector2d convertedPoint{ccs->convertToCurvilinearCoords(state->getXPosition(), state->getYPosition())};
-    auto ccsTangent{ccs->tangent(convertedPoint.x())};
+    return storeConvertedPosition(timeStep, ccs, {convertedPoint.x(), convertedPoint.y()}, setBased);
+}
+
+std::vector<ObstacleCache::curvilinear_position_t>
+Obstacle::convertPointsToCurvilinear(const std::vector<size_t> &timeSteps,
+                                     const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                                     const bool setBased) const {
+    std::vector<vertex> points;
+    points.reserve(timeSteps.size());
+    for (const auto &timeStep : timeSteps) {
+        const auto state{getStateByTimeStep(timeStep)};
+        points.push_back({state->getXPosition(), state->getYPosition()});
+    }
+    const auto convertedPoints{geometric_operations::convertPointsToCurvilinear(*ccs, points)};
+    std::vector<ObstacleCache::curvilinear_position_t> positions;
+    positions.reserve(timeSteps.size());
+    for (size_t idx{0}; idx < timeSteps.size(); ++idx)
+        positions.push_back(storeConvertedPosition(timeSteps[idx], ccs, convertedPoints[idx], setBased));
+    return positions;
+}
+
+void Obstacle::convertPointsToCurvilinear(const std::vector<std::shared_ptr<Obstacle>> &obstacles,
+                                          const size_t timeStep,
+                                          const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                                          const bool setBased) {
+    std::vector<Obstacle *> relevantObstacles;
+    std::vector<vertex> points;
+    for (const auto &obs : obstacles) {
+        if (!obs->timeStepExists(timeStep))
+            continue;
+        if (obs->convertedPositionsCache(timeStep, setBased).visit(timeStep, [&ccs](const auto *positions) {
+                return positions != nullptr and positions->find(ccs) != positions->end();
+            }))
+            continue;
+        const auto state{obs->getStateByTimeStep(timeStep)};
+        if (!ccs->cartesianPointInProjectionDomain(state->getXPosition(), state->getYPosition()))
+            continue;
+        relevantObstacles.push_back(obs.get());
+        points.push_back({state->getXPosition(), state->getYPosition()});
+    }
+    const auto convertedPoints{geometric_operations::convertPointsToCurvilinear(*ccs, points)};
+    for (size_t idx{0}; idx < relevantObstacles.size(); ++idx)
+        relevantObstacles[idx]->storeConvertedPosition(timeStep, ccs, convertedPoints[idx], setBased);
+}
+
+ObstacleCache::curvilinear_position_t
+Obstacle::storeConvertedPosition(const size_t timeStep,
+                                 const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                                 const vertex &convertedPoint, const bool setBased) const {
+    auto ccsTangent{ccs->tangent(convertedPoint.x)};
     const double ccsOrientation = atan2(ccsTangent.y(), ccsTangent.x());
-    const double theta = geometric_operations::subtractOrientations(state->getGlobalOrientation(), ccsOrientation);
+    const double theta = geometric_operations::subtractOrientations(
+        getStateByTimeStep(timeStep)->getGlobalOrientation(), ccsOrientation);
 
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    convertedPositions[timeStep][ccs] = {
-        convertedPoint.x() - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2(), convertedPoint.y(), theta};
+    ObstacleCache::curvilinear_position_t position{
+        convertedPoint.x - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2(), convertedPoint.y, theta};
+    convertedPositionsCache(timeStep, setBased).modify(timeStep, [&ccs, &position](auto &positions) {
+        positions[ccs] = position;
+    });
+    return position;
 }
 
 std::string Obstacle::ccsErrorMsg(const size_t timeStep,
@@ -468,6 +514,25 @@ std::string Obstacle::ccsErrorMsg(const size_t timeStep,
            " - y-position: " + std::to_string(getStateByTimeStep(timeStep)->getYPosition());
 }
 
+ObstacleCache::curvilinear_position_t
+Obstacle::getConvertedPosition(const size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
+                               const bool setBased, const std::string &func) const {
+    auto findPosition{[&ccs](const auto *positions) -> std::optional<ObstacleCache::curvilinear_position_t> {
+        if (positions == nullptr)
+            return std::nullopt;
+        if (auto iter{positions->find(ccs)}; iter != positions->end())
+            return iter->second;
+        return std::nullopt;
+    }};
+    if (auto cachedPosition{convertedPositionsCache(timeStep, setBased).visit(timeStep, findPosition)})
+        return *cachedPosition;
+    try {
+        return convertPointToCurvilinear(timeStep, ccs, setBased);
+    } catch (...) {
+        throw std::runtime_error(ccsErrorMsg(timeStep, ccs, func));
+    }
+}
+
 double Obstacle::frontS(const std::shared_ptr<RoadNetwork> &roadNetwork, const size_t timeStep) {
     const double lonPosition = getLonPosition(roadNetwork, timeStep);
     const double theta = getCurvilinearOrientation(roadNetwork, timeStep);
@@ -495,24 +560,14 @@ double Obstacle::frontS(const size_t timeStep, const std::shared_ptr<geometry::C
         } else
             throw std::runtime_error("Obstacle::frontS: Only polygon shapes are supported for set-based predictions.");
 
-        for (const auto &vert : vertices) {
-            auto convertedPoint{ccs->convertToCurvilinearCoords(vert.x, vert.y)};
-            frontS =
-                std::max(frontS, convertedPoint.x() - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2());
-        }
+        for (const auto &convertedPoint : geometric_operations::convertPointsToCurvilinear(*ccs, vertices))
+            frontS = std::max(frontS, convertedPoint.x - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2());
         return frontS;
     }
 
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "frontS"));
-        }
-    }
-    const double lonPosition = convertedPositions[timeStep][ccs][0];
-    const double theta = convertedPositions[timeStep][ccs][2];
+    const auto position{getConvertedPosition(timeStep, ccs, setBased, "frontS")};
+    const double lonPosition = position[0];
+    const double theta = position[2];
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
 
     // use maximum of all corners
@@ -546,23 +601,14 @@ double Obstacle::rearS(const size_t timeStep, const std::shared_ptr<geometry::Cu
         } else
             throw std::runtime_error("Obstacle::rearS: Only polygon shapes are supported for set-based predictions.");
 
-        for (const auto &vert : vertices) {
-            auto convertedPoint{ccs->convertToCurvilinearCoords(vert.x, vert.y)};
-            rearS = std::min(rearS, convertedPoint.x() - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2());
-        }
+        for (const auto &convertedPoint : geometric_operations::convertPointsToCurvilinear(*ccs, vertices))
+            rearS = std::min(rearS, convertedPoint.x - RoadNetworkParameters::numAdditionalSegmentsCCS * ccs->eps2());
         return rearS;
     }
 
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "rearS"));
-        }
-    }
-    const double lonPosition = convertedPositions[timeStep][ccs][0];
-    const double theta = convertedPositions[timeStep][ccs][2];
+    const auto position{getConvertedPosition(timeStep, ccs, setBased, "rearS")};
+    const double lonPosition = position[0];
+    const double theta = position[2];
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
 
     // use minimum of all corners
@@ -575,28 +621,22 @@ double Obstacle::rightD(const std::shared_ptr<RoadNetwork> &roadNetwork, const s
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
     const double theta = getCurvilinearOrientation(roadNetwork, timeStep);
 
-    rightLatPosition[timeStep] = latPos + rotatedMinimumLatitude(rect, theta);
-    return rightLatPosition[timeStep];
+    const double rightPosition{latPos + rotatedMinimumLatitude(rect, theta)};
+    rightLatPosition.insertOrAssign(timeStep, rightPosition);
+    return rightPosition;
 }
 
 double Obstacle::rightD(const size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                         const bool setBased) const {
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "rightD"));
-        }
-    }
-    const double latPosition = convertedPositions[timeStep][ccs][1];
-    const double theta = convertedPositions[timeStep][ccs][2];
+    const auto position{getConvertedPosition(timeStep, ccs, setBased, "rightD")};
+    const double latPosition = position[1];
+    const double theta = position[2];
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
 
     return latPosition + rotatedMinimumLatitude(rect, theta);
 }
 
-time_step_map_t<double> &Obstacle::getRightLatPositionCache(const size_t timeStep, const bool setBased) const {
+time_step_cache_t<double> &Obstacle::getRightLatPositionCache(const size_t timeStep, const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.rightLatPosition;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -604,7 +644,7 @@ time_step_map_t<double> &Obstacle::getRightLatPositionCache(const size_t timeSte
     return trajectoryPrediction.obstacleCache.rightLatPosition;
 }
 
-time_step_map_t<double> &Obstacle::getLeftLatPositionCache(const size_t timeStep, const bool setBased) const {
+time_step_cache_t<double> &Obstacle::getLeftLatPositionCache(const size_t timeStep, const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.leftLatPosition;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -618,22 +658,16 @@ double Obstacle::leftD(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t t
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
     const double theta = getCurvilinearOrientation(roadNetwork, timeStep);
 
-    leftLatPosition[timeStep] = latPos + rotatedMaximumLatitude(rect, theta);
-    return leftLatPosition[timeStep];
+    const double leftPosition{latPos + rotatedMaximumLatitude(rect, theta)};
+    leftLatPosition.insertOrAssign(timeStep, leftPosition);
+    return leftPosition;
 }
 
 double Obstacle::leftD(const size_t timeStep, const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                        const bool setBased) const {
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "leftD"));
-        }
-    }
-    const double latPosition = convertedPositions[timeStep][ccs][1];
-    const double theta = convertedPositions[timeStep][ccs][2];
+    const auto position{getConvertedPosition(timeStep, ccs, setBased, "leftD")};
+    const double latPosition = position[1];
+    const double theta = position[2];
     const auto &rect = dynamic_cast<const Rectangle &>(*geoShape);
 
     return latPosition + rotatedMaximumLatitude(rect, theta);
@@ -656,32 +690,13 @@ double Obstacle::getLatPosition(const std::shared_ptr<RoadNetwork> &roadNetwork,
 double Obstacle::getLonPosition(const size_t timeStep,
                                 const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                                 const bool setBased) const {
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "getLonPosition"));
-        }
-    }
-    return convertedPositions[timeStep][ccs][0];
+    return getConvertedPosition(timeStep, ccs, setBased, "getLonPosition")[0];
 }
 
 double Obstacle::getLatPosition(const size_t timeStep,
                                 const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                                 const bool setBased) const {
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            std::string refInfo;
-            for (const auto &ref : ccs->referencePath())
-                refInfo += "{" + std::to_string(ref.x()) + ", " + std::to_string(ref.y()) + "}; ";
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "getLatPosition"));
-        }
-    }
-    return convertedPositions[timeStep][ccs][1];
+    return getConvertedPosition(timeStep, ccs, setBased, "getLatPosition")[1];
 }
 
 double Obstacle::getCurvilinearOrientation(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep) {
@@ -694,15 +709,8 @@ double Obstacle::getCurvilinearOrientation(const std::shared_ptr<RoadNetwork> &r
 double Obstacle::getCurvilinearOrientation(size_t timeStep,
                                            const std::shared_ptr<geometry::CurvilinearCoordinateSystem> &ccs,
                                            const bool setBased) {
-    auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-    if (convertedPositions.count(timeStep) != 1 || convertedPositions[timeStep].count(ccs) != 1) {
-        try {
-            convertPointToCurvilinear(timeStep, ccs);
-        } catch (...) {
-            throw std::runtime_error(ccsErrorMsg(timeStep, ccs, "getCurvilinearOrientation"));
-        }
-    }
-    return geometric_operations::constrainAngle(convertedPositions[timeStep][ccs][2]);
+    return geometric_operations::constrainAngle(
+        getConvertedPosition(timeStep, ccs, setBased, "getCurvilinearOrientation")[2]);
 }
 
 size_t Obstacle::getFirstTrajectoryTimeStep() const {
@@ -720,10 +728,13 @@ std::shared_ptr<Lane> Obstacle::getReferenceLane(const std::shared_ptr<RoadNetwo
                                                  const size_t timeStep) {
     if (dynamicRef)
         return setReferenceLane(roadNetwork, timeStep);
-    return recordedStates.occupancyRecorded.referenceLane.at(0);
+    if (auto refLane{recordedStates.occupancyRecorded.referenceLane.find(0)})
+        return *refLane;
+    throw std::out_of_range("Obstacle::getReferenceLane: No reference lane set! Obstacle ID " +
+                            std::to_string(getId()));
 }
 
-time_step_map_t<std::shared_ptr<Lane>> &Obstacle::getReferenceLaneCache(size_t timeStep, const bool setBased) const {
+time_step_cache_t<std::shared_ptr<Lane>> &Obstacle::getReferenceLaneCache(size_t timeStep, const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.referenceLane;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -734,19 +745,21 @@ time_step_map_t<std::shared_ptr<Lane>> &Obstacle::getReferenceLaneCache(size_t t
 std::shared_ptr<Lane> Obstacle::setReferenceLane(const std::shared_ptr<RoadNetwork> &roadNetwork,
                                                  const size_t timeStep) {
     auto &referenceLane{getReferenceLaneCache(timeStep, false)};
-    if (referenceLane.count(timeStep) == 1 and referenceLane.at(timeStep) != nullptr)
-        return referenceLane.at(timeStep);
+    if (auto refLane{referenceLane.find(timeStep)}; refLane and *refLane != nullptr)
+        return *refLane;
 
+    ENV_MODEL_TRACE_SPAN("Obstacle::setReferenceLane", "obstacle");
     if (const auto refLaneTmp{obstacle_reference::computeRef(*this, roadNetwork, timeStep)}; !refLaneTmp.empty())
-        referenceLane[timeStep] = refLaneTmp.at(0);
+        referenceLane.insertOrAssign(timeStep, refLaneTmp.at(0));
 
-    if (referenceLane.count(timeStep) == 0 or referenceLane.at(timeStep) == nullptr)
+    auto refLane{referenceLane.find(timeStep)};
+    if (!refLane or *refLane == nullptr)
         throw std::runtime_error("Obstacle::setReferenceLane: No matching referenceLane found! Obstacle ID " +
                                  std::to_string(getId()) + " at time step " + std::to_string(timeStep));
-    return referenceLane.at(timeStep);
+    return *refLane;
 }
 
-time_step_map_t<ObstacleCache::curvilinear_position_map_t> &
+time_step_cache_t<ObstacleCache::curvilinear_position_map_t> &
 Obstacle::convertedPositionsCache(const size_t timeStep, const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.convertedPositions;
@@ -757,16 +770,17 @@ Obstacle::convertedPositionsCache(const size_t timeStep, const bool setBased) co
 
 void Obstacle::convertPointToCurvilinear(const std::shared_ptr<RoadNetwork> &roadNetwork, const size_t timeStep,
                                          const bool setBased) {
+    ENV_MODEL_TRACE_SPAN("Obstacle::convertPointToCurvilinear", "obstacle");
     auto curRefLaneCCS{getReferenceLane(roadNetwork, timeStep)->getCurvilinearCoordinateSystem()};
+    ObstacleCache::curvilinear_position_t position;
     try {
-        convertPointToCurvilinear(timeStep, curRefLaneCCS);
-        auto &convertedPositions{convertedPositionsCache(timeStep, setBased)};
-        getStateByTimeStep(timeStep)->setLonPosition(convertedPositions[timeStep][curRefLaneCCS][0]);
-        getStateByTimeStep(timeStep)->setLatPosition(convertedPositions[timeStep][curRefLaneCCS][1]);
-        getStateByTimeStep(timeStep)->setCurvilinearOrientation(convertedPositions[timeStep][curRefLaneCCS][2]);
+        position = convertPointToCurvilinear(timeStep, curRefLaneCCS, setBased);
     } catch (...) {
         throw std::runtime_error(ccsErrorMsg(timeStep, curRefLaneCCS, "convertPointToCurvilinear"));
     }
+    getStateByTimeStep(timeStep)->setLonPosition(position[0]);
+    getStateByTimeStep(timeStep)->setLatPosition(position[1]);
+    getStateByTimeStep(timeStep)->setCurvilinearOrientation(position[2]);
 }
 
 void Obstacle::interpolateAcceleration(size_t timeStep, double timeStepSize) const {
@@ -782,21 +796,20 @@ void Obstacle::interpolateAcceleration(size_t timeStep, double timeStepSize) con
 }
 
 void Obstacle::setOccupiedLanes(const std::vector<std::shared_ptr<Lane>> &lanes, size_t timeStep, bool setBased) {
-    auto &occupiedLanes{getOccupiedLanesCache(timeStep, setBased)};
-    if (occupiedLanes.count(timeStep) == 0)
-        occupiedLanes[timeStep] = lanes;
+    getOccupiedLanesCache(timeStep, setBased).emplace(timeStep, lanes);
 }
 
 void Obstacle::setObstacleRole(ObstacleRole type) { obstacleRole = type; }
 
 void Obstacle::setOccupiedLanes(const std::shared_ptr<RoadNetwork> &roadNetwork, size_t timeStep, bool setBased) {
+    ENV_MODEL_TRACE_SPAN("Obstacle::setOccupiedLanes", "obstacle");
     auto &occupiedLanes{getOccupiedLanesCache(timeStep, setBased)};
     auto lanelets{getOccupiedLaneletsRoadByShape(roadNetwork, timeStep)};
     std::vector<std::shared_ptr<Lane>> occLanes{lane_operations::createLanesBySingleLanelets(
         lanelets, roadNetwork, sensorParameters.getFieldOfViewRear(), sensorParameters.getFieldOfViewFront(),
         roadNetworkParameters.numIntersectionsPerDirectionLaneGeneration,
         {getStateByTimeStep(timeStep)->getXPosition(), getStateByTimeStep(timeStep)->getYPosition()})};
-    occupiedLanes[timeStep] = occLanes;
+    occupiedLanes.insertOrAssign(timeStep, occLanes);
 }
 
 std::vector<std::shared_ptr<Lanelet>>
@@ -883,8 +896,8 @@ Obstacle::getOccupiedLanesDrivingDirection(const std::shared_ptr<RoadNetwork> &r
     return relevantLanes;
 }
 
-time_step_map_t<std::vector<std::shared_ptr<Lane>>> &Obstacle::getOccupiedLanesCache(const size_t timeStep,
-                                                                                     const bool setBased) const {
+time_step_cache_t<std::vector<std::shared_ptr<Lane>>> &Obstacle::getOccupiedLanesCache(const size_t timeStep,
+                                                                                       const bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLanes;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -897,9 +910,10 @@ std::vector<std::shared_ptr<Lane>> Obstacle::getOccupiedLanes(const std::shared_
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
         timeStep = getCurrentState()->getTimeStep(); // only valid state for set-based prediction
     auto &occupiedLanes{getOccupiedLanesCache(timeStep, setBased)};
-    if (occupiedLanes[timeStep].empty())
-        setOccupiedLanes(roadNetwork, timeStep);
-    return occupiedLanes[timeStep];
+    if (auto lanes{occupiedLanes.find(timeStep)}; lanes and !lanes->empty())
+        return std::move(*lanes);
+    setOccupiedLanes(roadNetwork, timeStep);
+    return occupiedLanes.find(timeStep).value_or(std::vector<std::shared_ptr<Lane>>{});
 }
 
 std::vector<std::shared_ptr<Lane>>
@@ -926,6 +940,7 @@ Obstacle::getOccupiedLanesAndAdjacent(const std::shared_ptr<RoadNetwork> &roadNe
 }
 
 void Obstacle::computeLanes(const std::shared_ptr<RoadNetwork> &roadNetwork, bool considerHistory) {
+    ENV_MODEL_TRACE_SPAN("Obstacle::computeLanes", "obstacle");
     const size_t timeStamp{recordedStates.currentState->getTimeStep()};
     auto lanelets{getOccupiedLaneletsByShape(roadNetwork, timeStamp)};
     auto lanes{lane_operations::createLanesBySingleLanelets(
@@ -942,17 +957,48 @@ void Obstacle::computeLanes(const std::shared_ptr<RoadNetwork> &roadNetwork, boo
 }
 
 void Obstacle::setCurvilinearStates(const std::shared_ptr<RoadNetwork> &roadNetwork) {
+    std::vector<size_t> timeSteps;
     if (!recordedStates.currentState->getValidStates().lonPosition)
-        convertPointToCurvilinear(roadNetwork, recordedStates.currentState->getTimeStep());
+        timeSteps.push_back(recordedStates.currentState->getTimeStep());
     if (!isStatic())
         for (const auto &timeStep : getPredictionTimeSteps())
             if (!getStateByTimeStep(timeStep)->getValidStates().lonPosition)
+                timeSteps.push_back(timeStep);
+
+    // positions with the same reference lane are converted together
+    std::vector<std::pair<std::shared_ptr<geometry::CurvilinearCoordinateSystem>, std::vector<size_t>>>
+        timeStepsByCCS;
+    for (const auto &timeStep : timeSteps) {
+        const auto &ccs{getReferenceLane(roadNetwork, timeStep)->getCurvilinearCoordinateSystem()};
+        auto group{std::find_if(timeStepsByCCS.begin(), timeStepsByCCS.end(),
+                                [&ccs](const auto &grp) { return grp.first == ccs; })};
+        if (group == timeStepsByCCS.end())
+            group = timeStepsByCCS.insert(timeStepsByCCS.end(), {ccs, {}});
+        group->second.push_back(timeStep);
+    }
+
+    for (const auto &[ccs, ccsTimeSteps] : timeStepsByCCS) {
+        std::vector<ObstacleCache::curvilinear_position_t> positions;
+        try {
+            positions = convertPointsToCurvilinear(ccsTimeSteps, ccs);
+        } catch (...) {
+            // the positions are converted separately to report the time step at which the conversion failed
+            for (const auto &timeStep : ccsTimeSteps)
                 convertPointToCurvilinear(roadNetwork, timeStep);
+            continue;
+        }
+        for (size_t idx{0}; idx < ccsTimeSteps.size(); ++idx) {
+            const auto state{getStateByTimeStep(ccsTimeSteps[idx])};
+            state->setLonPosition(positions[idx][0]);
+            state->setLatPosition(positions[idx][1]);
+            state->setCurvilinearOrientation(positions[idx][2]);
+        }
+    }
 }
 
 const polygon_type Obstacle::getFov() { return sensorParameters.getFieldOfViewPolygon(); }
 
-time_step_map_t<std::vector<std::shared_ptr<Lanelet>>> &
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
 Obstacle::getOccupiedLaneletsDrivingDirCache(size_t timeStep, bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLaneletsDrivingDir;
@@ -965,9 +1011,10 @@ std::vector<std::shared_ptr<Lanelet>>
 Obstacle::setOccupiedLaneletsDrivingDirectionByShape(const std::shared_ptr<RoadNetwork> &roadNetwork,
                                                      time_step_t timeStep, bool setBased) {
     auto &occupiedLaneletsDrivingDir{getOccupiedLaneletsDrivingDirCache(timeStep, setBased)};
-    if (occupiedLaneletsDrivingDir.find(timeStep) != occupiedLaneletsDrivingDir.end())
-        return occupiedLaneletsDrivingDir[timeStep];
+    if (auto occupied{occupiedLaneletsDrivingDir.find(timeStep)})
+        return std::move(*occupied);
 
+    ENV_MODEL_TRACE_SPAN("Obstacle::setOccupiedLaneletsDrivingDirectionByShape", "obstacle");
     if (setBased and !setBasedPrediction.setBasedPrediction.empty() and timeStep > getCurrentState()->getTimeStep()) {
         // use only lanelets which are part of the lane of the current time step
         std::set<size_t> ids;
@@ -981,8 +1028,7 @@ Obstacle::setOccupiedLaneletsDrivingDirectionByShape(const std::shared_ptr<RoadN
                 }
             }
         }
-        occupiedLaneletsDrivingDir[timeStep] = lanelets;
-        return occupiedLaneletsDrivingDir[timeStep];
+        return occupiedLaneletsDrivingDir.emplace(timeStep, lanelets);
     }
 
     std::set<size_t> relevantLanelets1;
@@ -1021,11 +1067,10 @@ Obstacle::setOccupiedLaneletsDrivingDirectionByShape(const std::shared_ptr<RoadN
             relevantLanelets2.find(letBase->getId()) != relevantLanelets2.end())
             lanelets.push_back(letBase);
 
-    occupiedLaneletsDrivingDir[timeStep] = lanelets;
-    return occupiedLaneletsDrivingDir[timeStep];
+    return occupiedLaneletsDrivingDir.emplace(timeStep, lanelets);
 }
 
-time_step_map_t<std::vector<std::shared_ptr<Lanelet>>> &
+time_step_cache_t<std::vector<std::shared_ptr<Lanelet>>> &
 Obstacle::getOccupiedLaneletsNotDrivingDirCache(size_t timeStep, bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.occupiedLaneletsNotDrivingDir;
@@ -1038,8 +1083,8 @@ std::vector<std::shared_ptr<Lanelet>>
 Obstacle::setOccupiedLaneletsNotDrivingDirectionByShape(const std::shared_ptr<RoadNetwork> &roadNetwork,
                                                         time_step_t timeStep, bool setBased) {
     auto &occupiedLaneletsNotDrivingDir{getOccupiedLaneletsNotDrivingDirCache(timeStep, setBased)};
-    if (occupiedLaneletsNotDrivingDir.find(timeStep) != occupiedLaneletsNotDrivingDir.end())
-        return occupiedLaneletsNotDrivingDir[timeStep];
+    if (auto occupied{occupiedLaneletsNotDrivingDir.find(timeStep)})
+        return std::move(*occupied);
 
     auto occ = getOccupiedLaneletsDrivingDirectionByShape(roadNetwork, timeStep);
     auto all = getOccupiedLaneletsByShape(roadNetwork, timeStep);
@@ -1051,8 +1096,7 @@ Obstacle::setOccupiedLaneletsNotDrivingDirectionByShape(const std::shared_ptr<Ro
             lanelets.emplace_back(lanelet);
     }
 
-    occupiedLaneletsNotDrivingDir[timeStep] = lanelets;
-    return occupiedLaneletsNotDrivingDir[timeStep];
+    return occupiedLaneletsNotDrivingDir.emplace(timeStep, lanelets);
 }
 
 void Obstacle::setCurrentSignalState(const std::shared_ptr<SignalState> &state) {
@@ -1099,18 +1143,16 @@ size_t Obstacle::getFinalTimeStep() const { return finalTimeStep; }
 
 std::vector<double> Obstacle::getFrontXYCoordinates(time_step_t timeStep, bool setBased) {
     auto &frontXYPositions{getFrontXYCoordinatesCache(timeStep, setBased)};
-    if (frontXYPositions.find(timeStep) != frontXYPositions.end())
-        return frontXYPositions[timeStep];
-
-    std::shared_ptr<State> state = getStateByTimeStep(timeStep);
-    double frontX = getGeoShape().getLength() / 2 * cos(state->getGlobalOrientation()) + state->getXPosition();
-    double frontY = getGeoShape().getLength() / 2 * sin(state->getGlobalOrientation()) + state->getYPosition();
-    std::vector<double> result{frontX, frontY};
-    frontXYPositions[timeStep] = result;
-    return frontXYPositions[timeStep];
+    return frontXYPositions.getOrCompute(timeStep, [&]() {
+        std::shared_ptr<State> state = getStateByTimeStep(timeStep);
+        double frontX = getGeoShape().getLength() / 2 * cos(state->getGlobalOrientation()) + state->getXPosition();
+        double frontY = getGeoShape().getLength() / 2 * sin(state->getGlobalOrientation()) + state->getYPosition();
+        return std::vector<double>{frontX, frontY};
+    });
 }
 
-time_step_map_t<std::vector<double>> &Obstacle::getFrontXYCoordinatesCache(time_step_t timeStep, bool setBased) const {
+time_step_cache_t<std::vector<double>> &Obstacle::getFrontXYCoordinatesCache(time_step_t timeStep,
+                                                                             bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.frontXYPositions;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -1118,7 +1160,8 @@ time_step_map_t<std::vector<double>> &Obstacle::getFrontXYCoordinatesCache(time_
     return trajectoryPrediction.obstacleCache.frontXYPositions;
 }
 
-time_step_map_t<std::vector<double>> &Obstacle::getBackXYCoordinatesCache(time_step_t timeStep, bool setBased) const {
+time_step_cache_t<std::vector<double>> &Obstacle::getBackXYCoordinatesCache(time_step_t timeStep,
+                                                                            bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.backXYPositions;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -1128,15 +1171,14 @@ time_step_map_t<std::vector<double>> &Obstacle::getBackXYCoordinatesCache(time_s
 
 std::vector<double> Obstacle::getBackXYCoordinates(time_step_t timeStep, bool setBased) {
     auto &backXYPositions{getBackXYCoordinatesCache(timeStep, setBased)};
-    if (backXYPositions.find(timeStep) != backXYPositions.end())
-        return backXYPositions[timeStep];
-
-    std::shared_ptr<State> state = getStateByTimeStep(timeStep);
-    double backX = getGeoShape().getLength() / 2 * cos(state->getGlobalOrientation() + M_PI) + state->getXPosition();
-    double backY = getGeoShape().getLength() / 2 * sin(state->getGlobalOrientation() + M_PI) + state->getYPosition();
-    std::vector<double> result{backX, backY};
-    backXYPositions[timeStep] = result;
-    return backXYPositions[timeStep];
+    return backXYPositions.getOrCompute(timeStep, [&]() {
+        std::shared_ptr<State> state = getStateByTimeStep(timeStep);
+        double backX =
+            getGeoShape().getLength() / 2 * cos(state->getGlobalOrientation() + M_PI) + state->getXPosition();
+        double backY =
+            getGeoShape().getLength() / 2 * sin(state->getGlobalOrientation() + M_PI) + state->getYPosition();
+        return std::vector<double>{backX, backY};
+    });
 }
 
 void Obstacle::setFirstLastTimeStep() {
@@ -1201,8 +1243,8 @@ double Obstacle::getAcceleration(size_t timeStep, bool setBased, bool min) const
     return getStateByTimeStep(timeStep)->getAcceleration();
 }
 
-time_step_map_t<std::map<size_t, double>> &Obstacle::getLateralDistanceToObjectCache(size_t timeStep,
-                                                                                     bool setBased) const {
+time_step_cache_t<std::map<size_t, double>> &Obstacle::getLateralDistanceToObjectCache(size_t timeStep,
+                                                                                       bool setBased) const {
     if (timeStep <= recordedStates.currentState->getTimeStep())
         return recordedStates.occupancyRecorded.lateralDistanceToObjects;
     if (setBased and !setBasedPrediction.setBasedPrediction.empty())
@@ -1213,9 +1255,16 @@ time_step_map_t<std::map<size_t, double>> &Obstacle::getLateralDistanceToObjectC
 double Obstacle::getLateralDistanceToObstacle(time_step_t timeStep, const std::shared_ptr<Obstacle> &obs,
                                               const std::shared_ptr<RoadNetwork> &roadnetwork, bool setBased) {
     auto &lateralDistanceToObjects{getLateralDistanceToObjectCache(timeStep, setBased)};
-    if (lateralDistanceToObjects.find(timeStep) != lateralDistanceToObjects.end() &&
-        lateralDistanceToObjects[timeStep].find(obs->getId()) != lateralDistanceToObjects[timeStep].end())
-        return lateralDistanceToObjects[timeStep][obs->getId()];
+    auto cachedDistance{
+        lateralDistanceToObjects.visit(timeStep, [&obs](const auto *distances) -> std::optional<double> {
+            if (distances == nullptr)
+                return std::nullopt;
+            if (auto iter{distances->find(obs->getId())}; iter != distances->end())
+                return iter->second;
+            return std::nullopt;
+        })};
+    if (cachedDistance)
+        return *cachedDistance;
 
     const double leftThis = leftD(roadnetwork, timeStep);
     const double rightThis = rightD(roadnetwork, timeStep);
@@ -1227,7 +1276,7 @@ double Obstacle::getLateralDistanceToObstacle(time_step_t timeStep, const std::s
 
     const double min = std::min(abs(rightThis - leftOther), abs(leftThis - rightOther));
 
-    lateralDistanceToObjects[timeStep][obs->getId()] = min;
+    lateralDistanceToObjects.modify(timeStep, [&obs, min](auto &distances) { distances[obs->getId()] = min; });
 
     return min;
 }
@@ -1245,5 +1294,5 @@ void Obstacle::setReferenceLane(const std::shared_ptr<Lane> &refLane) {
         setBasedPrediction.obstacleCache.referenceLane.clear();
         trajectoryPrediction.obstacleCache.referenceLane.clear();
     }
-    recordedStates.occupancyRecorded.referenceLane[0] = refLane;
+    recordedStates.occupancyRecorded.referenceLane.insertOrAssign(0, refLane);
 }
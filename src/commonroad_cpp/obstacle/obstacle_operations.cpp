@@ -30,7 +30,7 @@ bool obstacle_operations::lineInFrontOfObstacle(const std::pair<vertex, vertex>
     if (!ccs->cartesianPointInProjectionDomain(line.second.x, line.second.y))
         return false;
     auto pointB{ccs->convertToCurvilinearCoords(line.second.x, line.second.y)};
-    multi_polygon_type shapes{obs->getOccupancyPolygonShape(timeStep)};
+    const auto &shapes{obs->getOccupancyPolygonShape(timeStep)};
     for (const auto &shape : shapes)
         for (size_t idx{0}; idx < shape.outer().size(); ++idx) {
             auto point{shape.outer().at(idx)};
@@ -65,7 +65,7 @@ double obstacle_operations::minDistanceToPoint(const size_t timeStep, const std:
     auto pointB{line.second.x - line.first.x};
     auto pointC{(line.first.x - line.second.x) * line.first.y + (line.second.y - line.first.y) * line.first.x};
     std::vector<double> distances;
-    multi_polygon_type shapes{obstacleK->getOccupancyPolygonShape(timeStep)};
+    const auto &shapes{obstacleK->getOccupancyPolygonShape(timeStep)};
     for (const auto &shape : shapes)
         for (const auto &point : shape.outer()) {
             distances.push_back(std::fabs((pointA * point.x() + pointB * point.y() + pointC)) /
@@ -12,7 +12,7 @@ bool BrakingAtIntersectionPossiblePredicate::booleanEvaluation(
     double distanceIntersection{0.0};
 
     double brakingDistance{std::pow(obstacleK->getStateByTimeStep(timeStep)->getVelocity(), 2) /
-                           (2 * abs(parameters.getParam("intersectionBrakingPossible")))};
+                           (2 * abs(parameters.getParam(PredicateParamId::intersectionBrakingPossible)))};
     for (const auto &lane : lane_operations::createLanesBySingleLanelets(
              obstacleK->getOccupiedLaneletsByShape(world->getRoadNetwork(), timeStep), world->getRoadNetwork(),
              obstacleK->getSensorParameters().getFieldOfViewRear(),
@@ -11,7 +11,8 @@ bool CausesBrakingIntersectionPredicate::booleanEvaluation(size_t timeStep, cons
                                                            const std::shared_ptr<Obstacle> &obstacleP,
                                                            const std::vector<std::string> &additionalFunctionParameters,
                                                            bool setBased) {
-    if (obstacleP->getAcceleration(timeStep, setBased, true) >= parameters.getParam("aBrakingIntersection"))
+    if (obstacleP->getAcceleration(timeStep, setBased, true) >=
+        parameters.getParam(PredicateParamId::aBrakingIntersection))
         return false;
     std::vector<std::shared_ptr<Lane>> lanesP;
     std::vector<std::shared_ptr<Lane>> lanesK;
@@ -57,8 +58,8 @@ bool CausesBrakingIntersectionPredicate::booleanEvaluation(size_t timeStep, cons
                         }
                 } else
                     distance = pointCCSLon - obstacleP->frontS(timeStep, laneP->getCurvilinearCoordinateSystem());
-                if (parameters.getParam("dCauseBrakingIntersection") <= distance and
-                    distance <= parameters.getParam("dBrakingIntersection"))
+                if (parameters.getParam(PredicateParamId::dCauseBrakingIntersection) <= distance and
+                    distance <= parameters.getParam(PredicateParamId::dBrakingIntersection))
                     return true;
             }
         }
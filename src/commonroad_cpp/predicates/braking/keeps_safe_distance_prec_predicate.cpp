@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <optional>
+
 #include <commonroad_cpp/geometry/rectangle.h>
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/predicates/braking/keeps_safe_distance_prec_predicate.h>
@@ -90,4 +93,67 @@ double KeepsSafeDistancePrecPredicate::robustEvaluation(double lonPosK, double l
     return (deltaS - dSafe);
 }
 
+PredicateEvaluationMatrix KeepsSafeDistancePrecPredicate::batchBooleanEvaluation(
+    size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    bool setBased) {
+    validateObstaclePairs(obstaclePairs);
+    // values of an obstacle as kth obstacle at the current time step
+    struct ValuesK {
+        std::shared_ptr<CurvilinearCoordinateSystem> ccs; //**< curvilinear coordinate system of reference lane */
+        double frontS;                                    //**< longitudinal front position */
+        double velocity;                                  //**< velocity */
+    };
+    PredicateEvaluationMatrix result{firstTimeStep, lastTimeStep, obstaclePairs.size()};
+    const auto roadNetwork{world->getRoadNetwork()};
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    const auto indices{indexObstacles(obstaclePairs, obstacles)};
+    // pth obstacles whose rear positions are computed on the reference coordinate system of each kth obstacle
+    std::vector<std::vector<std::shared_ptr<Obstacle>>> obstaclesP(obstacles.size());
+    for (const auto &[indexK, indexP] : indices)
+        if (indexP < obstacles.size())
+            obstaclesP[indexK].push_back(obstacles[indexP]);
+    std::vector<std::optional<ValuesK>> valuesK(obstacles.size());
+    std::vector<std::optional<double>> velocitiesP(obstacles.size());
+    // as for the scalar evaluation, the minimum distance is only required if the pth obstacle is in front
+    std::optional<double> minDistance;
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep) {
+        std::fill(valuesK.begin(), valuesK.end(), std::nullopt);
+        std::fill(velocitiesP.begin(), velocitiesP.end(), std::nullopt);
+        for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+            if (!existsAtTimeStep(timeStep, obstaclePairs[pairIndex]))
+                continue;
+            const auto [indexK, indexP]{indices[pairIndex]};
+            const auto &obstacleK{obstacles[indexK]};
+            const auto &obstacleP{obstacles[indexP]};
+            auto &valueK{valuesK[indexK]};
+            if (!valueK) {
+                valueK = ValuesK{
+                    obstacleK->getReferenceLane(roadNetwork, timeStep)->getCurvilinearCoordinateSystem(),
+                    obstacleK->frontS(roadNetwork, timeStep), obstacleK->getVelocity(timeStep, false)};
+                // positions of the pth obstacles are projected in one batch instead of one by one within rearS
+                Obstacle::convertPointsToCurvilinear(obstaclesP[indexK], timeStep, valueK->ccs, setBased);
+            }
+            auto &velocityP{velocitiesP[indexP]};
+            if (!velocityP)
+                velocityP = obstacleP->getVelocity(timeStep, setBased, true);
+
+            const double dSafe{computeSafeDistance(valueK->velocity, *velocityP, obstacleK->getAminLong(),
+                                                   obstacleP->getAminLong(), obstacleK->getReactionTime())};
+            const double deltaS{obstacleP->rearS(timeStep, valueK->ccs, setBased) - valueK->frontS};
+            // if pth vehicle is not in front of the kth vehicle, robustness is positive
+            if (deltaS < 0) {
+                result.set(timeStep, pairIndex, true);
+                continue;
+            }
+            if (!minDistance)
+                minDistance = stod(additionalFunctionParameters.at(0));
+            const double robustness{deltaS - *minDistance < 0 ? std::min(deltaS - *minDistance, deltaS - dSafe)
+                                                              : deltaS - dSafe};
+            result.set(timeStep, pairIndex, robustness > 0);
+        }
+    }
+    return result;
+}
+
 KeepsSafeDistancePrecPredicate::KeepsSafeDistancePrecPredicate() : CommonRoadPredicate(true) {}
@@ -1,5 +1,73 @@
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+
+#include <commonroad_cpp/auxiliaryDefs/task_scheduler.h>
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
+#include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/predicates/commonroad_predicate.h>
 
+namespace {
+
+/**
+ * Number of chunks per thread of a vectorized evaluation, so that idle threads can steal work from threads whose
+ * entries are more expensive.
+ */
+constexpr size_t numChunksPerThread{4};
+
+/**
+ * Returns the scheduler of the calling thread for vectorized evaluations with the provided number of threads. The
+ * scheduler is created on first use and kept until the calling thread exits, so that repeated evaluations do not start
+ * and join threads.
+ *
+ * @param numThreads Number of threads.
+ * @return Scheduler with the provided number of threads.
+ */
+TaskScheduler &getScheduler(const size_t numThreads) {
+    thread_local std::unordered_map<size_t, std::unique_ptr<TaskScheduler>> schedulers;
+    auto &scheduler{schedulers[numThreads]};
+    if (scheduler == nullptr)
+        scheduler = std::make_unique<TaskScheduler>(numThreads, false);
+    return *scheduler;
+}
+
+/**
+ * Evaluates entries of a vectorized evaluation, either on the calling thread or in chunks on a task scheduler.
+ *
+ * @param numEntries Number of entries.
+ * @param numThreads Number of threads.
+ * @param evaluate Function evaluating the entry with the provided index.
+ * @return Result of each entry.
+ */
+template <typename T, typename Evaluation>
+std::vector<T> evaluateEntries(const size_t numEntries, const size_t numThreads, const Evaluation &evaluate) {
+    std::vector<T> result(numEntries);
+    if (numThreads <= 1 or numEntries <= 1) {
+        for (size_t idx{0}; idx < numEntries; ++idx)
+            result[idx] = evaluate(idx);
+        return result;
+    }
+    auto &scheduler{getScheduler(numThreads)};
+    const size_t numChunks{std::min(numEntries, numThreads * numChunksPerThread)};
+    const size_t chunkSize{(numEntries + numChunks - 1) / numChunks};
+    for (size_t begin{0}; begin < numEntries; begin += chunkSize)
+        scheduler.submit([&result, &evaluate, begin, end = std::min(begin + chunkSize, numEntries)]() {
+            for (size_t idx{begin}; idx < end; ++idx)
+                result[idx] = evaluate(idx);
+        });
+    scheduler.wait();
+    return result;
+}
+
+} // namespace
+
 bool CommonRoadPredicate::statisticBooleanEvaluation(const size_t timeStep, const std::shared_ptr<World> &world,
                                                      const std::shared_ptr<Obstacle> &obstacleK,
                                                      const std::shared_ptr<Timer> &evaluationTimer,
@@ -7,6 +75,7 @@ bool CommonRoadPredicate::statisticBooleanEvaluation(const size_t timeStep, cons
                                                      const std::shared_ptr<Obstacle> &obstacleP,
                                                      const std::vector<std::string> &additionalFunctionParameters,
                                                      const bool setBased) {
+    ENV_MODEL_TRACE_SPAN(getTraceName(), "predicate");
     const auto startTime{Timer::start()};
     const bool result{booleanEvaluation(timeStep, world, obstacleK, obstacleP, additionalFunctionParameters, setBased)};
     const long compTime{evaluationTimer->stop(startTime)};
@@ -14,6 +83,7 @@ bool CommonRoadPredicate::statisticBooleanEvaluation(const size_t timeStep, cons
     statistics->numExecutions++;
     statistics->totalComputationTime += static_cast<unsigned long>(compTime);
     statistics->computationTime.push_back(static_cast<double>(compTime) / 1e6);
+    statistics->computationTimeHistogram.record(compTime);
     if (result)
         statistics->numSatisfaction++;
 
@@ -31,9 +101,110 @@ bool CommonRoadPredicate::simpleBooleanEvaluation(const size_t timeStep, const s
                                                   const std::shared_ptr<Obstacle> &obstacleP,
                                                   const std::vector<std::string> &additionalFunctionParameters,
                                                   const bool setBased) {
+    ENV_MODEL_TRACE_SPAN(getTraceName(), "predicate");
     return this->booleanEvaluation(timeStep, world, obstacleK, obstacleP, additionalFunctionParameters, setBased);
 }
 
+PredicateEvaluationMatrix CommonRoadPredicate::batchBooleanEvaluation(
+    const size_t firstTimeStep, const size_t lastTimeStep, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    const bool setBased) {
+    ENV_MODEL_TRACE_SPAN(getTraceName(), "predicate");
+    validateObstaclePairs(obstaclePairs);
+    PredicateEvaluationMatrix result{firstTimeStep, lastTimeStep, obstaclePairs.size()};
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep)
+        for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+            const auto &[obstacleK, obstacleP]{obstaclePairs[pairIndex]};
+            if (existsAtTimeStep(timeStep, obstaclePairs[pairIndex]))
+                result.set(timeStep, pairIndex,
+                           booleanEvaluation(timeStep, world, obstacleK, obstacleP, additionalFunctionParameters,
+                                             setBased));
+        }
+    return result;
+}
+
+std::vector<uint8_t> CommonRoadPredicate::vectorizedBooleanEvaluation(
+    const std::vector<size_t> &timeSteps, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    const bool setBased, const size_t numThreads) {
+    ENV_MODEL_TRACE_SPAN(getTraceName(), "predicate");
+    validateEntries(timeSteps, obstaclePairs);
+    return evaluateEntries<uint8_t>(timeSteps.size(), numThreads, [&](const size_t idx) {
+        return static_cast<uint8_t>(booleanEvaluation(timeSteps[idx], world, obstaclePairs[idx].first,
+                                                      obstaclePairs[idx].second, additionalFunctionParameters,
+                                                      setBased));
+    });
+}
+
+std::vector<double> CommonRoadPredicate::vectorizedRobustEvaluation(
+    const std::vector<size_t> &timeSteps, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    const bool setBased, const size_t numThreads) {
+    ENV_MODEL_TRACE_SPAN(getTraceName(), "predicate");
+    validateEntries(timeSteps, obstaclePairs);
+    return evaluateEntries<double>(timeSteps.size(), numThreads, [&](const size_t idx) {
+        return robustEvaluation(timeSteps[idx], world, obstaclePairs[idx].first, obstaclePairs[idx].second,
+                                additionalFunctionParameters, setBased);
+    });
+}
+
+void CommonRoadPredicate::validateEntries(const std::vector<size_t> &timeSteps,
+                                          const std::vector<ObstaclePair> &obstaclePairs) const {
+    if (timeSteps.size() != obstaclePairs.size())
+        throw std::invalid_argument("CommonRoadPredicate::validateEntries: Number of time steps (" +
+                                    std::to_string(timeSteps.size()) + ") and obstacle pairs (" +
+                                    std::to_string(obstaclePairs.size()) + ") differ.");
+    validateObstaclePairs(obstaclePairs);
+    for (size_t idx{0}; idx < timeSteps.size(); ++idx)
+        if (!existsAtTimeStep(timeSteps[idx], obstaclePairs[idx]))
+            throw std::invalid_argument("CommonRoadPredicate::validateEntries: Obstacles of entry " +
+                                        std::to_string(idx) + " do not exist at time step " +
+                                        std::to_string(timeSteps[idx]) + ".");
+}
+
+void CommonRoadPredicate::validateObstaclePairs(const std::vector<ObstaclePair> &obstaclePairs) const {
+    for (size_t idx{0}; idx < obstaclePairs.size(); ++idx)
+        if (obstaclePairs[idx].first == nullptr or (vehicleDependent and obstaclePairs[idx].second == nullptr))
+            throw std::invalid_argument("CommonRoadPredicate::validateObstaclePairs: Obstacle pair " +
+                                        std::to_string(idx) + " is incomplete.");
+}
+
+bool CommonRoadPredicate::existsAtTimeStep(const size_t timeStep, const ObstaclePair &obstaclePair) {
+    return obstaclePair.first->timeStepExists(timeStep) and
+           (obstaclePair.second == nullptr or obstaclePair.second->timeStepExists(timeStep));
+}
+
+std::vector<std::pair<size_t, size_t>>
+CommonRoadPredicate::indexObstacles(const std::vector<ObstaclePair> &obstaclePairs,
+                                    std::vector<std::shared_ptr<Obstacle>> &obstacles) {
+    std::unordered_map<const Obstacle *, size_t> obstacleIndices;
+    for (const auto &[obstacleK, obstacleP] : obstaclePairs)
+        for (const auto &obstacle : {obstacleK, obstacleP})
+            if (obstacle != nullptr and obstacleIndices.try_emplace(obstacle.get(), obstacles.size()).second)
+                obstacles.push_back(obstacle);
+    std::vector<std::pair<size_t, size_t>> indices;
+    indices.reserve(obstaclePairs.size());
+    for (const auto &[obstacleK, obstacleP] : obstaclePairs)
+        indices.emplace_back(obstacleIndices.at(obstacleK.get()),
+                             obstacleP == nullptr ? obstacles.size() : obstacleIndices.at(obstacleP.get()));
+    return indices;
+}
+
 CommonRoadPredicate::~CommonRoadPredicate() = default;
 
 bool CommonRoadPredicate::isVehicleDependent() const { return vehicleDependent; }
+
+const char *CommonRoadPredicate::getTraceName() const {
+    std::call_once(traceNameFlag, [this]() {
+        std::string name{typeid(*this).name()};
+#if __has_include(<cxxabi.h>)
+        int status{0};
+        if (char *demangled{abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status)}; status == 0) {
+            name = demangled;
+            std::free(demangled);
+        }
+#endif
+        traceName = TraceRecorder::internName(name);
+    });
+    return traceName;
+}
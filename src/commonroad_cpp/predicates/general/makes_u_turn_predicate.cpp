@@ -10,7 +10,8 @@ bool MakesUTurnPredicate::booleanEvaluation(size_t timeStep, const std::shared_p
                                             const std::vector<std::string> &additionalFunctionParameters,
                                             bool setBased) {
     auto orientationCcs{std::fabs(obstacleK->getCurvilinearOrientation(world->getRoadNetwork(), timeStep))};
-    return parameters.getParam("uTurnLower") <= orientationCcs and orientationCcs <= parameters.getParam("uTurnUpper");
+    return parameters.getParam(PredicateParamId::uTurnLower) <= orientationCcs and
+           orientationCcs <= parameters.getParam(PredicateParamId::uTurnUpper);
 }
 
 Constraint MakesUTurnPredicate::constraintEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
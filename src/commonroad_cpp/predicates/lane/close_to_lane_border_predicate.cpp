@@ -18,14 +18,14 @@ bool CloseToLaneBorderPredicate::booleanEvaluation(size_t timeStep, const std::s
             return 0.5 * lane->getWidth(obstacleK->getStateByTimeStep(timeStep)->getXPosition(),
                                         obstacleK->getStateByTimeStep(timeStep)->getYPosition()) -
                        obstacleK->leftD(timeStep, lane->getCurvilinearCoordinateSystem()) <=
-                   parameters.getParam("closeToLaneBorder");
+                   parameters.getParam(PredicateParamId::closeToLaneBorder);
         });
     else if (regulatory_elements_utils::matchDirections(additionalFunctionParameters.at(0)) == Direction::right) {
         return std::all_of(lanes.begin(), lanes.end(), [obstacleK, this, timeStep](const std::shared_ptr<Lane> &lane) {
             return 0.5 * lane->getWidth(obstacleK->getStateByTimeStep(timeStep)->getXPosition(),
                                         obstacleK->getStateByTimeStep(timeStep)->getYPosition()) +
                        obstacleK->rightD(timeStep, lane->getCurvilinearCoordinateSystem()) <=
-                   parameters.getParam("closeToLaneBorder");
+                   parameters.getParam(PredicateParamId::closeToLaneBorder);
         });
     }
     throw std::invalid_argument("CloseToLaneBorderPredicate::booleanEvaluation: Unknown side '" +
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <optional>
+#include <set>
+
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane.h>
 #include <commonroad_cpp/world.h>
@@ -18,6 +22,51 @@ bool InSameLanePredicate::booleanEvaluation(size_t timeStep, const std::shared_p
     return false;
 }
 
+PredicateEvaluationMatrix InSameLanePredicate::batchBooleanEvaluation(
+    size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    bool setBased) {
+    validateObstaclePairs(obstaclePairs);
+    PredicateEvaluationMatrix result{firstTimeStep, lastTimeStep, obstaclePairs.size()};
+    const auto roadNetwork{world->getRoadNetwork()};
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    const auto indices{indexObstacles(obstaclePairs, obstacles)};
+    // lanelets of the lanes of the kth obstacle and lanelets occupied by the pth obstacle at the current time step
+    std::vector<std::optional<std::set<size_t>>> laneLaneletIDs(obstacles.size());
+    std::vector<std::optional<std::vector<size_t>>> occupiedLaneletIDs(obstacles.size());
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep) {
+        std::fill(laneLaneletIDs.begin(), laneLaneletIDs.end(), std::nullopt);
+        std::fill(occupiedLaneletIDs.begin(), occupiedLaneletIDs.end(), std::nullopt);
+        for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+            if (!existsAtTimeStep(timeStep, obstaclePairs[pairIndex]))
+                continue;
+            const auto [indexK, indexP]{indices[pairIndex]};
+            auto &relevantIDs{laneLaneletIDs[indexK]};
+            if (!relevantIDs) {
+                relevantIDs.emplace();
+                for (const auto &laneK : obstacles[indexK]->getOccupiedLanesDrivingDirection(roadNetwork, timeStep))
+                    relevantIDs->insert(laneK->getContainedLaneletIDs().begin(), laneK->getContainedLaneletIDs().end());
+            }
+            // as for the scalar evaluation, the occupied lanelets are only computed if the kth obstacle occupies lanes
+            if (relevantIDs->empty()) {
+                result.set(timeStep, pairIndex, false);
+                continue;
+            }
+            auto &laneletIDsP{occupiedLaneletIDs[indexP]};
+            if (!laneletIDsP) {
+                laneletIDsP.emplace();
+                for (const auto &laneletP :
+                     obstacles[indexP]->getOccupiedLaneletsByShape(roadNetwork, timeStep, setBased))
+                    laneletIDsP->push_back(laneletP->getId());
+            }
+            result.set(timeStep, pairIndex,
+                       std::any_of(laneletIDsP->begin(), laneletIDsP->end(),
+                                   [&relevantIDs](size_t laneletID) { return relevantIDs->count(laneletID) == 1; }));
+        }
+    }
+    return result;
+}
+
 double InSameLanePredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
                                              const std::shared_ptr<Obstacle> &obstacleK,
                                              const std::shared_ptr<Obstacle> &obstacleP,
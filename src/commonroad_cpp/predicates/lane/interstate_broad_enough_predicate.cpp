@@ -15,7 +15,7 @@ bool InterstateBroadEnoughPredicate::booleanEvaluation(size_t timeStep, const st
     return std::all_of(occupied_lanelets.begin(), occupied_lanelets.end(),
                        [obsK_x, obsK_y, world, this](const std::shared_ptr<Lanelet> &lanelet) {
                            return lanelet_operations::roadWidth(lanelet, obsK_x, obsK_y) >
-                                  parameters.getParam("minInterstateWidth");
+                                  parameters.getParam(PredicateParamId::minInterstateWidth);
                        });
 }
 
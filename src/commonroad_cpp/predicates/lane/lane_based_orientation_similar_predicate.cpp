@@ -13,7 +13,7 @@ bool LaneBasedOrientationSimilarPredicate::booleanEvaluation(
     return std::abs(geometric_operations::subtractOrientations(
                obstacleK->getCurvilinearOrientation(timeStep, ccsP),
                obstacleP->getCurvilinearOrientation(world->getRoadNetwork(), timeStep))) <
-           parameters.getParam("laneMatchingOrientation");
+           parameters.getParam(PredicateParamId::laneMatchingOrientation);
 }
 
 Constraint LaneBasedOrientationSimilarPredicate::constraintEvaluation(
@@ -12,23 +12,23 @@ bool NarrowRoadPredicate::booleanEvaluation(size_t timeStep, const std::shared_p
     auto occLaneletsRear{obstacleK->getOccupiedLaneletsByFront(world->getRoadNetwork(), timeStep)};
     if (std::all_of(occLaneletsFront.begin(), occLaneletsFront.end(),
                     [this](const std::shared_ptr<Lanelet> &lanelet) {
-                        return lanelet->getMinWidth() > parameters.getParam("narrowRoad");
+                        return lanelet->getMinWidth() > parameters.getParam(PredicateParamId::narrowRoad);
                     }) and
         std::all_of(occLaneletsRear.begin(), occLaneletsRear.end(), [this](const std::shared_ptr<Lanelet> &lanelet) {
-            return lanelet->getMinWidth() > parameters.getParam("narrowRoad");
+            return lanelet->getMinWidth() > parameters.getParam(PredicateParamId::narrowRoad);
         }))
         return false;
     if (std::any_of(occLaneletsFront.begin(), occLaneletsFront.end(),
                     [this, obstacleK, timeStep](const std::shared_ptr<Lanelet> &lanelet) {
                         auto obsPos{obstacleK->getFrontXYCoordinates(timeStep)};
                         return lanelet_operations::roadWidth(lanelet, obsPos.at(0), obsPos.at(1)) <=
-                               parameters.getParam("narrowRoad");
+                               parameters.getParam(PredicateParamId::narrowRoad);
                     }) or
         std::any_of(occLaneletsRear.begin(), occLaneletsRear.end(),
                     [this, obstacleK, timeStep](const std::shared_ptr<Lanelet> &lanelet) {
                         auto obsPos{obstacleK->getBackXYCoordinates(timeStep)};
                         return lanelet_operations::roadWidth(lanelet, obsPos.at(0), obsPos.at(1)) <=
-                               parameters.getParam("narrowRoad");
+                               parameters.getParam(PredicateParamId::narrowRoad);
                     }))
         return true;
     return false;
@@ -1,4 +1,7 @@
 
+#include <algorithm>
+#include <optional>
+
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lanelet.h>
 #include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_light.h>
@@ -22,6 +25,39 @@ bool OnLaneletWithTypePredicate::booleanEvaluation(size_t timeStep, const std::s
                        });
 }
 
+PredicateEvaluationMatrix OnLaneletWithTypePredicate::batchBooleanEvaluation(
+    size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    bool setBased) {
+    validateObstaclePairs(obstaclePairs);
+    PredicateEvaluationMatrix result{firstTimeStep, lastTimeStep, obstaclePairs.size()};
+    const auto roadNetwork{world->getRoadNetwork()};
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    const auto indices{indexObstacles(obstaclePairs, obstacles)};
+    // as for the scalar evaluation, the lanelet type is only required if the obstacle occupies lanelets
+    std::optional<LaneletType> laneletType;
+    std::vector<std::optional<bool>> onLaneletWithType(obstacles.size());
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep) {
+        std::fill(onLaneletWithType.begin(), onLaneletWithType.end(), std::nullopt);
+        for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+            if (!existsAtTimeStep(timeStep, obstaclePairs[pairIndex]))
+                continue;
+            auto &satisfied{onLaneletWithType[indices[pairIndex].first]};
+            if (!satisfied) {
+                const auto lanelets{
+                    obstacles[indices[pairIndex].first]->getOccupiedLaneletsByShape(roadNetwork, timeStep, setBased)};
+                if (!lanelets.empty() and !laneletType)
+                    laneletType = lanelet_operations::matchStringToLaneletType(additionalFunctionParameters.at(0));
+                satisfied = std::any_of(lanelets.begin(), lanelets.end(), [&laneletType](const auto &lanelet) {
+                    return lanelet->hasLaneletType(*laneletType);
+                });
+            }
+            result.set(timeStep, pairIndex, *satisfied);
+        }
+    }
+    return result;
+}
+
 double OnLaneletWithTypePredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
                                                     const std::shared_ptr<Obstacle> &obstacleK,
                                                     const std::shared_ptr<Obstacle> &obstacleP,
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <optional>
+
 #include <commonroad_cpp/geometry/rectangle.h>
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/predicates/position/in_front_of_predicate.h>
@@ -45,4 +48,42 @@ double InFrontOfPredicate::robustEvaluation(double lonPositionP, double lonPosit
     return (lonPositionK - 0.5 * lengthK) - (lonPositionP + 0.5 * lengthP);
 }
 
+PredicateEvaluationMatrix InFrontOfPredicate::batchBooleanEvaluation(
+    size_t firstTimeStep, size_t lastTimeStep, const std::shared_ptr<World> &world,
+    const std::vector<ObstaclePair> &obstaclePairs, const std::vector<std::string> &additionalFunctionParameters,
+    bool setBased) {
+    validateObstaclePairs(obstaclePairs);
+    PredicateEvaluationMatrix result{firstTimeStep, lastTimeStep, obstaclePairs.size()};
+    const auto roadNetwork{world->getRoadNetwork()};
+    std::vector<std::shared_ptr<Obstacle>> obstacles;
+    const auto indices{indexObstacles(obstaclePairs, obstacles)};
+    // kth obstacles whose rear positions are computed on the reference coordinate system of each pth obstacle
+    std::vector<std::vector<std::shared_ptr<Obstacle>>> obstaclesK(obstacles.size());
+    for (const auto &[indexP, indexK] : indices)
+        if (indexK < obstacles.size())
+            obstaclesK[indexP].push_back(obstacles[indexK]);
+    // reference coordinate system and front position of the pth obstacle at the current time step
+    std::vector<std::optional<std::pair<std::shared_ptr<CurvilinearCoordinateSystem>, double>>> references(
+        obstacles.size());
+    for (size_t timeStep{firstTimeStep}; timeStep <= lastTimeStep; ++timeStep) {
+        std::fill(references.begin(), references.end(), std::nullopt);
+        for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+            if (!existsAtTimeStep(timeStep, obstaclePairs[pairIndex]))
+                continue;
+            const auto [indexP, indexK]{indices[pairIndex]};
+            auto &reference{references[indexP]};
+            if (!reference) {
+                reference.emplace(
+                    obstacles[indexP]->getReferenceLane(roadNetwork, timeStep)->getCurvilinearCoordinateSystem(),
+                    obstacles[indexP]->frontS(roadNetwork, timeStep));
+                // positions of the kth obstacles are projected in one batch instead of one by one within rearS
+                Obstacle::convertPointsToCurvilinear(obstaclesK[indexP], timeStep, reference->first, setBased);
+            }
+            result.set(timeStep, pairIndex,
+                       obstacles[indexK]->rearS(timeStep, reference->first, setBased) - reference->second > 0);
+        }
+    }
+    return result;
+}
+
 InFrontOfPredicate::InFrontOfPredicate() : CommonRoadPredicate(true) {}
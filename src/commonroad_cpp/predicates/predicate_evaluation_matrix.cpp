@@ -0,0 +1,38 @@
+#include <stdexcept>
+#include <string>
+
+#include <commonroad_cpp/predicates/predicate_evaluation_matrix.h>
+
+PredicateEvaluationMatrix::PredicateEvaluationMatrix(size_t firstTimeStep, size_t lastTimeStep, size_t numPairs)
+    : firstTimeStep(firstTimeStep), numTimeSteps(lastTimeStep - firstTimeStep + 1), numPairs(numPairs) {
+    if (lastTimeStep < firstTimeStep)
+        throw std::invalid_argument("PredicateEvaluationMatrix: Last time step " + std::to_string(lastTimeStep) +
+                                    " is before first time step " + std::to_string(firstTimeStep) + ".");
+    values.assign(numTimeSteps * numPairs, undefined);
+}
+
+std::optional<bool> PredicateEvaluationMatrix::at(size_t timeStep, size_t pairIndex) const {
+    const auto value{values[index(timeStep, pairIndex)]};
+    if (value == undefined)
+        return std::nullopt;
+    return value == satisfied;
+}
+
+void PredicateEvaluationMatrix::set(size_t timeStep, size_t pairIndex, bool value) {
+    values[index(timeStep, pairIndex)] = value ? satisfied : unsatisfied;
+}
+
+size_t PredicateEvaluationMatrix::getFirstTimeStep() const { return firstTimeStep; }
+
+size_t PredicateEvaluationMatrix::getNumTimeSteps() const { return numTimeSteps; }
+
+size_t PredicateEvaluationMatrix::getNumPairs() const { return numPairs; }
+
+const std::vector<uint8_t> &PredicateEvaluationMatrix::getValues() const { return values; }
+
+size_t PredicateEvaluationMatrix::index(size_t timeStep, size_t pairIndex) const {
+    if (timeStep < firstTimeStep or timeStep - firstTimeStep >= numTimeSteps or pairIndex >= numPairs)
+        throw std::out_of_range("PredicateEvaluationMatrix: Entry for time step " + std::to_string(timeStep) +
+                                " and pair " + std::to_string(pairIndex) + " does not exist.");
+    return (timeStep - firstTimeStep) * numPairs + pairIndex;
+}
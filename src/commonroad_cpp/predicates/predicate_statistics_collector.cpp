@@ -0,0 +1,149 @@
+#include <atomic>
+#include <cstdio>
+
+#include <commonroad_cpp/predicates/predicate_statistics_collector.h>
+
+namespace {
+std::atomic_size_t nextCollectorId{0}; // IDs are never reused so that entries of destroyed collectors are not found
+
+std::string toMilliseconds(long nanoseconds) { return std::to_string(static_cast<double>(nanoseconds) / 1e6); }
+
+std::string averageMilliseconds(const PredicateStatistics &statistics) {
+    if (statistics.numExecutions == 0)
+        return toMilliseconds(0);
+    return std::to_string(static_cast<double>(statistics.totalComputationTime) / 1e6 /
+                          static_cast<double>(statistics.numExecutions));
+}
+
+std::string escapeJson(const std::string &value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char character : value) {
+        if (character == '"' or character == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(character);
+        } else if (static_cast<unsigned char>(character) < 0x20) {
+            char code[7];
+            std::snprintf(code, sizeof(code), "\\u%04x", character);
+            escaped.append(code);
+        } else
+            escaped.push_back(character);
+    }
+    return escaped;
+}
+
+std::string quoteCsv(const std::string &value) {
+    std::string quoted{"\""};
+    quoted.reserve(value.size() + 2);
+    for (const char character : value) {
+        if (character == '"')
+            quoted.push_back('"');
+        quoted.push_back(character);
+    }
+    quoted.push_back('"');
+    return quoted;
+}
+
+void writeCsvRow(std::ostream &stream, const std::string &predicateName, const std::string &scenario,
+                 const PredicateStatistics &statistics) {
+    const auto &histogram{statistics.computationTimeHistogram};
+    stream << quoteCsv(predicateName) << "," << quoteCsv(scenario) << "," << statistics.numExecutions << ","
+           << statistics.numSatisfaction << "," << toMilliseconds(static_cast<long>(statistics.totalComputationTime))
+           << "," << averageMilliseconds(statistics) << "," << toMilliseconds(histogram.getQuantile(0.5)) << ","
+           << toMilliseconds(histogram.getQuantile(0.95)) << "," << toMilliseconds(histogram.getQuantile(0.99)) << ","
+           << toMilliseconds(histogram.getMax()) << "\n";
+}
+
+void writeJsonValues(std::ostream &stream, const PredicateStatistics &statistics) {
+    const auto &histogram{statistics.computationTimeHistogram};
+    stream << "\"num_executions\": " << statistics.numExecutions
+           << ", \"num_satisfactions\": " << statistics.numSatisfaction
+           << ", \"total_computation_time\": " << toMilliseconds(static_cast<long>(statistics.totalComputationTime))
+           << ", \"avg_computation_time\": " << averageMilliseconds(statistics)
+           << ", \"p50_computation_time\": " << toMilliseconds(histogram.getQuantile(0.5))
+           << ", \"p95_computation_time\": " << toMilliseconds(histogram.getQuantile(0.95))
+           << ", \"p99_computation_time\": " << toMilliseconds(histogram.getQuantile(0.99))
+           << ", \"max_computation_time\": " << toMilliseconds(histogram.getMax());
+}
+} // namespace
+
+thread_local std::unordered_map<size_t, PredicateStatisticsCollector::ThreadStatistics *>
+    PredicateStatisticsCollector::threadShards;
+
+PredicateStatisticsCollector::PredicateStatisticsCollector() : id(nextCollectorId++) {}
+
+const std::shared_ptr<PredicateStatistics> &
+PredicateStatisticsCollector::getThreadStatistics(const std::string &predicateName, const std::string &scenario) {
+    auto &statistics{getThreadShard()[{predicateName, scenario}]};
+    if (statistics == nullptr)
+        statistics = std::make_shared<PredicateStatistics>();
+    return statistics;
+}
+
+std::map<PredicateStatisticsCollector::Key, PredicateStatistics> PredicateStatisticsCollector::getStatistics() const {
+    std::map<Key, PredicateStatistics> merged;
+    std::lock_guard lock{mutex};
+    for (const auto &shard : shards)
+        for (const auto &[key, statistics] : *shard)
+            merged[key].merge(*statistics);
+    return merged;
+}
+
+std::map<std::string, PredicateStatistics> PredicateStatisticsCollector::getPredicateStatistics() const {
+    std::map<std::string, PredicateStatistics> merged;
+    for (const auto &[key, statistics] : getStatistics())
+        merged[key.first].merge(statistics);
+    return merged;
+}
+
+void PredicateStatisticsCollector::writeCsv(std::ostream &stream) const {
+    stream << "Predicate Name,Scenario,Num. Executions,Num. Satisfactions,Total Comp. Time,Avg. Comp. Time,"
+              "P50 Comp. Time,P95 Comp. Time,P99 Comp. Time,Max. Comp. Time\n";
+    const auto statistics{getStatistics()};
+    for (const auto &[predicateName, predicateStatistics] : getPredicateStatistics()) {
+        writeCsvRow(stream, predicateName, "all", predicateStatistics);
+        for (auto iter{statistics.lower_bound({predicateName, ""})};
+             iter != statistics.end() and iter->first.first == predicateName; ++iter)
+            writeCsvRow(stream, predicateName, iter->first.second, iter->second);
+    }
+}
+
+void PredicateStatisticsCollector::writeJson(std::ostream &stream) const {
+    const auto statistics{getStatistics()};
+    stream << "{\n  \"unit\": \"ms\",\n  \"predicates\": [";
+    bool firstPredicate{true};
+    for (const auto &[predicateName, predicateStatistics] : getPredicateStatistics()) {
+        stream << (firstPredicate ? "\n" : ",\n") << "    {\"name\": \"" << escapeJson(predicateName) << "\", ";
+        firstPredicate = false;
+        writeJsonValues(stream, predicateStatistics);
+        stream << ",\n     \"scenarios\": [";
+        bool firstScenario{true};
+        for (auto iter{statistics.lower_bound({predicateName, ""})};
+             iter != statistics.end() and iter->first.first == predicateName; ++iter) {
+            stream << (firstScenario ? "\n" : ",\n") << "       {\"name\": \"" << escapeJson(iter->first.second)
+                   << "\", ";
+            firstScenario = false;
+            writeJsonValues(stream, iter->second);
+            stream << "}";
+        }
+        stream << "]}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+void PredicateStatisticsCollector::reset() {
+    std::lock_guard lock{mutex};
+    for (const auto &shard : shards)
+        for (const auto &[key, statistics] : *shard)
+            statistics->reset();
+}
+
+PredicateStatisticsCollector::ThreadStatistics &PredicateStatisticsCollector::getThreadShard() {
+    auto &shard{threadShards[id]};
+    if (shard == nullptr) {
+        std::lock_guard lock{mutex};
+        shards.push_back(std::make_unique<ThreadStatistics>());
+        shard = shards.back().get();
+    }
+    return *shard;
+}
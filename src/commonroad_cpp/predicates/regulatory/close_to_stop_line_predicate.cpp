@@ -21,7 +21,7 @@ bool CloseToStopLinePredicate::booleanEvaluation(size_t timeStep, const std::sha
         if (obstacle_operations::lineInFrontOfObstacle(stopLine->getPoints(), obstacleK, timeStep,
                                                        world->getRoadNetwork()) and
             obstacle_operations::minDistanceToPoint(timeStep, stopLine->getPoints(), obstacleK) <
-                parameters.getParam("closeStopLineDistance"))
+                parameters.getParam(PredicateParamId::closeStopLineDistance))
             return true;
     }
     return false;
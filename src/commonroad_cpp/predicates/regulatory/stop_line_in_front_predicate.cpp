@@ -24,7 +24,7 @@ bool StopLineInFrontPredicate::booleanEvaluation(size_t timeStep, const std::sha
         if (obstacle_operations::lineInFrontOfObstacle(stopLine->getPoints(), obstacleK, timeStep,
                                                        world->getRoadNetwork()) and
             obstacle_operations::minDistanceToPoint(timeStep, stopLine->getPoints(), obstacleK) <
-                parameters.getParam("stopLineDistance"))
+                parameters.getParam(PredicateParamId::stopLineDistance))
             return true;
         return false;
     });
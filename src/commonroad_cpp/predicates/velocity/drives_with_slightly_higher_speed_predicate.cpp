@@ -7,7 +7,7 @@ bool DrivesWithSlightlyHigherSpeedPredicate::booleanEvaluation(
     const std::shared_ptr<Obstacle> &obstacleP, const std::vector<std::string> &additionalFunctionParameters,
     bool setBased) {
     double diff = obstacleK->getVelocity(timeStep, setBased, true) - obstacleP->getVelocity(timeStep, setBased, false);
-    return 0 < diff and diff < parameters.getParam("slightlyHigherSpeedDifference");
+    return 0 < diff and diff < parameters.getParam(PredicateParamId::slightlyHigherSpeedDifference);
 }
 
 Constraint DrivesWithSlightlyHigherSpeedPredicate::constraintEvaluation(
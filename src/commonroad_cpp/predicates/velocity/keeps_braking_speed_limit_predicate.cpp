@@ -7,7 +7,8 @@ bool KeepsBrakingSpeedLimitPredicate::booleanEvaluation(size_t timeStep, const s
                                                         const std::shared_ptr<Obstacle> &obstacleP,
                                                         const std::vector<std::string> &additionalFunctionParameters,
                                                         bool setBased) {
-    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() <= parameters.getParam("brakingSpeedLimit");
+    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() <=
+           parameters.getParam(PredicateParamId::brakingSpeedLimit);
 }
 
 double KeepsBrakingSpeedLimitPredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
@@ -7,7 +7,8 @@ bool KeepsFovSpeedLimitPredicate::booleanEvaluation(size_t timeStep, const std::
                                                     const std::shared_ptr<Obstacle> &obstacleP,
                                                     const std::vector<std::string> &additionalFunctionParameters,
                                                     bool setBased) {
-    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() <= parameters.getParam("fovSpeedLimit");
+    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() <=
+           parameters.getParam(PredicateParamId::fovSpeedLimit);
 }
 
 double KeepsFovSpeedLimitPredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
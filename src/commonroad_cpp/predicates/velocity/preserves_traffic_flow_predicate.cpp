@@ -10,14 +10,16 @@ bool PreservesTrafficFlowPredicate::booleanEvaluation(size_t timeStep, const std
                                                       const std::shared_ptr<Obstacle> &obstacleP,
                                                       const std::vector<std::string> &additionalFunctionParameters,
                                                       bool setBased) {
-    double vMax{std::min({regulatory_elements_utils::speedLimitSuggested(
-                              obstacleK->getOccupiedLaneletsDrivingDirectionByShape(world->getRoadNetwork(), timeStep),
-                              TrafficSignTypes::MAX_SPEED, parameters.getParam("desiredInterstateVelocity"),
-                              parameters.getParam("desiredUrbanVelocity")),
-                          regulatory_elements_utils::typeSpeedLimit(obstacleK->getObstacleType()),
-                          parameters.getParam("brakingSpeedLimit"), parameters.getParam("fovSpeedLimit"),
-                          parameters.getParam("roadConditionSpeedLimit")})};
-    return (vMax - obstacleK->getStateByTimeStep(timeStep)->getVelocity()) < parameters.getParam("minVelocityDif");
+    double vMax{std::min(
+        {regulatory_elements_utils::speedLimitSuggested(
+             obstacleK->getOccupiedLaneletsDrivingDirectionByShape(world->getRoadNetwork(), timeStep),
+             TrafficSignTypes::MAX_SPEED, parameters.getParam(PredicateParamId::desiredInterstateVelocity),
+             parameters.getParam(PredicateParamId::desiredUrbanVelocity)),
+         regulatory_elements_utils::typeSpeedLimit(obstacleK->getObstacleType()),
+         parameters.getParam(PredicateParamId::brakingSpeedLimit), parameters.getParam(PredicateParamId::fovSpeedLimit),
+         parameters.getParam(PredicateParamId::roadConditionSpeedLimit)})};
+    return (vMax - obstacleK->getStateByTimeStep(timeStep)->getVelocity()) <
+           parameters.getParam(PredicateParamId::minVelocityDif);
 }
 
 double PreservesTrafficFlowPredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
@@ -7,7 +7,8 @@ bool ReversesPredicate::booleanEvaluation(size_t timeStep, const std::shared_ptr
                                           const std::shared_ptr<Obstacle> &obstacleK,
                                           const std::shared_ptr<Obstacle> &obstacleP,
                                           const std::vector<std::string> &additionalFunctionParameters, bool setBased) {
-    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() < -parameters.getParam("standstillError");
+    return obstacleK->getStateByTimeStep(timeStep)->getVelocity() <
+           -parameters.getParam(PredicateParamId::standstillError);
 }
 
 Constraint ReversesPredicate::constraintEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
@@ -13,11 +13,12 @@ bool SlowOtherVehiclePredicate::booleanEvaluation(size_t timeStep, const std::sh
     double vMax{std::min(
         {regulatory_elements_utils::speedLimitSuggested(
              obstacleK->getOccupiedLaneletsDrivingDirectionByShape(world->getRoadNetwork(), timeStep, setBased),
-             TrafficSignTypes::MAX_SPEED, parameters.getParam("desiredInterstateVelocity"),
-             parameters.getParam("desiredUrbanVelocity")),
+             TrafficSignTypes::MAX_SPEED, parameters.getParam(PredicateParamId::desiredInterstateVelocity),
+             parameters.getParam(PredicateParamId::desiredUrbanVelocity)),
          regulatory_elements_utils::typeSpeedLimit(obstacleK->getObstacleType()),
-         parameters.getParam("roadConditionSpeedLimit")})};
-    return vMax - obstacleP->getVelocity(timeStep, setBased, false) >= parameters.getParam("minVelocityDif");
+         parameters.getParam(PredicateParamId::roadConditionSpeedLimit)})};
+    return vMax - obstacleP->getVelocity(timeStep, setBased, false) >=
+           parameters.getParam(PredicateParamId::minVelocityDif);
 }
 
 double SlowOtherVehiclePredicate::robustEvaluation(size_t timeStep, const std::shared_ptr<World> &world,
@@ -1,3 +1,4 @@
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/geometry/geometric_operations.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane.h>
 #include <commonroad_cpp/roadNetwork/road_network_config.h>
@@ -33,33 +34,52 @@ const std::shared_ptr<CurvilinearCoordinateSystem> &Lane::getCurvilinearCoordina
     std::unique_lock lock{ccs_lock};
 
     if (!curvilinearCoordinateSystem) {
-        geometry::EigenPolyline temp_path;
+        ENV_MODEL_TRACE_SPAN("Lane::getCurvilinearCoordinateSystem", "lane");
+        const auto path{referencePath.empty() ? computeReferencePath() : referencePath};
         geometry::EigenPolyline reference_path;
-        const auto &centerVertices = getCenterVertices();
-        temp_path.reserve(centerVertices.size());
-        for (auto vert : centerVertices)
-            temp_path.emplace_back(vert.x, vert.y);
-
-        SPDLOG_DEBUG("Reference Path - initial size: {}", temp_path.size());
-        geometry::util::chaikins_corner_cutting(temp_path, RoadNetworkParameters::cornerCuttingRefinements,
-                                                reference_path);
-        SPDLOG_DEBUG("Reference Path - after chaikins_corner_cutting: {} (refinements: {})", reference_path.size(),
-                     refinements);
-
-        geometry::util::resample_polyline(reference_path, RoadNetworkParameters::stepsToResamplePolyline, temp_path);
-
-        SPDLOG_DEBUG("Reference Path - after resampling: {} (step size: {})", temp_path.size(), polyline_step_size);
-
-        reference_path = temp_path;
+        reference_path.reserve(path.size());
+        for (auto vert : path)
+            reference_path.emplace_back(vert.x, vert.y);
 
         curvilinearCoordinateSystem = std::make_shared<CurvilinearCoordinateSystem>(
             reference_path, RoadNetworkParameters::projectionDomainLimit, RoadNetworkParameters::eps1,
             RoadNetworkParameters::eps2, "off", 2);
+        // the precomputed path is only required until the coordinate system exists
+        std::vector<vertex>{}.swap(referencePath);
     }
 
     return curvilinearCoordinateSystem;
 }
 
+std::vector<vertex> Lane::computeReferencePath() const {
+    geometry::EigenPolyline temp_path;
+    geometry::EigenPolyline reference_path;
+    const auto &centerVertices = getCenterVertices();
+    temp_path.reserve(centerVertices.size());
+    for (auto vert : centerVertices)
+        temp_path.emplace_back(vert.x, vert.y);
+
+    SPDLOG_DEBUG("Reference Path - initial size: {}", temp_path.size());
+    geometry::util::chaikins_corner_cutting(temp_path, RoadNetworkParameters::cornerCuttingRefinements, reference_path);
+    SPDLOG_DEBUG("Reference Path - after chaikins_corner_cutting: {} (refinements: {})", reference_path.size(),
+                 refinements);
+
+    geometry::util::resample_polyline(reference_path, RoadNetworkParameters::stepsToResamplePolyline, temp_path);
+
+    SPDLOG_DEBUG("Reference Path - after resampling: {} (step size: {})", temp_path.size(), polyline_step_size);
+
+    std::vector<vertex> path;
+    path.reserve(temp_path.size());
+    for (const auto &point : temp_path)
+        path.push_back({point.x(), point.y()});
+    return path;
+}
+
+void Lane::setReferencePath(std::vector<vertex> path) {
+    std::unique_lock lock{ccs_lock};
+    referencePath = std::move(path);
+}
+
 const std::set<size_t> &Lane::getContainedLaneletIDs() const { return containedLaneletIds; }
 
 bool Lane::containsLanelet(const std::shared_ptr<Lanelet> &lanelet) const { return containsLanelet(lanelet->getId()); }
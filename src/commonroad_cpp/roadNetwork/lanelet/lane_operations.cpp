@@ -2,6 +2,12 @@
 #include "spdlog/spdlog.h"
 
 #include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/geometry/geometric_operations.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane_operations.h>
 
@@ -24,6 +30,7 @@ multi_polygon_type computeCircle(double x, double y) {
 
 std::shared_ptr<Lane> lane_operations::computeLaneFromTwoPoints(const vertex &start, const vertex &end,
                                                                 const std::shared_ptr<RoadNetwork> &roadNetwork) {
+    ENV_MODEL_TRACE_SPAN("lane_operations::computeLaneFromTwoPoints", "lane_operations");
     std::vector<std::shared_ptr<Lanelet>> initialLanelets;
     std::vector<std::shared_ptr<Lanelet>> finalLanelets;
     for (const auto &let : roadNetwork->findOccupiedLaneletsByShape(computeCircle(start.x, start.y))) {
@@ -39,12 +46,16 @@ std::shared_ptr<Lane> lane_operations::computeLaneFromTwoPoints(const vertex &st
 
     for (const auto &slet : initialLanelets) {
         for (const auto &elet : finalLanelets) {
+            if (!roadNetwork->getTopologicalMap()->isReachable(slet->getId(), elet->getId()))
+                continue;
             if (auto path{roadNetwork->getTopologicalMap()->findPaths(slet->getId(), elet->getId(), false)};
                 !path.empty()) {
+                if (auto lane{roadNetwork->findLaneByLaneletSequence(path)})
+                    return lane;
                 std::vector<std::shared_ptr<Lanelet>> laneLanelets;
                 for (const auto &let : path)
                     laneLanelets.push_back(roadNetwork->findLaneletById(let));
-                return createLaneByContainedLanelets(laneLanelets, ++*roadNetwork->getIdCounterRef());
+                return roadNetwork->internLane(createLaneByContainedLanelets(laneLanelets, roadNetwork->generateId()));
             }
         }
     }
@@ -54,200 +65,207 @@ std::shared_ptr<Lane> lane_operations::computeLaneFromTwoPoints(const vertex &st
     return nullptr;
 }
 
-std::vector<std::vector<std::shared_ptr<Lanelet>>> lane_operations::combineLaneletAndSuccessorsToLane(
-    const std::shared_ptr<Lanelet> &curLanelet, const double fov, int numIntersections,
-    const std::vector<std::shared_ptr<Lanelet>> &containedLanelets, const double offset) {
-    std::vector<std::vector<std::shared_ptr<Lanelet>>> lanes;
-    std::vector<std::shared_ptr<Lanelet>> laneletList{containedLanelets};
-    laneletList.push_back(curLanelet);
-    double laneLength{offset}; // neglect initial lanelet
-    for (const auto &lanelet : laneletList)
-        laneLength += lanelet->getPathLength().back();
+namespace {
+
+/**
+ * Extends the lanelet sequence ending at a node of the prefix tree by all successors or predecessors of the lanelet of
+ * the node. The sequence is stored as leaf if it cannot be extended.
+ *
+ * @param tree Prefix tree which is extended.
+ * @param nodeIdx Index of node whose lanelet is at the end of the sequence.
+ * @param laneLength Length of the sequence including the lanelet of the node.
+ * @param numIntersections Number of intersection which still can be considered before the lanelet of the node.
+ * @param fov Field of view defining length of sequences.
+ * @param successors Boolean indicating whether successors or predecessors are followed.
+ * @param numOccurrences Number of occurrences of each lanelet ID in the sequence.
+ */
+void extendLaneletSequences(lane_operations::LaneletSequenceTree &tree, const size_t nodeIdx, const double laneLength,
+                            int numIntersections, const double fov, const bool successors,
+                            std::unordered_map<size_t, size_t> &numOccurrences) {
+    const auto curLanelet{tree.lanelets[nodeIdx]};
     if (curLanelet->hasLaneletType(LaneletType::incoming))
         --numIntersections;
+    const auto &nextLanelets{successors ? curLanelet->getSuccessors() : curLanelet->getPredecessors()};
 
     // check whether it is the last lanelet of the lane, the lane contains no loop, and max length is reached
-    if (!curLanelet->getSuccessors().empty() and
-        !std::any_of(containedLanelets.begin(), containedLanelets.end(),
-                     [curLanelet](const std::shared_ptr<Lanelet> &lanelet) {
-                         return curLanelet->getId() == lanelet->getId();
-                     }) and
-        laneLength < fov and numIntersections >= 0) {
-        for (const auto &lanelet : curLanelet->getSuccessors()) {
+    if (!nextLanelets.empty() and numOccurrences[curLanelet->getId()] == 1 and laneLength < fov and
+        numIntersections >= 0) {
+        for (const auto &lanelet : nextLanelets) {
             // neglect border since this is no real lane
             if (lanelet->hasLaneletType(LaneletType::border))
                 continue;
-            auto newLanes{combineLaneletAndSuccessorsToLane(lanelet, fov, numIntersections, laneletList, offset)};
-            lanes.insert(lanes.end(), newLanes.begin(), newLanes.end());
+            tree.lanelets.push_back(lanelet);
+            tree.parents.push_back(nodeIdx);
+            ++numOccurrences[lanelet->getId()];
+            extendLaneletSequences(tree, tree.lanelets.size() - 1, laneLength + lanelet->getPathLength().back(),
+                                   numIntersections, fov, successors, numOccurrences);
+            --numOccurrences[lanelet->getId()];
         }
     } else
-        return {laneletList};
-    return lanes;
+        tree.leaves.push_back(nodeIdx);
 }
 
+} // namespace
+
+void lane_operations::LaneletSequenceTree::appendSequence(const size_t sequenceIdx, const bool fromRoot,
+                                                          const bool skipRoot,
+                                                          std::vector<std::shared_ptr<Lanelet>> &sequence) const {
+    const auto start{sequence.size()};
+    for (auto nodeIdx{leaves.at(sequenceIdx)};; nodeIdx = parents[nodeIdx]) {
+        if (parents[nodeIdx] == nodeIdx) {
+            if (!skipRoot)
+                sequence.push_back(lanelets[nodeIdx]);
+            break;
+        }
+        sequence.push_back(lanelets[nodeIdx]);
+    }
+    if (fromRoot)
+        std::reverse(sequence.begin() + static_cast<long>(start), sequence.end());
+}
+
+std::vector<std::vector<std::shared_ptr<Lanelet>>> lane_operations::LaneletSequenceTree::extractSequences() const {
+    std::vector<std::vector<std::shared_ptr<Lanelet>>> sequences(leaves.size());
+    for (size_t idx{0}; idx < leaves.size(); ++idx)
+        appendSequence(idx, true, false, sequences[idx]);
+    return sequences;
+}
+
+lane_operations::LaneletSequenceTree
+lane_operations::enumerateLaneletSequences(const std::shared_ptr<Lanelet> &lanelet, const double fov,
+                                           const int numIntersections, const bool successors, const double offset,
+                                           const std::vector<std::shared_ptr<Lanelet>> &containedLanelets) {
+    ENV_MODEL_TRACE_SPAN("lane_operations::enumerateLaneletSequences", "lane_operations");
+    LaneletSequenceTree tree;
+    std::unordered_map<size_t, size_t> numOccurrences;
+    double laneLength{offset}; // neglect initial lanelet
+    for (const auto &let : containedLanelets) {
+        tree.parents.push_back(tree.lanelets.empty() ? 0 : tree.lanelets.size() - 1);
+        tree.lanelets.push_back(let);
+        laneLength += let->getPathLength().back();
+        ++numOccurrences[let->getId()];
+    }
+    tree.parents.push_back(tree.lanelets.empty() ? 0 : tree.lanelets.size() - 1);
+    tree.lanelets.push_back(lanelet);
+    ++numOccurrences[lanelet->getId()];
+    extendLaneletSequences(tree, tree.lanelets.size() - 1, laneLength + lanelet->getPathLength().back(),
+                           numIntersections, fov, successors, numOccurrences);
+    return tree;
+}
+
+std::vector<std::vector<std::shared_ptr<Lanelet>>> lane_operations::combineLaneletAndSuccessorsToLane(
+    const std::shared_ptr<Lanelet> &curLanelet, const double fov, int numIntersections,
+    const std::vector<std::shared_ptr<Lanelet>> &containedLanelets, const double offset) {
+    return enumerateLaneletSequences(curLanelet, fov, numIntersections, true, offset, containedLanelets)
+        .extractSequences();
+}
+
+namespace {
+
+/**
+ * Removes lanes whose lanelets are all contained in another lane.
+ *
+ * @param lanes List of lanes.
+ * @return Lanes which are not part of another lane.
+ */
 std::vector<std::shared_ptr<Lane>> removeSubPartLanes(const std::vector<std::shared_ptr<Lane>> &lanes) {
-    std::vector<std::shared_ptr<Lane>> filteredLanes;
+    // only lanes sharing a lanelet can contain each other
+    std::unordered_map<size_t, std::vector<size_t>> lanesByLanelet;
+    for (size_t idx{0}; idx < lanes.size(); ++idx)
+        for (const auto &letId : lanes[idx]->getContainedLaneletIDs())
+            lanesByLanelet[letId].push_back(idx);
 
+    std::vector<std::shared_ptr<Lane>> filteredLanes;
     for (const auto &lane : lanes) {
-        bool isSubPart = false;
-        for (const auto &otherLane : lanes) {
-            if (lane != otherLane && otherLane->isPartOf(lane)) {
-                isSubPart = true;
-                break;
-            }
-        }
-        if (!isSubPart) {
+        const auto &laneletIds{lane->getContainedLaneletIDs()};
+        const std::vector<size_t> *candidates{nullptr};
+        for (const auto &letId : laneletIds)
+            if (const auto &lanesWithLanelet{lanesByLanelet.at(letId)};
+                candidates == nullptr or lanesWithLanelet.size() < candidates->size())
+                candidates = &lanesWithLanelet;
+        bool isSubPart{false};
+        if (candidates == nullptr)
+            isSubPart = std::any_of(lanes.begin(), lanes.end(),
+                                    [&lane](const std::shared_ptr<Lane> &otherLane) { return lane != otherLane; });
+        else
+            isSubPart = std::any_of(candidates->begin(), candidates->end(), [&lanes, &lane, &laneletIds](size_t idx) {
+                return lane != lanes[idx] and lanes[idx]->getContainedLaneletIDs().size() >= laneletIds.size() and
+                       lanes[idx]->isPartOf(lane);
+            });
+        if (!isSubPart)
             filteredLanes.push_back(lane);
-        }
     }
     return filteredLanes;
 }
 
+} // namespace
+
 std::vector<std::vector<std::shared_ptr<Lanelet>>> lane_operations::combineLaneletAndPredecessorsToLane(
     const std::shared_ptr<Lanelet> &curLanelet, const double fov, int numIntersections,
     std::vector<std::shared_ptr<Lanelet>> containedLanelets, const double offset) {
-
-    std::vector<std::vector<std::shared_ptr<Lanelet>>> lanes;
-    std::vector laneletList{containedLanelets};
-    laneletList.push_back(curLanelet);
-    double laneLength{offset}; // neglect initial lanelet
-    for (const auto &lanelet : laneletList)
-        laneLength += lanelet->getPathLength().back();
-    if (curLanelet->hasLaneletType(LaneletType::incoming))
-        --numIntersections;
-
-    // check whether it is the last lanelet of the lane, the lane contains no loop, and max length is reached
-    if (!curLanelet->getPredecessors().empty() and
-        !std::any_of(containedLanelets.begin(), containedLanelets.end(),
-                     [curLanelet](const std::shared_ptr<Lanelet> &lanelet) {
-                         return curLanelet->getId() == lanelet->getId();
-                     }) and
-        laneLength < fov and numIntersections >= 0) {
-        for (const auto &lanelet : curLanelet->getPredecessors()) {
-            // neglect border since this is no real lane
-            if (lanelet->hasLaneletType(LaneletType::border))
-                continue;
-            auto newLanes{combineLaneletAndPredecessorsToLane(lanelet, fov, numIntersections, laneletList, offset)};
-            lanes.insert(lanes.end(), newLanes.begin(), newLanes.end());
-        }
-    } else
-        return {laneletList};
-
-    return lanes;
+    return enumerateLaneletSequences(curLanelet, fov, numIntersections, false, offset, containedLanelets)
+        .extractSequences();
 }
 
-std::vector<std::shared_ptr<Lane>>
-lane_operations::createLanesBySingleLanelets(const std::vector<std::shared_ptr<Lanelet>> &initialLanelets,
-                                             const std::shared_ptr<RoadNetwork> &roadNetwork, const double fovRear,
-                                             const double fovFront, const int numIntersections, const vertex position) {
-    std::vector<std::shared_ptr<Lane>> lanes;
-
-    // create lanes
-    for (const auto &lanelet : initialLanelets) {
-        // neglect border since this is no real lane
-        if (lanelet->hasLaneletType(LaneletType::border))
+namespace {
+
+/**
+ * Lanelet of a lane together with the direction in which it is traversed.
+ */
+struct LaneLanelet {
+    std::shared_ptr<Lanelet> lanelet; //**< lanelet */
+    bool reverse;                     //**< whether lanelet is traversed against its direction */
+};
+
+/**
+ * Selects the lanelets forming a lane from a list of lanelets. Repeated lanelets are skipped and the selection stops at
+ * the first lanelet which does not start close to the end of the previously selected lanelets.
+ *
+ * @param containedLanelets List of pointers to lanelets.
+ * @return Selected lanelets.
+ */
+std::vector<LaneLanelet> selectLaneLanelets(const std::vector<std::shared_ptr<Lanelet>> &containedLanelets) {
+    std::vector<LaneLanelet> laneLanelets;
+    vertex lastCenterVertex{};
+    for (const auto &lanelet : containedLanelets) {
+        if (std::any_of(laneLanelets.begin(), laneLanelets.end(),
+                        [lanelet](const LaneLanelet &let) { return let.lanelet->getId() == lanelet->getId(); }))
             continue;
-
-        // check for existing lanes
-        auto newLanes{roadNetwork->findLanesByBaseLanelet(lanelet->getId())};
-        if (!newLanes.empty()) {
-            bool existing{false};
-            for (const auto &newLane : newLanes) {
-                const auto idx{newLane->findClosestIndex(position.x, position.y, true)};
-                const double rearLength{newLane->getPathLength().at(idx)};
-                if (const double frontLength{newLane->getPathLength().back() - newLane->getPathLength().at(idx)};
-                    !std::any_of(lanes.begin(), lanes.end(),
-                                 [newLane](const std::shared_ptr<Lane> &lane) {
-                                     return newLane->getContainedLaneletIDs() == lane->getContainedLaneletIDs();
-                                 }) and
-                    (frontLength > fovFront or newLane->getContainedLanelets().back()->getSuccessors().empty()) and
-                    (rearLength > fovRear or newLane->getContainedLanelets().at(0)->getPredecessors().empty())) {
-                    lanes.push_back(newLane);
-                    existing = true;
-                }
-            }
-            if (existing) // lane was already created based on this initial lanelet -> continue with next lanelet
-                continue;
-        }
-
-        const auto idx{lanelet->findClosestIndex(position.x, position.y, true)};
-        auto newLaneSuccessorParts{combineLaneletAndSuccessorsToLane(lanelet, fovFront, numIntersections, {},
-                                                                     -lanelet->getPathLength().at(idx))};
-        auto newLanePredecessorParts{
-            combineLaneletAndPredecessorsToLane(lanelet, fovRear, numIntersections, {},
-                                                lanelet->getPathLength().at(idx) - lanelet->getPathLength().back())};
-        if (!newLaneSuccessorParts.empty() and !newLanePredecessorParts.empty())
-            for (const auto &laneSuc : newLaneSuccessorParts)
-                for (const auto &lanePre : newLanePredecessorParts) {
-                    std::vector<std::shared_ptr<Lanelet>> containedLanelets{lanePre};
-                    std::reverse(containedLanelets.begin(), containedLanelets.end());
-                    containedLanelets.insert(containedLanelets.end(), laneSuc.begin() + 1, laneSuc.end());
-                    if (auto newLane{
-                            createLaneByContainedLanelets(containedLanelets, ++*roadNetwork->getIdCounterRef())};
-                        newLane->getContainedLaneletIDs().find(lanelet->getId()) !=
-                        newLane->getContainedLaneletIDs().end())
-                        newLanes.push_back(newLane);
-                }
-        else if (!newLaneSuccessorParts.empty())
-            for (const auto &laneSuc : newLaneSuccessorParts) {
-                auto newLane{createLaneByContainedLanelets(laneSuc, ++*roadNetwork->getIdCounterRef())};
-                if (newLane->getContainedLaneletIDs().find(lanelet->getId()) != newLane->getContainedLaneletIDs().end())
-                    newLanes.push_back(newLane);
-                newLanes.push_back(newLane);
-            }
-        else
-            for (const auto &lanePre : newLanePredecessorParts) {
-                auto newLane{createLaneByContainedLanelets(lanePre, ++*roadNetwork->getIdCounterRef())};
-                if (newLane->getContainedLaneletIDs().find(lanelet->getId()) != newLane->getContainedLaneletIDs().end())
-                    newLanes.push_back(newLane);
-                newLanes.push_back(newLane);
-            }
-        if (newLanes.empty()) {
-            // required if e.g., initial lanelet not part of new lane, e.g., in sidewalks where successors are wrongly
-            // assigned
-            auto newLanelet{Lanelet(++*roadNetwork->getIdCounterRef(), lanelet->getLeftBorderVertices(),
-                                    lanelet->getRightBorderVertices(), {}, {}, lanelet->getLaneletTypes(),
-                                    lanelet->getUsersOneWay(), lanelet->getUsersBidirectional())};
-            std::vector clanelets{lanelet};
-            newLanes.push_back(std::make_shared<Lane>(clanelets, newLanelet));
-        }
-        newLanes = roadNetwork->addLanes(newLanes, lanelet->getId());
-        for (const auto &newLane : newLanes)
-            if (!std::any_of(lanes.begin(), lanes.end(), [newLane](const std::shared_ptr<Lane> &lane) {
-                    return newLane->getContainedLaneletIDs() == lane->getContainedLaneletIDs();
-                }))
-                lanes.push_back(newLane);
+        bool reverse{false};
+        if (!laneLanelets.empty() and geometric_operations::euclideanDistance2Dim(
+                                          lanelet->getCenterVertices().back(),
+                                          laneLanelets.back().lanelet->getCenterVertices().back()) < 0.1)
+            reverse = true;
+        if (!laneLanelets.empty() and
+            geometric_operations::euclideanDistance2Dim(lanelet->getCenterVertices().front(), lastCenterVertex) > 10)
+            break;
+        // all lanelets except the first one omit their first vertex
+        if (const auto &centerVertices{lanelet->getCenterVertices()};
+            centerVertices.size() > (laneLanelets.empty() ? 0 : 1))
+            lastCenterVertex = reverse ? centerVertices.front() : centerVertices.back();
+        laneLanelets.push_back({lanelet, reverse});
     }
-    return removeSubPartLanes(lanes);
+    return laneLanelets;
 }
 
-std::shared_ptr<Lane>
-lane_operations::createLaneByContainedLanelets(const std::vector<std::shared_ptr<Lanelet>> &containedLanelets,
-                                               const size_t newId) {
+/**
+ * Creates lane object given the selected lanelets which form the lane.
+ *
+ * @param laneLanelets Selected lanelets.
+ * @param newId ID of new lane.
+ * @return Pointer to new lane.
+ */
+std::shared_ptr<Lane> createLaneBySelectedLanelets(const std::vector<LaneLanelet> &laneLanelets, const size_t newId) {
     std::set<ObstacleType> userOneWay;
     std::set<ObstacleType> userBidirectional;
-    std::vector<vertex> centerVertices;
     std::vector<vertex> leftVertices;
     std::vector<vertex> rightVertices;
     std::set<LaneletType> typeList;
     long shift{0};
 
     std::vector<std::shared_ptr<Lanelet>> containedLaneletsWithoutDuplicates;
+    containedLaneletsWithoutDuplicates.reserve(laneLanelets.size());
 
-    for (const auto &lanelet : containedLanelets) {
-        if (std::any_of(containedLaneletsWithoutDuplicates.begin(), containedLaneletsWithoutDuplicates.end(),
-                        [lanelet](const std::shared_ptr<Lanelet> &let) { return let->getId() == lanelet->getId(); }))
-            continue;
-        bool reverse{false};
-        if (!containedLaneletsWithoutDuplicates.empty() and
-            geometric_operations::euclideanDistance2Dim(
-                lanelet->getCenterVertices().back(),
-                containedLaneletsWithoutDuplicates.back()->getCenterVertices().back()) < 0.1)
-            reverse = true;
-        if (!containedLaneletsWithoutDuplicates.empty() and
-            geometric_operations::euclideanDistance2Dim(lanelet->getCenterVertices().front(), centerVertices.back()) >
-                10)
-            break;
+    for (const auto &[lanelet, reverse] : laneLanelets) {
         containedLaneletsWithoutDuplicates.push_back(lanelet);
         std::set_intersection(userOneWay.begin(), userOneWay.end(), lanelet->getUsersOneWay().begin(),
                               lanelet->getUsersOneWay().end(), std::inserter(userOneWay, userOneWay.begin()));
@@ -257,16 +275,11 @@ lane_operations::createLaneByContainedLanelets(const std::vector<std::shared_ptr
                               std::inserter(userBidirectional, userBidirectional.begin()));
 
         if (reverse) {
-            centerVertices.insert(centerVertices.end(), lanelet->getCenterVertices().rbegin() + shift,
-                                  lanelet->getCenterVertices().rend());
             leftVertices.insert(leftVertices.end(), lanelet->getLeftBorderVertices().rbegin() + shift,
                                 lanelet->getLeftBorderVertices().rend());
             rightVertices.insert(rightVertices.end(), lanelet->getRightBorderVertices().rbegin() + shift,
                                  lanelet->getRightBorderVertices().rend());
         } else {
-            centerVertices.insert(centerVertices.end(), lanelet->getCenterVertices().begin() + shift,
-                                  lanelet->getCenterVertices().end());
-
             leftVertices.insert(leftVertices.end(), lanelet->getLeftBorderVertices().begin() + shift,
                                 lanelet->getLeftBorderVertices().end());
 
@@ -284,6 +297,259 @@ lane_operations::createLaneByContainedLanelets(const std::vector<std::shared_ptr
     return std::make_shared<Lane>(containedLaneletsWithoutDuplicates, newLanelet);
 }
 
+/**
+ * Collects existing lanes which were created based on the given lanelet. If a collected lane covers the field of view,
+ * it is added to the provided list of lanes.
+ *
+ * @param lanelet Initial lanelet.
+ * @param roadNetwork Pointer to road network.
+ * @param fovRear Field of view behind obstacle which defines length of lanes.
+ * @param fovFront Field of view in front of obstacle which defines length of lanes.
+ * @param position Position which should be used as offset.
+ * @param lanes List of lanes to which covering lanes are added.
+ * @param baseLanes List to which all existing lanes based on the lanelet are written.
+ * @return Boolean indicating whether an existing lane covers the field of view.
+ */
+bool collectExistingLanes(const std::shared_ptr<Lanelet> &lanelet, const std::shared_ptr<RoadNetwork> &roadNetwork,
+                          const double fovRear, const double fovFront, const vertex &position,
+                          std::vector<std::shared_ptr<Lane>> &lanes, std::vector<std::shared_ptr<Lane>> &baseLanes) {
+    baseLanes = roadNetwork->findLanesByBaseLanelet(lanelet->getId());
+    bool existing{false};
+    for (const auto &newLane : baseLanes) {
+        const auto idx{newLane->findClosestIndex(position.x, position.y, true)};
+        const double rearLength{newLane->getPathLength().at(idx)};
+        if (const double frontLength{newLane->getPathLength().back() - newLane->getPathLength().at(idx)};
+            !std::any_of(lanes.begin(), lanes.end(),
+                         [newLane](const std::shared_ptr<Lane> &lane) {
+                             return newLane->getContainedLaneletIDs() == lane->getContainedLaneletIDs();
+                         }) and
+            (frontLength > fovFront or newLane->getContainedLanelets().back()->getSuccessors().empty()) and
+            (rearLength > fovRear or newLane->getContainedLanelets().at(0)->getPredecessors().empty())) {
+            lanes.push_back(newLane);
+            existing = true;
+        }
+    }
+    return existing;
+}
+
+/**
+ * Lanelets of a lane which has not been created yet.
+ */
+struct LaneCandidate {
+    std::vector<LaneLanelet> laneLanelets; //**< selected lanelets of lane */
+    lanelet_id_set laneletIds;             //**< IDs of selected lanelets */
+    bool singleLanelet{false}; //**< whether lane is created from the borders of the only lanelet as fallback */
+};
+
+/**
+ * Collects the lanelets of the new lanes originating from a single lanelet. Combinations resulting in the same set of
+ * lanelets are only collected once since the road network stores a single lane per set of lanelets.
+ *
+ * @param lanelet Initial lanelet.
+ * @param fovRear Field of view behind obstacle which defines length of lanes.
+ * @param fovFront Field of view in front of obstacle which defines length of lanes.
+ * @param numIntersections Number of intersection which still can be considered for lane creation.
+ * @param position Position which should be used as offset.
+ * @param hasExistingLanes Boolean indicating whether lanes based on the lanelet exist already.
+ * @param candidates List to which lane candidates are appended.
+ */
+void collectLaneCandidates(const std::shared_ptr<Lanelet> &lanelet, const double fovRear, const double fovFront,
+                           const int numIntersections, const vertex &position, const bool hasExistingLanes,
+                           std::vector<LaneCandidate> &candidates) {
+    const auto idx{lanelet->findClosestIndex(position.x, position.y, true)};
+    const auto successorParts{lane_operations::enumerateLaneletSequences(lanelet, fovFront, numIntersections, true,
+                                                                         -lanelet->getPathLength().at(idx))};
+    const auto predecessorParts{lane_operations::enumerateLaneletSequences(
+        lanelet, fovRear, numIntersections, false, lanelet->getPathLength().at(idx) - lanelet->getPathLength().back())};
+
+    std::unordered_set<lanelet_id_set, boost::hash<lanelet_id_set>> collectedLaneletIds;
+    std::vector<std::shared_ptr<Lanelet>> containedLanelets;
+    const auto addCandidate{[&](const bool requireInitialLanelet) {
+        LaneCandidate candidate{selectLaneLanelets(containedLanelets), {}};
+        for (const auto &let : candidate.laneLanelets)
+            candidate.laneletIds.insert(let.lanelet->getId());
+        if ((!requireInitialLanelet or candidate.laneletIds.find(lanelet->getId()) != candidate.laneletIds.end()) and
+            collectedLaneletIds.insert(candidate.laneletIds).second)
+            candidates.push_back(std::move(candidate));
+    }};
+
+    if (!successorParts.leaves.empty() and !predecessorParts.leaves.empty())
+        for (size_t sucIdx{0}; sucIdx < successorParts.leaves.size(); ++sucIdx)
+            for (size_t preIdx{0}; preIdx < predecessorParts.leaves.size(); ++preIdx) {
+                containedLanelets.clear();
+                predecessorParts.appendSequence(preIdx, false, false, containedLanelets);
+                successorParts.appendSequence(sucIdx, true, true, containedLanelets);
+                addCandidate(true);
+            }
+    else if (!successorParts.leaves.empty())
+        for (size_t sucIdx{0}; sucIdx < successorParts.leaves.size(); ++sucIdx) {
+            containedLanelets.clear();
+            successorParts.appendSequence(sucIdx, true, false, containedLanelets);
+            addCandidate(false);
+        }
+    else
+        for (size_t preIdx{0}; preIdx < predecessorParts.leaves.size(); ++preIdx) {
+            containedLanelets.clear();
+            predecessorParts.appendSequence(preIdx, true, false, containedLanelets);
+            addCandidate(false);
+        }
+
+    // required if e.g., initial lanelet not part of new lane, e.g., in sidewalks where successors are wrongly assigned
+    if (candidates.empty() and !hasExistingLanes)
+        candidates.push_back({{{lanelet, false}}, {lanelet->getId()}, true});
+}
+
+/**
+ * Creates lane object for lane candidate.
+ *
+ * @param candidate Lane candidate.
+ * @param newId ID of new lane.
+ * @return Pointer to new lane.
+ */
+std::shared_ptr<Lane> createLaneByCandidate(const LaneCandidate &candidate, const size_t newId) {
+    if (!candidate.singleLanelet)
+        return createLaneBySelectedLanelets(candidate.laneLanelets, newId);
+    const auto &lanelet{candidate.laneLanelets.front().lanelet};
+    auto newLanelet{Lanelet(newId, lanelet->getLeftBorderVertices(), lanelet->getRightBorderVertices(), {}, {},
+                            lanelet->getLaneletTypes(), lanelet->getUsersOneWay(), lanelet->getUsersBidirectional())};
+    std::vector clanelets{lanelet};
+    return std::make_shared<Lane>(clanelets, newLanelet);
+}
+
+} // namespace
+
+std::vector<std::shared_ptr<Lane>>
+lane_operations::createLanesBySingleLanelets(const std::vector<std::shared_ptr<Lanelet>> &initialLanelets,
+                                             const std::shared_ptr<RoadNetwork> &roadNetwork, const double fovRear,
+                                             const double fovFront, const int numIntersections, const vertex position) {
+    ENV_MODEL_TRACE_SPAN("lane_operations::createLanesBySingleLanelets", "lane_operations");
+    std::vector<std::shared_ptr<Lane>> lanes;
+
+    // create lanes
+    for (const auto &lanelet : initialLanelets) {
+        // neglect border since this is no real lane
+        if (lanelet->hasLaneletType(LaneletType::border))
+            continue;
+
+        // check for existing lanes
+        std::vector<std::shared_ptr<Lane>> newLanes;
+        if (collectExistingLanes(lanelet, roadNetwork, fovRear, fovFront, position, lanes, newLanes))
+            continue; // lane was already created based on this initial lanelet -> continue with next lanelet
+
+        std::vector<LaneCandidate> candidates;
+        collectLaneCandidates(lanelet, fovRear, fovFront, numIntersections, position, !newLanes.empty(), candidates);
+        for (const auto &candidate : candidates)
+            if (auto existingLane{roadNetwork->findLaneByContainedLanelets(candidate.laneletIds)})
+                newLanes.push_back(existingLane);
+            else
+                newLanes.push_back(createLaneByCandidate(candidate, roadNetwork->generateId()));
+        newLanes = roadNetwork->addLanes(newLanes, lanelet->getId());
+        for (const auto &newLane : newLanes)
+            if (!std::any_of(lanes.begin(), lanes.end(), [newLane](const std::shared_ptr<Lane> &lane) {
+                    return newLane->getContainedLaneletIDs() == lane->getContainedLaneletIDs();
+                }))
+                lanes.push_back(newLane);
+    }
+    return removeSubPartLanes(lanes);
+}
+
+void lane_operations::createLanesForAllLanelets(const std::vector<std::shared_ptr<Lanelet>> &initialLanelets,
+                                                const std::shared_ptr<RoadNetwork> &roadNetwork, const double fovRear,
+                                                const double fovFront, const int numIntersections,
+                                                const vertex position, const size_t numThreads) {
+    ENV_MODEL_TRACE_SPAN("lane_operations::createLanesForAllLanelets", "lane_operations");
+    const auto threads{static_cast<int>(numThreads == 0 ? std::max(1U, std::thread::hardware_concurrency())
+                                                          : numThreads)};
+    // lazily computed lanelet properties are initialized upfront since lanelets are shared among threads
+    for (const auto &lanelet : roadNetwork->getLaneletNetwork())
+        lanelet->getPathLength();
+
+    // the lanelets of the new lanes are collected concurrently
+    const auto numLanelets{static_cast<long>(initialLanelets.size())};
+    std::vector<std::vector<std::shared_ptr<Lane>>> newLanes(initialLanelets.size());
+    std::vector<std::vector<LaneCandidate>> candidates(initialLanelets.size());
+    std::vector<char> skip(initialLanelets.size(), 0);
+    std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic) num_threads(threads)
+    for (long idx = 0; idx < numLanelets; ++idx) {
+        const auto lIdx{static_cast<size_t>(idx)};
+        const auto &lanelet{initialLanelets[lIdx]};
+        // neglect border since this is no real lane
+        if (lanelet->hasLaneletType(LaneletType::border)) {
+            skip[lIdx] = 1;
+            continue;
+        }
+        try {
+            std::vector<std::shared_ptr<Lane>> coveringLanes;
+            if (collectExistingLanes(lanelet, roadNetwork, fovRear, fovFront, position, coveringLanes,
+                                     newLanes[lIdx])) {
+                skip[lIdx] = 1;
+                continue;
+            }
+            collectLaneCandidates(lanelet, fovRear, fovFront, numIntersections, position, !newLanes[lIdx].empty(),
+                                  candidates[lIdx]);
+        } catch (...) {
+            // exceptions must not leave the parallel region -> rethrown afterwards
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    // each set of lanelets is created only once and IDs follow the order of the initial lanelets so that the result
+    // equals sequential creation
+    std::unordered_map<lanelet_id_set, size_t, boost::hash<lanelet_id_set>> laneIndices;
+    std::vector<std::shared_ptr<Lane>> lanes;
+    std::vector<const LaneCandidate *> createdCandidates;
+    std::vector<size_t> createdLaneIndices;
+    std::vector<std::vector<size_t>> laneletLaneIndices(initialLanelets.size());
+    for (size_t idx{0}; idx < initialLanelets.size(); ++idx)
+        for (const auto &candidate : candidates[idx]) {
+            auto [laneIdx, inserted]{laneIndices.try_emplace(candidate.laneletIds, lanes.size())};
+            if (inserted) {
+                lanes.push_back(roadNetwork->findLaneByContainedLanelets(candidate.laneletIds));
+                if (lanes.back() == nullptr) {
+                    createdCandidates.push_back(&candidate);
+                    createdLaneIndices.push_back(laneIdx->second);
+                }
+            }
+            laneletLaneIndices[idx].push_back(laneIdx->second);
+        }
+
+    // the lane geometry is computed concurrently
+    const auto firstId{createdCandidates.empty() ? 0 : roadNetwork->reserveIds(createdCandidates.size())};
+    const auto numCreatedLanes{static_cast<long>(createdCandidates.size())};
+#pragma omp parallel for schedule(dynamic) num_threads(threads)
+    for (long idx = 0; idx < numCreatedLanes; ++idx) {
+        const auto cIdx{static_cast<size_t>(idx)};
+        try {
+            lanes[createdLaneIndices[cIdx]] = createLaneByCandidate(*createdCandidates[cIdx], firstId + cIdx);
+        } catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    for (size_t idx{0}; idx < initialLanelets.size(); ++idx) {
+        if (skip[idx] != 0)
+            continue;
+        for (const auto &laneIdx : laneletLaneIndices[idx])
+            newLanes[idx].push_back(lanes[laneIdx]);
+        roadNetwork->addLanes(newLanes[idx], initialLanelets[idx]->getId());
+    }
+}
+
+std::shared_ptr<Lane>
+lane_operations::createLaneByContainedLanelets(const std::vector<std::shared_ptr<Lanelet>> &containedLanelets,
+                                               const size_t newId) {
+    return createLaneBySelectedLanelets(selectLaneLanelets(containedLanelets), newId);
+}
+
 std::vector<std::shared_ptr<Lanelet>>
 lane_operations::extractLaneletsFromLanes(const std::vector<std::shared_ptr<Lane>> &lanes) {
     std::unordered_set<size_t> ids;
@@ -1,11 +1,16 @@
 #include "commonroad_cpp/roadNetwork/lanelet/lanelet_operations.h"
 
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/geometry/geometric_operations.h>
+#include <commonroad_cpp/geometry/oriented_bounding_box.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lanelet.h>
 #include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_sign.h>
 #include <utility>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <optional>
 
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/simplify.hpp>
@@ -18,6 +23,132 @@
 
 namespace bg = boost::geometry;
 
+namespace {
+
+// number of consecutive center vertices covered by one bounding box
+constexpr size_t centerLineBlockSize{32};
+// center lines with fewer vertices are scanned without acceleration structure
+constexpr size_t minIndexedCenterVertices{4 * centerLineBlockSize};
+// relative tolerance covering rounding differences between lower bounds and distances
+constexpr double lowerBoundTolerance{1e-9};
+// maximum distance between the outer polygon and the lanelet borders introduced by simplification
+constexpr double outerPolygonSimplificationTolerance{0.01};
+// distance to the borders within which intersections are not decided by the convex segments
+constexpr double segmentIntersectionMargin{outerPolygonSimplificationTolerance + 1e-6};
+
+} // namespace
+
+struct Lanelet::CenterLineIndex {
+    std::vector<double> xCoordinates; //**< x-coordinate of each center vertex */
+    std::vector<double> yCoordinates; //**< y-coordinate of each center vertex */
+    std::vector<double> blockMinX;    //**< minimum x-coordinate of each block */
+    std::vector<double> blockMaxX;    //**< maximum x-coordinate of each block */
+    std::vector<double> blockMinY;    //**< minimum y-coordinate of each block */
+    std::vector<double> blockMaxY;    //**< maximum y-coordinate of each block */
+    bool finite{true};                //**< whether all coordinates are finite so that blocks can be skipped */
+
+    /**
+     * Constructor creating the coordinate arrays and block bounding boxes.
+     *
+     * @param vertices Center vertices.
+     */
+    explicit CenterLineIndex(const std::vector<vertex> &vertices) {
+        xCoordinates.reserve(vertices.size());
+        yCoordinates.reserve(vertices.size());
+        for (const auto &vert : vertices) {
+            xCoordinates.push_back(vert.x);
+            yCoordinates.push_back(vert.y);
+            finite = finite and std::isfinite(vert.x) and std::isfinite(vert.y);
+        }
+        for (size_t begin{0}; begin < vertices.size(); begin += centerLineBlockSize) {
+            const auto end{std::min(begin + centerLineBlockSize, vertices.size())};
+            const auto [minX, maxX]{std::minmax_element(xCoordinates.begin() + begin, xCoordinates.begin() + end)};
+            const auto [minY, maxY]{std::minmax_element(yCoordinates.begin() + begin, yCoordinates.begin() + end)};
+            blockMinX.push_back(*minX);
+            blockMaxX.push_back(*maxX);
+            blockMinY.push_back(*minY);
+            blockMaxY.push_back(*maxY);
+        }
+    }
+
+    /**
+     * Updates the closest vertex with the vertices of a range. For vertices with equal distance the smaller index
+     * is kept, so that the result does not depend on the order in which ranges are scanned.
+     *
+     * @param positionX X-position of point of interest.
+     * @param positionY Y-position of point of interest.
+     * @param begin First index of range.
+     * @param end Index after the last index of range.
+     * @param minimumDiff Squared distance of closest vertex found so far.
+     * @param minimumIndex Index of closest vertex found so far.
+     */
+    void scan(double positionX, double positionY, size_t begin, size_t end, double &minimumDiff,
+              size_t &minimumIndex) const {
+        const auto *xCoords{xCoordinates.data()};
+        const auto *yCoords{yCoordinates.data()};
+        for (size_t i{begin}; i < end; ++i) {
+            const double diffX{xCoords[i] - positionX};
+            const double diffY{yCoords[i] - positionY};
+            const double squaredDiff{diffX * diffX + diffY * diffY};
+            if (squaredDiff < minimumDiff or (squaredDiff == minimumDiff and i < minimumIndex)) {
+                minimumDiff = squaredDiff;
+                minimumIndex = i;
+            }
+        }
+    }
+
+    /**
+     * Computes a lower bound of the squared distance between a point and the vertices of a block.
+     *
+     * @param positionX X-position of point of interest.
+     * @param positionY Y-position of point of interest.
+     * @param block Index of block.
+     * @return Squared distance to bounding box of block.
+     */
+    [[nodiscard]] double lowerBound(double positionX, double positionY, size_t block) const {
+        const double diffX{std::max({blockMinX[block] - positionX, positionX - blockMaxX[block], 0.0})};
+        const double diffY{std::max({blockMinY[block] - positionY, positionY - blockMaxY[block], 0.0})};
+        return (diffX * diffX + diffY * diffY) * (1.0 - lowerBoundTolerance);
+    }
+
+    /**
+     * Finds closest vertex among the first vertices. The block with the closest bounding box is scanned first, so
+     * that most other blocks can be skipped based on their lower bound.
+     *
+     * @param positionX X-position of point of interest.
+     * @param positionY Y-position of point of interest.
+     * @param numVertices Number of vertices to consider.
+     * @return Index of closest vertex.
+     */
+    [[nodiscard]] size_t findClosestIndex(double positionX, double positionY, size_t numVertices) const {
+        double minimumDiff{std::numeric_limits<double>::infinity()};
+        size_t minimumIndex{0};
+        if (!finite or !std::isfinite(positionX) or !std::isfinite(positionY)) {
+            scan(positionX, positionY, 0, numVertices, minimumDiff, minimumIndex);
+            return minimumIndex;
+        }
+
+        const auto numBlocks{(numVertices + centerLineBlockSize - 1) / centerLineBlockSize};
+        size_t startBlock{0};
+        double minimumBound{std::numeric_limits<double>::infinity()};
+        for (size_t block{0}; block < numBlocks; ++block) {
+            if (const auto bound{lowerBound(positionX, positionY, block)}; bound < minimumBound) {
+                minimumBound = bound;
+                startBlock = block;
+            }
+        }
+        const auto scanBlock{[&](size_t block) {
+            scan(positionX, positionY, block * centerLineBlockSize,
+                 std::min((block + 1) * centerLineBlockSize, numVertices), minimumDiff, minimumIndex);
+        }};
+        scanBlock(startBlock);
+        for (size_t block{0}; block < numBlocks; ++block)
+            if (block != startBlock and lowerBound(positionX, positionY, block) <= minimumDiff)
+                scanBlock(block);
+        return minimumIndex;
+    }
+};
+
 Lanelet::Lanelet(size_t laneletId, std::vector<vertex> leftBorder, std::vector<vertex> rightBorder,
                  std::set<LaneletType> type, std::set<ObstacleType> oneWayUsers,
                  std::set<ObstacleType> bidirectionalUsers)
@@ -40,6 +171,133 @@ Lanelet::Lanelet(size_t laneletId, std::vector<vertex> leftBorder, std::vector<v
     constructOuterPolygon();
 }
 
+struct Lanelet::ConvexSegments {
+    /**
+     * Convex polygon with precomputed edge normals.
+     */
+    struct Segment {
+        std::vector<vertex> vertices; //**< vertices in counter-clockwise order */
+        std::vector<vertex> normals;  //**< outward unit normal of each edge */
+        std::vector<double> offsets;  //**< projection of each edge onto its normal */
+        box bounds{};                 //**< axis-aligned bounding box */
+    };
+
+    std::vector<Segment> segments; //**< segments in order of the border vertices */
+    bool valid{true};              //**< whether all segments are convex and have the same orientation */
+
+    /**
+     * Constructor creating the segments between consecutive border vertices. The segments are invalid if the borders
+     * have different numbers of vertices or a segment is not convex.
+     *
+     * @param leftBorder Vertices of left border.
+     * @param rightBorder Vertices of right border.
+     */
+    ConvexSegments(const std::vector<vertex> &leftBorder, const std::vector<vertex> &rightBorder) {
+        if (leftBorder.size() != rightBorder.size() or leftBorder.size() < 2) {
+            valid = false;
+            return;
+        }
+        double orientation{0.0};
+        for (size_t idx{0}; idx + 1 < leftBorder.size(); ++idx) {
+            Segment segment;
+            for (const auto &vert : {leftBorder[idx], leftBorder[idx + 1], rightBorder[idx + 1], rightBorder[idx]})
+                if (segment.vertices.empty() or segment.vertices.back().x != vert.x or
+                    segment.vertices.back().y != vert.y)
+                    segment.vertices.push_back(vert);
+            if (segment.vertices.front().x == segment.vertices.back().x and
+                segment.vertices.front().y == segment.vertices.back().y)
+                segment.vertices.pop_back();
+
+            double area{0.0};
+            for (size_t vertIdx{0}; vertIdx < segment.vertices.size(); ++vertIdx) {
+                const auto &vert{segment.vertices[vertIdx]};
+                const auto &next{segment.vertices[(vertIdx + 1) % segment.vertices.size()]};
+                area += vert.x * next.y - next.x * vert.y;
+            }
+            // all segments must have the same orientation, otherwise the borders overlap
+            if (segment.vertices.size() < 3 or area == 0.0 or area * orientation < 0.0) {
+                valid = false;
+                return;
+            }
+            orientation = area;
+            if (area < 0.0)
+                std::reverse(segment.vertices.begin(), segment.vertices.end());
+
+            const auto numVertices{segment.vertices.size()};
+            for (size_t vertIdx{0}; vertIdx < numVertices; ++vertIdx) {
+                const auto &vert{segment.vertices[vertIdx]};
+                const auto &next{segment.vertices[(vertIdx + 1) % numVertices]};
+                const auto &nextNext{segment.vertices[(vertIdx + 2) % numVertices]};
+                if ((next.x - vert.x) * (nextNext.y - next.y) - (next.y - vert.y) * (nextNext.x - next.x) < 0.0) {
+                    valid = false;
+                    return;
+                }
+                const vertex edge{next - vert};
+                const vertex normal{vertex{edge.y, -edge.x} / std::hypot(edge.x, edge.y)};
+                segment.normals.push_back(normal);
+                segment.offsets.push_back(normal.x * vert.x + normal.y * vert.y);
+            }
+            const auto [minX, maxX]{std::minmax_element(segment.vertices.begin(), segment.vertices.end(),
+                                                        [](const auto &a, const auto &b) { return a.x < b.x; })};
+            const auto [minY, maxY]{std::minmax_element(segment.vertices.begin(), segment.vertices.end(),
+                                                        [](const auto &a, const auto &b) { return a.y < b.y; })};
+            segment.bounds = box{point_type{minX->x, minY->y}, point_type{maxX->x, maxY->y}};
+            segments.push_back(std::move(segment));
+        }
+    }
+
+    /**
+     * Computes the distance of a point to the border of a segment.
+     *
+     * @param segment Segment.
+     * @param point Point of interest.
+     * @return Distance to closest edge line; positive if point is inside of segment.
+     */
+    static double depth(const Segment &segment, const vertex &point) {
+        double minDepth{std::numeric_limits<double>::infinity()};
+        for (size_t idx{0}; idx < segment.normals.size(); ++idx)
+            minDepth = std::min(minDepth, segment.offsets[idx] - (segment.normals[idx].x * point.x +
+                                                                  segment.normals[idx].y * point.y));
+        return minDepth;
+    }
+
+    /**
+     * Checks whether a rectangle intersects with the outer polygon of the lanelet. Since the outer polygon deviates
+     * from the segments by at most the simplification tolerance, the rectangle intersects if a point of the rectangle
+     * lies within a segment farther than the tolerance from its border, and does not intersect if all segments are
+     * farther away than the tolerance.
+     *
+     * @param boundingBox Rectangle as oriented bounding box.
+     * @return Boolean indicating whether rectangle intersects or std::nullopt if this cannot be decided.
+     */
+    [[nodiscard]] std::optional<bool> intersects(const OrientedBoundingBox &boundingBox) const {
+        const auto bounds{boundingBox.getAxisAlignedBoundingBox()};
+        const auto center{boundingBox.getCenter()};
+        bool decided{true};
+        for (const auto &segment : segments) {
+            if (segment.bounds.ll.x() - bounds.ur.x() > segmentIntersectionMargin or
+                bounds.ll.x() - segment.bounds.ur.x() > segmentIntersectionMargin or
+                segment.bounds.ll.y() - bounds.ur.y() > segmentIntersectionMargin or
+                bounds.ll.y() - segment.bounds.ur.y() > segmentIntersectionMargin)
+                continue;
+            const auto gap{boundingBox.separation(segment.vertices)};
+            if (gap > segmentIntersectionMargin)
+                continue;
+            if (gap <= 0.0) {
+                if (depth(segment, center) > segmentIntersectionMargin)
+                    return true;
+                for (const auto &corner : boundingBox.getCorners())
+                    if (depth(segment, corner) > segmentIntersectionMargin)
+                        return true;
+            }
+            decided = false;
+        }
+        if (decided)
+            return false;
+        return std::nullopt;
+    }
+};
+
 void Lanelet::setId(const size_t lid) { laneletId = lid; }
 
 void Lanelet::setLeftAdjacent(const std::shared_ptr<Lanelet> &left, bool oppositeDir) {
@@ -70,7 +328,10 @@ void Lanelet::addLeftVertex(const vertex left) { leftBorder.push_back(left); }
 
 void Lanelet::addRightVertex(const vertex right) { rightBorder.push_back(right); }
 
-void Lanelet::addCenterVertex(const vertex center) { centerVertices.push_back(center); }
+void Lanelet::addCenterVertex(const vertex center) {
+    centerVertices.push_back(center);
+    std::atomic_store(&centerLineIndex, std::shared_ptr<const CenterLineIndex>{});
+}
 
 void Lanelet::addPredecessor(const std::shared_ptr<Lanelet> &pre) { predecessorLanelets.push_back(pre); }
 
@@ -126,6 +387,26 @@ bool Lanelet::applyIntersectionTesting(const polygon_type &polygon_shape) const
            bg::intersects(polygon_shape, this->getOuterPolygon());
 }
 
+bool Lanelet::applyIntersectionTesting(const OrientedBoundingBox &boundingBox,
+                                       const polygon_type &polygon_shape) const {
+    // the bounding boxes overlap if the shapes intersect
+    if (!bg::intersects(boundingBox.getAxisAlignedBoundingBox(), this->getBoundingBox()))
+        return false;
+    if (const auto segments{getConvexSegments()}; segments->valid)
+        if (const auto intersects{segments->intersects(boundingBox)})
+            return *intersects;
+    return bg::intersects(polygon_shape, this->getOuterPolygon());
+}
+
+std::shared_ptr<const Lanelet::ConvexSegments> Lanelet::getConvexSegments() const {
+    auto segments{std::atomic_load(&convexSegments)};
+    if (segments == nullptr) {
+        segments = std::make_shared<const ConvexSegments>(leftBorder, rightBorder);
+        std::atomic_store(&convexSegments, segments);
+    }
+    return segments;
+}
+
 bool Lanelet::checkIntersection(const polygon_type &polygon_shape, ContainmentType intersection_type) const {
     switch (intersection_type) {
     case ContainmentType::PARTIALLY_CONTAINED: {
@@ -139,6 +420,12 @@ bool Lanelet::checkIntersection(const polygon_type &polygon_shape, ContainmentTy
     }
 }
 
+bool Lanelet::containsPoint(const double xPos, const double yPos) const {
+    const point_type point{xPos, yPos};
+    // check first if point is within bounding box since this evaluation is faster
+    return bg::covered_by(point, boundingBox) && bg::covered_by(point, outerPolygon);
+}
+
 std::vector<vertex> Lanelet::computeIntersectionPointsWithShape(const multi_polygon_type &shape) const {
     std::vector<vertex> intersectionPoints;
     multi_polygon_type output;
@@ -180,6 +467,7 @@ std::vector<std::shared_ptr<Lanelet>> Lanelet::getAdjacentSameDir() const { retu
 std::vector<std::shared_ptr<Lanelet>> Lanelet::getAdjacentBothDir() const { return adjacentBothDir; }
 
 void Lanelet::constructOuterPolygon() {
+    ENV_MODEL_TRACE_SPAN("Lanelet::constructOuterPolygon", "lanelet");
     const std::vector<vertex> &leftBorderTemp = this->getLeftBorderVertices();
     const std::vector<vertex> &rightBorderTemp = this->getRightBorderVertices();
 
@@ -199,15 +487,17 @@ void Lanelet::constructOuterPolygon() {
         polygon.outer().back() = point_type{leftBorderTemp[0].x, leftBorderTemp[0].y};
 
         // Improve polygon (remove duplicated vertices, close vertices, order)
-        bg::simplify(polygon, outerPolygon, 0.01);
+        bg::simplify(polygon, outerPolygon, outerPolygonSimplificationTolerance);
         bg::unique(outerPolygon);
         bg::correct(outerPolygon);
 
         bg::envelope(outerPolygon, boundingBox); // set bounding box
     }
+    std::atomic_store(&convexSegments, std::shared_ptr<const ConvexSegments>{});
 }
 
 void Lanelet::createCenterVertices() {
+    ENV_MODEL_TRACE_SPAN("Lanelet::createCenterVertices", "lanelet");
     unsigned long numVertices = leftBorder.size();
     for (unsigned long i = 0; i < numVertices; i++) {
         vertex newVertex{};
@@ -231,19 +521,21 @@ size_t Lanelet::findClosestIndex(double positionX, double positionY,
                                  bool considerLastIndex) const { // find the closest vertex to the given position
     assert(!centerVertices.empty());
 
-    double minimum_diff = std::numeric_limits<double>::infinity();
-    size_t minimum_index = 0;
-
     size_t numIterations{centerVertices.size() - 1};
     if (considerLastIndex)
         numIterations = centerVertices.size();
 
+    if (numIterations >= minIndexedCenterVertices)
+        return getCenterLineIndex()->findClosestIndex(positionX, positionY, numIterations);
+
+    double minimum_diff = std::numeric_limits<double>::infinity();
+    size_t minimum_index = 0;
     for (size_t i = 0; i < numIterations; ++i) {
         double diffX = centerVertices[i].x - positionX;
         double diffY = centerVertices[i].y - positionY;
 
         // NOTE:
-        // Instead of calculating sqrt(diffX * diffX + diffY + diffY), we leave out the square root here!
+        // Instead of calculating sqrt(diffX * diffX + diffY * diffY), we leave out the square root here!
         // This is fine since we only calculate the distance in order to compare it with other distances,
         // and sqrt(a) <= sqrt(b) iff a <= b.
         // Therefore it is OK to use the squared distance, saving a few cycles of calculating the square root.
@@ -263,6 +555,16 @@ size_t Lanelet::findClosestIndex(double positionX, double positionY,
     return minimum_index;
 }
 
+std::shared_ptr<const Lanelet::CenterLineIndex> Lanelet::getCenterLineIndex() const {
+    auto index{std::atomic_load(&centerLineIndex)};
+    if (index == nullptr) {
+        // concurrent callers might create the structure several times, but all of them are equal
+        index = std::make_shared<const CenterLineIndex>(centerVertices);
+        std::atomic_store(&centerLineIndex, index);
+    }
+    return index;
+}
+
 bool Lanelet::hasLaneletType(LaneletType laType) const {
     return laType == LaneletType::all or laType == LaneletType::any or laneletTypes.find(laType) != laneletTypes.end();
 }
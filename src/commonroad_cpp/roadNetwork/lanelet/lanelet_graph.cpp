@@ -1,64 +1,246 @@
-#include "commonroad_cpp/roadNetwork/lanelet/dijkstra.h"
 #include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
 
+#include <algorithm>
 #include <array>
 #include <commonroad_cpp/roadNetwork/lanelet/lanelet_graph.h>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <utility>
 #include <vector>
 
+namespace {
+
+constexpr size_t successorWeight{1};
+constexpr size_t laneChangeWeight{4};
+
+/**
+ * Search state of Dijkstra's algorithm which is reused across queries. Instead of resetting the arrays before each
+ * query, entries are only valid if their generation matches the generation of the current query.
+ */
+struct DijkstraWorkspace {
+    std::vector<size_t> distances;               //**< tentative distance of each vertex */
+    std::vector<size_t> parents;                 //**< predecessor of each vertex on the shortest path */
+    std::vector<uint32_t> reachedGeneration;     //**< generation in which distance and parent were set */
+    std::vector<uint32_t> settledGeneration;     //**< generation in which the distance became final */
+    std::vector<std::pair<size_t, size_t>> heap; //**< min-heap of distance and vertex index */
+    uint32_t generation{0};                      //**< generation of the current query */
+
+    /**
+     * Prepares the workspace for a new query.
+     *
+     * @param numVertices Number of vertices of the graph.
+     */
+    void prepare(size_t numVertices) {
+        if (distances.size() < numVertices) {
+            distances.resize(numVertices);
+            parents.resize(numVertices);
+            reachedGeneration.resize(numVertices, 0);
+            settledGeneration.resize(numVertices, 0);
+        }
+        heap.clear();
+        if (++generation == 0) {
+            std::fill(reachedGeneration.begin(), reachedGeneration.end(), 0);
+            std::fill(settledGeneration.begin(), settledGeneration.end(), 0);
+            generation = 1;
+        }
+    }
+};
+
+thread_local DijkstraWorkspace workspace;
+
+} // namespace
+
 std::vector<size_t> LaneletGraph::findPaths(size_t src, const size_t dst, bool considerAdjacency) {
-    if (queries.find({src, dst}) != queries.end())
-        return queries[{src, dst}];
+    if (src == dst)
+        return {src};
 
-    std::vector<size_t> path;
+    const path_query query{src, dst, static_cast<size_t>(considerAdjacency)};
+    auto &shard{getMemoShard(query)};
+    if (memoShardCapacity > 0) {
+        std::shared_lock lock{shard.mutex};
+        if (const auto memoPath{shard.paths.find(query)}; memoPath != shard.paths.end()) {
+            memoHits.fetch_add(1, std::memory_order_relaxed);
+            return memoPath->second;
+        }
+    }
+    memoMisses.fetch_add(1, std::memory_order_relaxed);
+
+    // search without holding the lock so that other queries of the shard are not blocked
+    auto path{searchShortestPath(considerAdjacency ? adjacencyAdjSuc : adjacencySuc, vertexIndices.at(src),
+                                 vertexIndices.at(dst))};
+
+    if (memoShardCapacity > 0) {
+        std::unique_lock lock{shard.mutex};
+        if (shard.paths.try_emplace(query, path).second) {
+            shard.insertionOrder.push_back(query);
+            if (shard.insertionOrder.size() > memoShardCapacity) {
+                shard.paths.erase(shard.insertionOrder.front());
+                shard.insertionOrder.pop_front();
+            }
+        }
+    }
+    return path;
+}
 
+bool LaneletGraph::isReachable(size_t src, size_t dst) {
     if (src == dst)
-        path = {src};
-    else {
-        const auto srcId = static_cast<ptrdiff_t>(verticesAdjSuc.at(src));
-        const auto dstId = static_cast<ptrdiff_t>(verticesAdjSuc.at(dst));
+        return true;
+    if (!hasReachabilityTable())
+        return !findPaths(src, dst, false).empty();
+    const auto srcIdx{vertexIndices.at(src)};
+    const auto dstIdx{vertexIndices.at(dst)};
+    return (reachabilityTable[srcIdx * reachabilityRowWidth + dstIdx / 64] >> (dstIdx % 64) & 1U) != 0;
+}
+
+bool LaneletGraph::hasReachabilityTable() const { return !reachabilityTable.empty(); }
 
-        const auto &graph = considerAdjacency ? graphAdjSuc : graphSuc;
-        const auto &vertices = considerAdjacency ? verticesAdjSucRes : verticesSucRes;
+size_t LaneletGraph::getMemoHits() const { return memoHits.load(std::memory_order_relaxed); }
 
-        const dijkstra<size_t, size_t> searcher{graph, srcId};
+size_t LaneletGraph::getMemoMisses() const { return memoMisses.load(std::memory_order_relaxed); }
 
-        using result_type = std::optional<std::pair<std::vector<std::ptrdiff_t>, std::ptrdiff_t>>;
+size_t LaneletGraph::getMemoSize() const {
+    size_t size{0};
+    for (const auto &shard : memoShards) {
+        std::shared_lock lock{shard.mutex};
+        size += shard.paths.size();
+    }
+    return size;
+}
+
+LaneletGraph::MemoShard &LaneletGraph::getMemoShard(const path_query &query) {
+    return memoShards[boost::hash<path_query>{}(query) % numMemoShards];
+}
+
+std::vector<size_t> LaneletGraph::searchShortestPath(const CsrAdjacency &adjacency, size_t srcIdx,
+                                                     size_t dstIdx) const {
+    auto &ws{workspace};
+    ws.prepare(laneletIds.size());
+    const auto gen{ws.generation};
 
-        if (result_type result = searcher.search_path(dstId); result.has_value()) {
-            for (const auto &res : result.value().first)
-                path.push_back(vertices.at(static_cast<const unsigned long>(res)));
+    ws.distances[srcIdx] = 0;
+    ws.parents[srcIdx] = srcIdx;
+    ws.reachedGeneration[srcIdx] = gen;
+    ws.heap.emplace_back(0, srcIdx);
+
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), std::greater<>{});
+        const auto [distance, vertexIdx]{ws.heap.back()};
+        ws.heap.pop_back();
+
+        if (ws.settledGeneration[vertexIdx] == gen)
+            continue;
+        ws.settledGeneration[vertexIdx] = gen;
+        if (vertexIdx == dstIdx)
+            break;
+
+        for (size_t edgeIdx{adjacency.offsets[vertexIdx]}; edgeIdx < adjacency.offsets[vertexIdx + 1]; ++edgeIdx) {
+            const auto neighborIdx{adjacency.targets[edgeIdx]};
+            const auto newDistance{distance + adjacency.weights[edgeIdx]};
+            if (ws.reachedGeneration[neighborIdx] != gen or newDistance < ws.distances[neighborIdx]) {
+                ws.distances[neighborIdx] = newDistance;
+                ws.parents[neighborIdx] = vertexIdx;
+                ws.reachedGeneration[neighborIdx] = gen;
+                ws.heap.emplace_back(newDistance, neighborIdx);
+                std::push_heap(ws.heap.begin(), ws.heap.end(), std::greater<>{});
+            }
         }
     }
-    queries[{src, dst}] = path;
+
+    if (ws.settledGeneration[dstIdx] != gen)
+        return {};
+
+    size_t pathLength{1};
+    for (auto vertexIdx{dstIdx}; vertexIdx != srcIdx; vertexIdx = ws.parents[vertexIdx])
+        ++pathLength;
+    std::vector<size_t> path(pathLength);
+    auto vertexIdx{dstIdx};
+    for (auto pathIt{path.rbegin()}; pathIt != path.rend(); ++pathIt) {
+        *pathIt = laneletIds[vertexIdx];
+        vertexIdx = ws.parents[vertexIdx];
+    }
     return path;
 }
 
-LaneletGraph::LaneletGraph(const std::vector<std::shared_ptr<Lanelet>> &lanelets) {
+LaneletGraph::CsrAdjacency LaneletGraph::createCsrAdjacency(size_t numVertices,
+                                                            const std::vector<std::array<size_t, 3>> &edges) {
+    CsrAdjacency adjacency;
+    adjacency.offsets.assign(numVertices + 1, 0);
+    for (const auto &edge : edges)
+        ++adjacency.offsets[edge[0] + 1];
+    for (size_t idx{0}; idx < numVertices; ++idx)
+        adjacency.offsets[idx + 1] += adjacency.offsets[idx];
+
+    adjacency.targets.resize(edges.size());
+    adjacency.weights.resize(edges.size());
+    std::vector<size_t> nextPosition{adjacency.offsets.begin(), adjacency.offsets.end() - 1};
+    for (const auto &edge : edges) {
+        const auto pos{nextPosition[edge[0]]++};
+        adjacency.targets[pos] = edge[1];
+        adjacency.weights[pos] = edge[2];
+    }
+    return adjacency;
+}
+
+LaneletGraph::LaneletGraph(const std::vector<std::shared_ptr<Lanelet>> &lanelets, size_t memoCapacity,
+                           size_t reachabilityTableLimit)
+    : memoShardCapacity((memoCapacity + numMemoShards - 1) / numMemoShards) {
+    laneletIds.reserve(lanelets.size());
+    vertexIndices.reserve(lanelets.size());
     for (const auto &let : lanelets) {
-        verticesAdjSuc.insert({let->getId(), graphAdjSuc.add_vertex(let->getId())});
-        verticesSuc.insert({let->getId(), graphSuc.add_vertex(let->getId())});
-        verticesAdjSucRes.insert({verticesAdjSuc.at(let->getId()), let->getId()});
-        verticesSucRes.insert({verticesSuc.at(let->getId()), let->getId()});
+        vertexIndices.insert({let->getId(), laneletIds.size()});
+        laneletIds.push_back(let->getId());
     }
 
+    std::vector<std::array<size_t, 3>> edgesAdjSuc;
+    std::vector<std::array<size_t, 3>> edgesSuc;
     for (const auto &let : lanelets) {
+        const auto letIdx{vertexIndices.at(let->getId())};
         if (let->getAdjacentLeft().adj != nullptr and !let->getAdjacentLeft().oppositeDir) {
-            graphAdjSuc.add_edge(static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getId())),
-                                 static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getAdjacentLeft().adj->getId())), 4);
-            graphAdjSuc.add_edge(static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getAdjacentLeft().adj->getId())),
-                                 static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getId())), 4);
+            const auto adjIdx{vertexIndices.at(let->getAdjacentLeft().adj->getId())};
+            edgesAdjSuc.push_back({letIdx, adjIdx, laneChangeWeight});
+            edgesAdjSuc.push_back({adjIdx, letIdx, laneChangeWeight});
         }
         if (let->getAdjacentRight().adj != nullptr and !let->getAdjacentRight().oppositeDir) {
-            graphAdjSuc.add_edge(static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getId())),
-                                 static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getAdjacentRight().adj->getId())), 4);
-            graphAdjSuc.add_edge(static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getAdjacentRight().adj->getId())),
-                                 static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getId())), 4);
+            const auto adjIdx{vertexIndices.at(let->getAdjacentRight().adj->getId())};
+            edgesAdjSuc.push_back({letIdx, adjIdx, laneChangeWeight});
+            edgesAdjSuc.push_back({adjIdx, letIdx, laneChangeWeight});
         }
         for (const auto &suc : let->getSuccessors()) {
-            graphAdjSuc.add_edge(static_cast<ptrdiff_t>(verticesAdjSuc.at(let->getId())),
-                                 static_cast<ptrdiff_t>(verticesAdjSuc.at(suc->getId())), 1);
-            graphSuc.add_edge(static_cast<ptrdiff_t>(verticesSuc.at(let->getId())),
-                              static_cast<ptrdiff_t>(verticesSuc.at(suc->getId())), 1);
+            const auto sucIdx{vertexIndices.at(suc->getId())};
+            edgesAdjSuc.push_back({letIdx, sucIdx, successorWeight});
+            edgesSuc.push_back({letIdx, sucIdx, successorWeight});
+        }
+    }
+    adjacencyAdjSuc = createCsrAdjacency(laneletIds.size(), edgesAdjSuc);
+    adjacencySuc = createCsrAdjacency(laneletIds.size(), edgesSuc);
+
+    if (!laneletIds.empty() and laneletIds.size() <= reachabilityTableLimit)
+        createReachabilityTable();
+}
+
+void LaneletGraph::createReachabilityTable() {
+    const auto numVertices{laneletIds.size()};
+    reachabilityRowWidth = (numVertices + 63) / 64;
+    reachabilityTable.assign(numVertices * reachabilityRowWidth, 0);
+    std::vector<size_t> queue;
+    queue.reserve(numVertices);
+    for (size_t srcIdx{0}; srcIdx < numVertices; ++srcIdx) {
+        auto *row{&reachabilityTable[srcIdx * reachabilityRowWidth]};
+        queue.clear();
+        queue.push_back(srcIdx);
+        row[srcIdx / 64] |= uint64_t{1} << (srcIdx % 64);
+        for (size_t queueIdx{0}; queueIdx < queue.size(); ++queueIdx) {
+            const auto vertexIdx{queue[queueIdx]};
+            for (size_t edgeIdx{adjacencySuc.offsets[vertexIdx]}; edgeIdx < adjacencySuc.offsets[vertexIdx + 1];
+                 ++edgeIdx) {
+                const auto neighborIdx{adjacencySuc.targets[edgeIdx]};
+                if ((row[neighborIdx / 64] >> (neighborIdx % 64) & 1U) == 0) {
+                    row[neighborIdx / 64] |= uint64_t{1} << (neighborIdx % 64);
+                    queue.push_back(neighborIdx);
+                }
+            }
         }
     }
 }
@@ -252,7 +252,7 @@ bool regulatory_elements_utils::lineInFront(const std::vector<vertex> &line, con
     if (!ccs->cartesianPointInProjectionDomain(line.at(1).x, line.at(1).y))
         return false;
     auto b{ccs->convertToCurvilinearCoords(line.at(1).x, line.at(1).y)};
-    multi_polygon_type shapes{obs->getOccupancyPolygonShape(timeStep)};
+    const auto &shapes{obs->getOccupancyPolygonShape(timeStep)};
     for (const auto &shape : shapes)
         for (size_t idx{0}; idx < shape.outer().size(); ++idx) {
             auto point{shape.outer().at(idx)};
@@ -1,4 +1,9 @@
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <boost/version.hpp>
 #if (BOOST_VERSION / 100000) == 1 && (BOOST_VERSION / 100 % 1000) < 78 // Minor version < 78
@@ -13,23 +18,109 @@
 
 #include <boost/geometry/index/parameters.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <tsl/robin_map.h>
 
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
 #include "commonroad_cpp/roadNetwork/intersection/incoming_group.h"
 #include <commonroad_cpp/auxiliaryDefs/regulatory_elements.h>
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
+#include <commonroad_cpp/geometry/oriented_bounding_box.h>
 #include <commonroad_cpp/roadNetwork/intersection/intersection.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lanelet.h>
 #include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_light.h>
+#include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_sign.h>
 #include <commonroad_cpp/roadNetwork/road_network.h>
 
 namespace bg = boost::geometry;
 namespace bgi = boost::geometry::index;
 
+template <typename T> using id_index_t = tsl::robin_map<size_t, std::shared_ptr<T>>;
+using lanelet_sequence = std::vector<size_t>;
+using lane_map_t = std::unordered_map<lanelet_sequence, std::shared_ptr<Lane>, boost::hash<lanelet_sequence>>;
+using lane_index_t = tsl::robin_map<size_t, std::vector<std::shared_ptr<Lane>>>;
+
 struct RoadNetwork::impl {
     bgi::rtree<value, bgi::quadratic<16>>
-        rtree; //**< rtree defined by lanelets of road network for faster occupancy calculation*/
+        rtree; //**< rtree defined by lanelets of road network for faster occupancy calculation; the values are the
+               // positions of the lanelets in the lanelet network */
+    id_index_t<Lanelet> laneletIndex;           //**< lanelets of road network indexed by ID */
+    id_index_t<TrafficSign> trafficSignIndex;   //**< traffic signs of road network indexed by ID */
+    id_index_t<TrafficLight> trafficLightIndex; //**< traffic lights of road network indexed by ID */
+    id_index_t<Intersection> intersectionIndex; //**< intersections of road network indexed by ID */
+    std::shared_mutex laneMutex;                //**< guards the lane registry */
+    std::mutex idCounterMutex;                  //**< guards the ID counter */
+    lane_map_t canonicalLanes;                  //**< interned lanes indexed by their ordered lanelet IDs */
+    lane_index_t containedLaneletIndex;         //**< registered lanes indexed by each of their contained lanelets */
+    lane_index_t baseLaneletIndex;              //**< registered lanes indexed by lanelets used for their creation */
+
+    /**
+     * Interns a lane. The lane mutex has to be locked exclusively by the caller.
+     *
+     * @param lane Pointer to lane.
+     * @return Pointer to canonical lane with same ordered lanelet sequence.
+     */
+    std::shared_ptr<Lane> internLane(const std::shared_ptr<Lane> &lane) {
+        lanelet_sequence sequence;
+        sequence.reserve(lane->getContainedLanelets().size());
+        for (const auto &let : lane->getContainedLanelets())
+            sequence.push_back(let->getId());
+        return canonicalLanes.try_emplace(std::move(sequence), lane).first->second;
+    }
+
+    /**
+     * Finds the lanelets which contain a point. Instead of the general shape intersection, the rtree is queried with
+     * the point and candidates are checked with a point-in-polygon test.
+     *
+     * @param laneletNetwork Lanelets of road network.
+     * @param xPos x-coordinate of point
+     * @param yPos y-coordinate of point
+     * @param relevantLanelets Buffer for rtree query results.
+     * @param lanelets Lanelets containing the point.
+     */
+    void findLaneletsByPosition(const std::vector<std::shared_ptr<Lanelet>> &laneletNetwork, const double xPos,
+                                const double yPos, std::vector<value> &relevantLanelets,
+                                std::vector<std::shared_ptr<Lanelet>> &lanelets) const {
+        relevantLanelets.clear();
+        rtree.query(bgi::intersects(point_type{xPos, yPos}), std::back_inserter(relevantLanelets));
+        for (const auto &[fst, snd] : relevantLanelets)
+            if (laneletNetwork[snd]->containsPoint(xPos, yPos))
+                lanelets.push_back(laneletNetwork[snd]);
+    }
 };
 
+namespace {
+
+/**
+ * Creates an index of road network elements by their IDs. If several elements share an ID, the first one is indexed.
+ * Empty pointers are skipped.
+ *
+ * @param elements Road network elements.
+ * @return Map of IDs to elements.
+ */
+template <typename T> id_index_t<T> createIdIndex(const std::vector<std::shared_ptr<T>> &elements) {
+    id_index_t<T> index;
+    index.reserve(elements.size());
+    for (const auto &elem : elements)
+        if (elem != nullptr)
+            index.try_emplace(elem->getId(), elem);
+    return index;
+}
+
+/**
+ * Looks up a road network element by its ID.
+ *
+ * @param index Map of IDs to elements.
+ * @param elementId ID of element.
+ * @return Pointer to element or nullptr if no element with the ID exists.
+ */
+template <typename T> std::shared_ptr<T> findInIdIndex(const id_index_t<T> &index, const size_t elementId) {
+    auto iter{index.find(elementId)};
+    return iter != index.end() ? iter->second : nullptr;
+}
+
+} // namespace
+
 RoadNetwork::RoadNetwork(RoadNetwork &&) noexcept = default;
 
 RoadNetwork::~RoadNetwork() = default;
@@ -42,9 +133,14 @@ RoadNetwork::RoadNetwork(const std::vector<std::shared_ptr<Lanelet>> &network, c
                          std::vector<std::shared_ptr<Intersection>> inters)
     : laneletNetwork(network), country(cou), trafficSigns(std::move(signs)), trafficLights(std::move(lights)),
       intersections(std::move(inters)), pImpl(std::make_unique<impl>()) {
+    ENV_MODEL_TRACE_SPAN("RoadNetwork::RoadNetwork", "road_network");
     // construct Rtree out of lanelets
-    for (const std::shared_ptr<Lanelet> &let : network)
-        pImpl->rtree.insert(std::make_pair(let->getBoundingBox(), let->getId()));
+    for (size_t idx{0}; idx < laneletNetwork.size(); ++idx)
+        pImpl->rtree.insert(std::make_pair(laneletNetwork[idx]->getBoundingBox(), static_cast<unsigned>(idx)));
+    pImpl->laneletIndex = createIdIndex(laneletNetwork);
+    pImpl->trafficSignIndex = createIdIndex(trafficSigns);
+    pImpl->trafficLightIndex = createIdIndex(trafficLights);
+    pImpl->intersectionIndex = createIdIndex(intersections);
     trafficSignIDLookupTable = TrafficSignLookupTableByCountry.at(cou);
 }
 
@@ -55,7 +151,9 @@ const std::vector<std::shared_ptr<TrafficSign>> &RoadNetwork::getTrafficSigns()
 const std::vector<std::shared_ptr<TrafficLight>> &RoadNetwork::getTrafficLights() const { return trafficLights; }
 
 std::vector<std::shared_ptr<Lane>> RoadNetwork::getLanes() const {
+    std::shared_lock lock{pImpl->laneMutex};
     std::vector<std::shared_ptr<Lane>> collectedLanes;
+    collectedLanes.reserve(lanes.size());
     for (const auto &[fst, snd] : lanes) {
         collectedLanes.push_back(snd.second);
     }
@@ -65,6 +163,7 @@ std::vector<std::shared_ptr<Lane>> RoadNetwork::getLanes() const {
 const std::vector<std::shared_ptr<Intersection>> &RoadNetwork::getIntersections() const { return intersections; }
 
 std::vector<std::shared_ptr<Lanelet>> RoadNetwork::findOccupiedLaneletsByShape(const multi_polygon_type &polygonShape) {
+    ENV_MODEL_TRACE_SPAN("RoadNetwork::findOccupiedLaneletsByShape", "road_network");
     // find all relevant lanelets by making use of the rtree
     std::vector<value> relevantLanelets;
     for (const auto &polygon : polygonShape)
@@ -73,7 +172,7 @@ std::vector<std::shared_ptr<Lanelet>> RoadNetwork::findOccupiedLaneletsByShape(c
     std::vector<std::shared_ptr<Lanelet>> lanelets;
     lanelets.reserve(relevantLanelets.size());
     for (auto [fst, snd] : relevantLanelets)
-        lanelets.push_back(findLaneletById(snd));
+        lanelets.push_back(laneletNetwork[snd]);
 
     // check intersection with relevant lanelets
     std::vector<std::shared_ptr<Lanelet>> occupiedLanelets;
@@ -88,32 +187,72 @@ std::vector<std::shared_ptr<Lanelet>> RoadNetwork::findOccupiedLaneletsByShape(c
     return occupiedLanelets;
 }
 
+std::vector<std::shared_ptr<Lanelet>>
+RoadNetwork::findOccupiedLaneletsByShape(const polygon_type &polygonShape, const OrientedBoundingBox &boundingBox) {
+    ENV_MODEL_TRACE_SPAN("RoadNetwork::findOccupiedLaneletsByShape", "road_network");
+    // find all relevant lanelets by making use of the rtree
+    std::vector<value> relevantLanelets;
+    pImpl->rtree.query(bgi::intersects(boundingBox.getAxisAlignedBoundingBox()), std::back_inserter(relevantLanelets));
+
+    // check intersection with relevant lanelets
+    std::vector<std::shared_ptr<Lanelet>> occupiedLanelets;
+    for (auto [fst, snd] : relevantLanelets)
+        if (const auto &let{laneletNetwork[snd]}; let->applyIntersectionTesting(boundingBox, polygonShape))
+            occupiedLanelets.push_back(let);
+    return occupiedLanelets;
+}
+
 std::vector<std::shared_ptr<Lanelet>> RoadNetwork::findLaneletsByPosition(const double xPos, const double yPos) {
-    std::vector<Lanelet> lanelet;
-    polygon_type polygonPos;
-    bg::append(polygonPos, point_type{xPos, yPos});
+    std::vector<value> relevantLanelets;
+    std::vector<std::shared_ptr<Lanelet>> lanelets;
+    pImpl->findLaneletsByPosition(laneletNetwork, xPos, yPos, relevantLanelets, lanelets);
+    return lanelets;
+}
 
-    return findOccupiedLaneletsByShape({polygonPos});
+std::vector<std::vector<std::shared_ptr<Lanelet>>>
+RoadNetwork::findLaneletsByPositions(const std::vector<vertex> &positions) {
+    std::vector<std::vector<std::shared_ptr<Lanelet>>> lanelets(positions.size());
+    std::vector<value> relevantLanelets; // reused for all queries
+    for (size_t idx{0}; idx < positions.size(); ++idx)
+        pImpl->findLaneletsByPosition(laneletNetwork, positions[idx].x, positions[idx].y, relevantLanelets,
+                                      lanelets[idx]);
+    return lanelets;
 }
 
 std::shared_ptr<Lanelet> RoadNetwork::findLaneletById(size_t laneletID) {
-    const auto iter = std::find_if(std::begin(laneletNetwork), std::end(laneletNetwork),
-                                   [laneletID](const auto &val) { return val->getId() == laneletID; });
-    if (iter == std::end(laneletNetwork))
+    auto lanelet{findInIdIndex(pImpl->laneletIndex, laneletID)};
+    if (lanelet == nullptr)
         throw std::domain_error("RoadNetwork::findLaneletById: Lanelet with ID " + std::to_string(laneletID) +
                                 " does not exist in road network!");
 
-    return *iter;
+    return lanelet;
 }
 
 std::shared_ptr<TrafficLight> RoadNetwork::findTrafficLightById(size_t lightID) {
-    const auto iter = std::find_if(std::begin(trafficLights), std::end(trafficLights),
-                                   [lightID](const auto &val) { return val->getId() == lightID; });
-    if (iter == std::end(trafficLights))
+    auto light{findInIdIndex(pImpl->trafficLightIndex, lightID)};
+    if (light == nullptr)
         throw std::domain_error("RoadNetwork::findTrafficLightById: Traffic light with ID " + std::to_string(lightID) +
                                 " does not exist in road network!");
 
-    return *iter;
+    return light;
+}
+
+std::shared_ptr<TrafficSign> RoadNetwork::findTrafficSignById(size_t signID) {
+    auto sign{findInIdIndex(pImpl->trafficSignIndex, signID)};
+    if (sign == nullptr)
+        throw std::domain_error("RoadNetwork::findTrafficSignById: Traffic sign with ID " + std::to_string(signID) +
+                                " does not exist in road network!");
+
+    return sign;
+}
+
+std::shared_ptr<Intersection> RoadNetwork::findIntersectionById(size_t intersectionID) {
+    auto intersection{findInIdIndex(pImpl->intersectionIndex, intersectionID)};
+    if (intersection == nullptr)
+        throw std::domain_error("RoadNetwork::findIntersectionById: Intersection with ID " +
+                                std::to_string(intersectionID) + " does not exist in road network!");
+
+    return intersection;
 }
 
 SupportedTrafficSignCountry RoadNetwork::getCountry() const { return country; }
@@ -140,37 +279,69 @@ std::string RoadNetwork::extractTrafficSignIDForCountry(const TrafficSignTypes t
 
 std::vector<std::shared_ptr<Lane>> RoadNetwork::addLanes(const std::vector<std::shared_ptr<Lane>> &newLanes,
                                                          size_t initialLanelet) {
+    std::unique_lock lock{pImpl->laneMutex};
     std::vector<std::shared_ptr<Lane>> updatedLanes;
+    updatedLanes.reserve(newLanes.size());
     for (const auto &lane : newLanes) {
-        if (lanes.count(lane->getContainedLaneletIDs()) != 0u and
-            lanes[lane->getContainedLaneletIDs()].first.count(initialLanelet) != 0u) {
-            updatedLanes.push_back(lanes.at(lane->getContainedLaneletIDs()).second);
-        } else if (lanes.count(lane->getContainedLaneletIDs()) != 0u) {
-            lanes[lane->getContainedLaneletIDs()].first.insert(initialLanelet);
-            updatedLanes.push_back(lanes.at(lane->getContainedLaneletIDs()).second);
-        } else {
-            lanes[lane->getContainedLaneletIDs()] = {{initialLanelet}, lane};
-            updatedLanes.push_back(lane);
+        // existing lanes are extended by initial lanelet, otherwise lane is added
+        auto [existingLane, inserted]{
+            lanes.try_emplace(lane->getContainedLaneletIDs(), lanelet_id_set{}, std::shared_ptr<Lane>{})};
+        auto &[baseLanelets, registeredLane]{existingLane->second};
+        if (inserted) {
+            registeredLane = pImpl->internLane(lane);
+            for (const auto &laneletID : registeredLane->getContainedLaneletIDs())
+                pImpl->containedLaneletIndex[laneletID].push_back(registeredLane);
         }
+        if (baseLanelets.insert(initialLanelet).second and registeredLane->containsLanelet(initialLanelet))
+            pImpl->baseLaneletIndex[initialLanelet].push_back(registeredLane);
+        updatedLanes.push_back(registeredLane);
     }
     return updatedLanes;
 }
 
 std::vector<std::shared_ptr<Lane>> RoadNetwork::findLanesByBaseLanelet(const size_t laneletID) {
-    std::vector<std::shared_ptr<Lane>> relevantLanes;
-    for (const auto &[laneIDs, laneMap] : lanes)
-        if (laneIDs.count(laneletID) != 0u and laneMap.first.count(laneletID) != 0u)
-            relevantLanes.push_back(laneMap.second);
-    return relevantLanes;
+    std::shared_lock lock{pImpl->laneMutex};
+    if (const auto relevantLanes{pImpl->baseLaneletIndex.find(laneletID)};
+        relevantLanes != pImpl->baseLaneletIndex.end())
+        return relevantLanes->second;
+    return {};
 }
 
 std::vector<std::shared_ptr<Lane>> RoadNetwork::findLanesByContainedLanelet(const size_t laneletID) {
-    std::vector<std::shared_ptr<Lane>> relevantLanes;
-    for (const auto &[laneIDs, laneMap] : lanes)
-        if (laneIDs.count(laneletID) != 0u)
-            relevantLanes.push_back(laneMap.second);
-    return relevantLanes;
+    std::shared_lock lock{pImpl->laneMutex};
+    if (const auto relevantLanes{pImpl->containedLaneletIndex.find(laneletID)};
+        relevantLanes != pImpl->containedLaneletIndex.end())
+        return relevantLanes->second;
+    return {};
+}
+
+std::shared_ptr<Lane> RoadNetwork::findLaneByContainedLanelets(const lanelet_id_set &laneletIDs) {
+    std::shared_lock lock{pImpl->laneMutex};
+    if (const auto lane{lanes.find(laneletIDs)}; lane != lanes.end())
+        return lane->second.second;
+    return {};
 }
+
+std::shared_ptr<Lane> RoadNetwork::findLaneByLaneletSequence(const std::vector<size_t> &laneletIDs) {
+    std::shared_lock lock{pImpl->laneMutex};
+    if (const auto lane{pImpl->canonicalLanes.find(laneletIDs)}; lane != pImpl->canonicalLanes.end())
+        return lane->second;
+    return {};
+}
+
+lanelet_id_set RoadNetwork::findBaseLaneletsByLane(const std::shared_ptr<Lane> &lane) {
+    std::shared_lock lock{pImpl->laneMutex};
+    if (const auto entry{lanes.find(lane->getContainedLaneletIDs())};
+        entry != lanes.end() and entry->second.second == lane)
+        return entry->second.first;
+    return {};
+}
+
+std::shared_ptr<Lane> RoadNetwork::internLane(const std::shared_ptr<Lane> &lane) {
+    std::unique_lock lock{pImpl->laneMutex};
+    return pImpl->internLane(lane);
+}
+
 void RoadNetwork::setIdCounterRef(const std::shared_ptr<size_t> &idCounter) {
     if (idCounterRef == nullptr)
         idCounterRef = idCounter;
@@ -178,6 +349,15 @@ void RoadNetwork::setIdCounterRef(const std::shared_ptr<size_t> &idCounter) {
 
 std::shared_ptr<size_t> RoadNetwork::getIdCounterRef() const { return idCounterRef; }
 
+size_t RoadNetwork::generateId() { return reserveIds(1); }
+
+size_t RoadNetwork::reserveIds(const size_t numIds) {
+    std::lock_guard lock{pImpl->idCounterMutex};
+    const size_t firstId{*idCounterRef + 1};
+    *idCounterRef += numIds;
+    return firstId;
+}
+
 std::shared_ptr<IncomingGroup> RoadNetwork::findIncomingGroupByLanelet(const std::shared_ptr<Lanelet> &lanelet) const {
     for (const auto &inter : intersections)
         for (const auto &incom : inter->getIncomingGroups())
@@ -208,8 +388,12 @@ std::shared_ptr<OutgoingGroup> RoadNetwork::findOutgoingGroupByLanelet(const std
 }
 
 const std::shared_ptr<LaneletGraph> &RoadNetwork::getTopologicalMap() const {
-    if (topologicalMap != nullptr)
-        return topologicalMap;
-    topologicalMap = std::make_shared<LaneletGraph>(laneletNetwork);
+    // created on first access; if several threads race, all of them continue with the instance stored first
+    if (std::atomic_load(&topologicalMap) == nullptr) {
+        ENV_MODEL_TRACE_SPAN("RoadNetwork::getTopologicalMap", "road_network");
+        std::shared_ptr<LaneletGraph> expected;
+        std::atomic_compare_exchange_strong(&topologicalMap, &expected,
+                                            std::make_shared<LaneletGraph>(laneletNetwork));
+    }
     return topologicalMap;
 }
@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include <commonroad_cpp/auxiliaryDefs/structs.h>
+#include <commonroad_cpp/roadNetwork/lanelet/lane.h>
+#include <commonroad_cpp/roadNetwork/road_network.h>
+#include <commonroad_cpp/roadNetwork/road_network_config.h>
+#include <commonroad_cpp/roadNetwork/road_network_snapshot.h>
+
+namespace {
+
+constexpr std::array<char, 8> snapshotMagic{'C', 'R', 'R', 'N', 'S', 'N', 'A', 'P'}; // identifier of snapshot files
+constexpr uint32_t byteOrderMark{0x01020304}; // detects snapshots written with a different byte order
+
+/**
+ * Range of entries within a section of the snapshot.
+ */
+struct Range {
+    uint64_t begin; //**< index of first entry */
+    uint64_t size;  //**< number of entries */
+};
+
+/**
+ * Header at the beginning of a snapshot file. The header is followed by the lane records, the ID section, and the
+ * vertex section.
+ */
+struct Header {
+    std::array<char, 8> magic;         //**< identifier of snapshot files */
+    uint32_t version;                  //**< version of snapshot format */
+    uint32_t byteOrder;                //**< byte order mark */
+    uint64_t mapChecksum;              //**< checksum of map for which the snapshot was created */
+    double projectionDomainLimit;      //**< road network parameter used for curvilinear coordinate systems */
+    double eps1;                       //**< road network parameter used for curvilinear coordinate systems */
+    double eps2;                       //**< road network parameter used for curvilinear coordinate systems */
+    uint64_t cornerCuttingRefinements; //**< road network parameter used for reference paths */
+    uint64_t stepsToResamplePolyline;  //**< road network parameter used for reference paths */
+    uint64_t numLanes;                 //**< number of lane records */
+    uint64_t numIds;                   //**< number of entries in ID section */
+    uint64_t numVertices;              //**< number of entries in vertex section */
+};
+
+/**
+ * Lane of the snapshot. ID ranges refer to the ID section and vertex ranges to the vertex section.
+ */
+struct LaneRecord {
+    uint64_t id;              //**< lane ID */
+    Range lanelets;           //**< ordered IDs of contained lanelets */
+    Range baseLanelets;       //**< IDs of lanelets based on which the lane was created */
+    Range laneletTypes;       //**< lanelet types of lane */
+    Range usersOneWay;        //**< one-way users of lane */
+    Range usersBidirectional; //**< bidirectional users of lane */
+    Range leftBorder;         //**< left border vertices */
+    Range rightBorder;        //**< right border vertices */
+    Range referencePath;      //**< reference path of curvilinear coordinate system */
+};
+
+/**
+ * Vertex as stored in the vertex section.
+ */
+struct SnapshotVertex {
+    double x; //**< x-coordinate */
+    double y; //**< y-coordinate */
+};
+
+// sections are accessed in place, so all entries have to be trivially copyable and keep the sections 8-byte aligned
+static_assert(std::is_trivially_copyable_v<Header> and sizeof(Header) % alignof(uint64_t) == 0);
+static_assert(std::is_trivially_copyable_v<LaneRecord> and sizeof(LaneRecord) % alignof(uint64_t) == 0);
+static_assert(std::is_trivially_copyable_v<SnapshotVertex> and sizeof(SnapshotVertex) % alignof(uint64_t) == 0);
+
+/**
+ * Appends values to the ID section.
+ *
+ * @param ids ID section.
+ * @param values Values to append.
+ * @return Range of appended values.
+ */
+template <typename T> Range appendIds(std::vector<uint64_t> &ids, const T &values) {
+    Range range{ids.size(), 0};
+    for (const auto &val : values)
+        ids.push_back(static_cast<uint64_t>(val));
+    range.size = ids.size() - range.begin;
+    return range;
+}
+
+/**
+ * Appends vertices to the vertex section.
+ *
+ * @param vertices Vertex section.
+ * @param values Vertices to append.
+ * @return Range of appended vertices.
+ */
+Range appendVertices(std::vector<SnapshotVertex> &vertices, const std::vector<vertex> &values) {
+    Range range{vertices.size(), values.size()};
+    for (const auto &vert : values)
+        vertices.push_back({vert.x, vert.y});
+    return range;
+}
+
+/**
+ * Extracts values from the ID section.
+ *
+ * @param ids ID section.
+ * @param range Range of values.
+ * @return Set of values.
+ */
+template <typename T> std::set<T> extractValues(const uint64_t *ids, Range range) {
+    std::set<T> values;
+    for (uint64_t idx{range.begin}; idx < range.begin + range.size; ++idx)
+        values.insert(static_cast<T>(ids[idx]));
+    return values;
+}
+
+/**
+ * Extracts vertices from the vertex section.
+ *
+ * @param vertices Vertex section.
+ * @param range Range of vertices.
+ * @return List of vertices.
+ */
+std::vector<vertex> extractVertices(const SnapshotVertex *vertices, Range range) {
+    std::vector<vertex> values;
+    values.reserve(range.size);
+    for (uint64_t idx{range.begin}; idx < range.begin + range.size; ++idx)
+        values.push_back({vertices[idx].x, vertices[idx].y});
+    return values;
+}
+
+/**
+ * Checks whether a range lies within a section.
+ *
+ * @param range Range of entries.
+ * @param sectionSize Number of entries in section.
+ * @return Boolean indicating whether the range is valid.
+ */
+bool isValidRange(Range range, uint64_t sectionSize) {
+    return range.begin <= sectionSize and range.size <= sectionSize - range.begin;
+}
+
+} // namespace
+
+struct RoadNetworkSnapshot::impl {
+    const char *data{nullptr}; //**< begin of snapshot file in memory */
+    size_t size{0};            //**< size of snapshot file [byte] */
+#ifdef _WIN32
+    std::vector<uint64_t> buffer; //**< snapshot file content since memory mapping is not supported on Windows */
+#endif
+
+    impl() = default;
+    impl(const impl &) = delete;
+    impl &operator=(const impl &) = delete;
+
+    ~impl() {
+#ifndef _WIN32
+        if (data != nullptr)
+            ::munmap(const_cast<char *>(data), size);
+#endif
+    }
+
+    [[nodiscard]] const Header &header() const { return *reinterpret_cast<const Header *>(data); }
+
+    [[nodiscard]] const LaneRecord *lanes() const {
+        return reinterpret_cast<const LaneRecord *>(data + sizeof(Header));
+    }
+
+    [[nodiscard]] const uint64_t *ids() const {
+        return reinterpret_cast<const uint64_t *>(lanes() + header().numLanes);
+    }
+
+    [[nodiscard]] const SnapshotVertex *vertices() const {
+        return reinterpret_cast<const SnapshotVertex *>(ids() + header().numIds);
+    }
+};
+
+RoadNetworkSnapshot::RoadNetworkSnapshot(const std::string &file) : pImpl(std::make_unique<impl>()) {
+#ifdef _WIN32
+    std::ifstream input{file, std::ios::binary | std::ios::ate};
+    if (!input)
+        throw std::runtime_error("RoadNetworkSnapshot: Cannot open snapshot file " + file + ".");
+    pImpl->size = static_cast<size_t>(input.tellg());
+    pImpl->buffer.resize((pImpl->size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    input.seekg(0);
+    input.read(reinterpret_cast<char *>(pImpl->buffer.data()), static_cast<std::streamsize>(pImpl->size));
+    if (!input)
+        throw std::runtime_error("RoadNetworkSnapshot: Cannot read snapshot file " + file + ".");
+    pImpl->data = reinterpret_cast<const char *>(pImpl->buffer.data());
+#else
+    const int descriptor{::open(file.c_str(), O_RDONLY)};
+    if (descriptor < 0)
+        throw std::runtime_error("RoadNetworkSnapshot: Cannot open snapshot file " + file + ".");
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0 or status.st_size < static_cast<off_t>(sizeof(Header))) {
+        ::close(descriptor);
+        throw std::runtime_error("RoadNetworkSnapshot: File " + file + " is no road network snapshot.");
+    }
+    void *mapped{::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0)};
+    ::close(descriptor);
+    if (mapped == MAP_FAILED)
+        throw std::runtime_error("RoadNetworkSnapshot: Cannot map snapshot file " + file + ".");
+    pImpl->data = static_cast<const char *>(mapped);
+    pImpl->size = static_cast<size_t>(status.st_size);
+#endif
+
+    if (pImpl->size < sizeof(Header) or pImpl->header().magic != snapshotMagic)
+        throw std::runtime_error("RoadNetworkSnapshot: File " + file + " is no road network snapshot.");
+    const auto &header{pImpl->header()};
+    if (header.byteOrder != byteOrderMark)
+        throw std::runtime_error("RoadNetworkSnapshot: Snapshot " + file + " was written with a different byte order.");
+    if (header.version != version)
+        throw std::runtime_error("RoadNetworkSnapshot: Snapshot " + file + " has version " +
+                                 std::to_string(header.version) + " but version " + std::to_string(version) +
+                                 " is required.");
+
+    // the section sizes are checked individually first so that the total size cannot overflow
+    const auto available{static_cast<uint64_t>(pImpl->size - sizeof(Header))};
+    if (header.numLanes > available / sizeof(LaneRecord) or header.numIds > available / sizeof(uint64_t) or
+        header.numVertices > available / sizeof(SnapshotVertex) or
+        header.numLanes * sizeof(LaneRecord) + header.numIds * sizeof(uint64_t) +
+                header.numVertices * sizeof(SnapshotVertex) !=
+            available)
+        throw std::runtime_error("RoadNetworkSnapshot: Snapshot " + file + " is truncated or corrupted.");
+    for (size_t idx{0}; idx < header.numLanes; ++idx) {
+        const auto &record{pImpl->lanes()[idx]};
+        if (record.lanelets.size == 0 or record.baseLanelets.size == 0 or
+            !isValidRange(record.lanelets, header.numIds) or !isValidRange(record.baseLanelets, header.numIds) or
+            !isValidRange(record.laneletTypes, header.numIds) or !isValidRange(record.usersOneWay, header.numIds) or
+            !isValidRange(record.usersBidirectional, header.numIds) or
+            !isValidRange(record.leftBorder, header.numVertices) or
+            !isValidRange(record.rightBorder, header.numVertices) or
+            !isValidRange(record.referencePath, header.numVertices))
+            throw std::runtime_error("RoadNetworkSnapshot: Snapshot " + file + " is truncated or corrupted.");
+    }
+}
+
+RoadNetworkSnapshot::~RoadNetworkSnapshot() = default;
+
+void RoadNetworkSnapshot::write(const std::string &file, const std::shared_ptr<RoadNetwork> &roadNetwork,
+                                uint64_t mapChecksum) {
+    auto lanes{roadNetwork->getLanes()};
+    // lanes are stored in the order of their creation so that restored lanes are registered in the same order
+    std::sort(lanes.begin(), lanes.end(), [](const std::shared_ptr<Lane> &lhs, const std::shared_ptr<Lane> &rhs) {
+        return lhs->getId() < rhs->getId();
+    });
+
+    std::vector<LaneRecord> records;
+    records.reserve(lanes.size());
+    std::vector<uint64_t> ids;
+    std::vector<SnapshotVertex> vertices;
+    for (const auto &lane : lanes) {
+        std::vector<size_t> laneletIds;
+        laneletIds.reserve(lane->getContainedLanelets().size());
+        for (const auto &lanelet : lane->getContainedLanelets())
+            laneletIds.push_back(lanelet->getId());
+        records.push_back(LaneRecord{lane->getId(), appendIds(ids, laneletIds),
+                                     appendIds(ids, roadNetwork->findBaseLaneletsByLane(lane)),
+                                     appendIds(ids, lane->getLaneletTypes()), appendIds(ids, lane->getUsersOneWay()),
+                                     appendIds(ids, lane->getUsersBidirectional()),
+                                     appendVertices(vertices, lane->getLeftBorderVertices()),
+                                     appendVertices(vertices, lane->getRightBorderVertices()),
+                                     appendVertices(vertices, lane->computeReferencePath())});
+    }
+
+    const Header header{snapshotMagic,
+                        version,
+                        byteOrderMark,
+                        mapChecksum,
+                        RoadNetworkParameters::projectionDomainLimit,
+                        RoadNetworkParameters::eps1,
+                        RoadNetworkParameters::eps2,
+                        static_cast<uint64_t>(RoadNetworkParameters::cornerCuttingRefinements),
+                        RoadNetworkParameters::stepsToResamplePolyline,
+                        records.size(),
+                        ids.size(),
+                        vertices.size()};
+
+    // the snapshot is written to a temporary file first which then replaces the snapshot atomically
+    const std::string temporaryFile{
+        file + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "." +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp"};
+    {
+        std::ofstream output{temporaryFile, std::ios::binary | std::ios::trunc};
+        if (!output)
+            throw std::runtime_error("RoadNetworkSnapshot: Cannot create snapshot file " + temporaryFile + ".");
+        output.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        output.write(reinterpret_cast<const char *>(records.data()),
+                     static_cast<std::streamsize>(records.size() * sizeof(LaneRecord)));
+        output.write(reinterpret_cast<const char *>(ids.data()),
+                     static_cast<std::streamsize>(ids.size() * sizeof(uint64_t)));
+        output.write(reinterpret_cast<const char *>(vertices.data()),
+                     static_cast<std::streamsize>(vertices.size() * sizeof(SnapshotVertex)));
+        if (!output.flush()) {
+            output.close();
+            std::filesystem::remove(temporaryFile);
+            throw std::runtime_error("RoadNetworkSnapshot: Cannot write snapshot file " + temporaryFile + ".");
+        }
+    }
+    std::filesystem::rename(temporaryFile, file);
+}
+
+bool RoadNetworkSnapshot::restoreIfValid(const std::string &file, const std::shared_ptr<RoadNetwork> &roadNetwork,
+                                         uint64_t mapChecksum) {
+    if (!std::filesystem::exists(file))
+        return false;
+    try {
+        const RoadNetworkSnapshot snapshot{file};
+        if (!snapshot.isValidFor(mapChecksum)) {
+            spdlog::info("RoadNetworkSnapshot::restoreIfValid: Snapshot {} is outdated.", file);
+            return false;
+        }
+        snapshot.restore(roadNetwork);
+    } catch (const std::runtime_error &error) {
+        spdlog::warn("RoadNetworkSnapshot::restoreIfValid: {}", error.what());
+        return false;
+    }
+    return true;
+}
+
+uint64_t RoadNetworkSnapshot::computeChecksum(const std::string &file) {
+    std::ifstream input{file, std::ios::binary};
+    if (!input)
+        throw std::runtime_error("RoadNetworkSnapshot: Cannot open file " + file + ".");
+    uint64_t checksum{14695981039346656037ULL}; // FNV-1a offset basis
+    std::array<char, 65536> buffer{};
+    while (input) {
+        input.read(buffer.data(), buffer.size());
+        for (std::streamsize idx{0}; idx < input.gcount(); ++idx) {
+            checksum ^= static_cast<unsigned char>(buffer[static_cast<size_t>(idx)]);
+            checksum *= 1099511628211ULL; // FNV-1a prime
+        }
+    }
+    return checksum;
+}
+
+uint64_t RoadNetworkSnapshot::getMapChecksum() const { return pImpl->header().mapChecksum; }
+
+size_t RoadNetworkSnapshot::getNumLanes() const { return pImpl->header().numLanes; }
+
+bool RoadNetworkSnapshot::isValidFor(uint64_t mapChecksum) const {
+    const auto &header{pImpl->header()};
+    return header.mapChecksum == mapChecksum and
+           header.projectionDomainLimit == RoadNetworkParameters::projectionDomainLimit and
+           header.eps1 == RoadNetworkParameters::eps1 and header.eps2 == RoadNetworkParameters::eps2 and
+           header.cornerCuttingRefinements ==
+               static_cast<uint64_t>(RoadNetworkParameters::cornerCuttingRefinements) and
+           header.stepsToResamplePolyline == RoadNetworkParameters::stepsToResamplePolyline;
+}
+
+void RoadNetworkSnapshot::restore(const std::shared_ptr<RoadNetwork> &roadNetwork) const {
+    const auto *records{pImpl->lanes()};
+    const auto *ids{pImpl->ids()};
+    const auto *vertices{pImpl->vertices()};
+
+    // all lanelets are resolved first so that no lane is added if the snapshot does not match the road network
+    std::vector<std::vector<std::shared_ptr<Lanelet>>> containedLanelets(getNumLanes());
+    for (size_t idx{0}; idx < getNumLanes(); ++idx) {
+        const auto &range{records[idx].lanelets};
+        containedLanelets[idx].reserve(range.size);
+        for (uint64_t letIdx{range.begin}; letIdx < range.begin + range.size; ++letIdx)
+            try {
+                containedLanelets[idx].push_back(roadNetwork->findLaneletById(ids[letIdx]));
+            } catch (const std::domain_error &) {
+                throw std::runtime_error("RoadNetworkSnapshot::restore: Lanelet " + std::to_string(ids[letIdx]) +
+                                         " of snapshot does not exist in road network.");
+            }
+    }
+
+    for (size_t idx{0}; idx < getNumLanes(); ++idx) {
+        const auto &record{records[idx]};
+        auto lane{std::make_shared<Lane>(
+            containedLanelets[idx],
+            Lanelet{record.id, extractVertices(vertices, record.leftBorder),
+                    extractVertices(vertices, record.rightBorder), extractValues<LaneletType>(ids, record.laneletTypes),
+                    extractValues<ObstacleType>(ids, record.usersOneWay),
+                    extractValues<ObstacleType>(ids, record.usersBidirectional)})};
+        lane->setReferencePath(extractVertices(vertices, record.referencePath));
+        for (uint64_t baseIdx{record.baseLanelets.begin};
+             baseIdx < record.baseLanelets.begin + record.baseLanelets.size; ++baseIdx)
+            roadNetwork->addLanes({lane}, ids[baseIdx]);
+    }
+}
@@ -1,7 +1,9 @@
 #include "commonroad_cpp/geometry/rectangle.h"
 
+#include <commonroad_cpp/auxiliaryDefs/tracing.h>
 #include <commonroad_cpp/obstacle/obstacle.h>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,6 +16,7 @@ World::World(std::string name, const size_t timeStep, const std::shared_ptr<Road
              const double timeStepSize, const WorldParameters &worldParams)
     : name(std::move(name)), timeStep(timeStep), roadNetwork(roadNetwork), egoVehicles(std::move(egos)),
       obstacles(std::move(otherObstacles)), dt(timeStepSize), worldParameters(worldParams) {
+    ENV_MODEL_TRACE_SPAN("World::World", "world");
     for (const auto &lane : roadNetwork->getLanes())
         idCounter = std::max(idCounter, lane->getId());
     for (const auto &lanelet : roadNetwork->getLaneletNetwork())
@@ -38,6 +41,7 @@ World::World(std::string name, const size_t timeStep, const std::shared_ptr<Road
         }
     }
     roadNetwork->setIdCounterRef(std::make_shared<size_t>(idCounter));
+    updateObstacleIndex();
     setInitialLanes();
     initMissingInformation();
 }
@@ -54,46 +58,60 @@ std::vector<std::shared_ptr<Obstacle>> World::findObstacles(const std::vector<si
     std::vector<std::shared_ptr<Obstacle>> obstacleList{};
     obstacleList.reserve(obstacleIdList.size());
     for (const auto &obstacleID : obstacleIdList) {
-        for (const auto &obs : obstacles)
-            if (obstacleID == obs->getId())
-                obstacleList.emplace_back(obs);
+        if (auto obs{obstacleIndex.find(obstacleID)}; obs != obstacleIndex.end())
+            obstacleList.emplace_back(obs->second);
     }
     for (const auto &obstacleID : obstacleIdList) {
-        for (const auto &obs : egoVehicles)
-            if (obstacleID == obs->getId())
-                obstacleList.emplace_back(obs);
+        if (auto obs{egoVehicleIndex.find(obstacleID)}; obs != egoVehicleIndex.end())
+            obstacleList.emplace_back(obs->second);
     }
 
     return obstacleList;
 }
 
 std::shared_ptr<Obstacle> World::findObstacle(const size_t obstacleId) const {
+    if (auto obs{obstacleIndex.find(obstacleId)}; obs != obstacleIndex.end())
+        return obs->second;
+    if (auto obs{egoVehicleIndex.find(obstacleId)}; obs != egoVehicleIndex.end())
+        return obs->second;
+    throw std::logic_error("Provided obstacle ID does not exist! ID: " + std::to_string(obstacleId));
+}
+
+void World::updateObstacleIndex() {
+    obstacleIndex.clear();
+    obstacleIndex.reserve(obstacles.size());
     for (const auto &obs : obstacles)
-        if (obstacleId == obs->getId())
-            return obs;
+        obstacleIndex.insert({obs->getId(), obs});
+    egoVehicleIndex.clear();
+    egoVehicleIndex.reserve(egoVehicles.size());
     for (const auto &obs : egoVehicles)
-        if (obstacleId == obs->getId())
-            return obs;
-    throw std::logic_error("Provided obstacle ID does not exist! ID: " + std::to_string(obstacleId));
+        egoVehicleIndex.insert({obs->getId(), obs});
 }
 
 void World::setInitialLanes() const {
+    ENV_MODEL_TRACE_SPAN("World::setInitialLanes", "world");
+    const auto numThreads{worldParameters.getNumThreads() == 0
+                              ? std::max(1U, std::thread::hardware_concurrency())
+                              : worldParameters.getNumThreads()};
     // create lanes occupied by ego vehicle
     for (const auto &obs : egoVehicles)
         obs->computeLanes(roadNetwork);
     // create lanes for each lanelet as initial lanelet
-    for (const auto &la : roadNetwork->getLaneletNetwork()) {
+    for (const auto &la : roadNetwork->getLaneletNetwork())
         la->initAdjacentRoadLanes();
-        auto lanes{lane_operations::createLanesBySingleLanelets(
-            {la}, roadNetwork, worldParameters.getSensorParams().getFieldOfViewFront(),
-            worldParameters.getSensorParams().getFieldOfViewRear(),
-            static_cast<int>(worldParameters.getRoadNetworkParams().numIntersectionsPerDirectionLaneGeneration), {})};
-    }
+    lane_operations::createLanesForAllLanelets(
+        roadNetwork->getLaneletNetwork(), roadNetwork, worldParameters.getSensorParams().getFieldOfViewFront(),
+        worldParameters.getSensorParams().getFieldOfViewRear(),
+        static_cast<int>(worldParameters.getRoadNetworkParams().numIntersectionsPerDirectionLaneGeneration), {},
+        numThreads);
     // initialize curvilinear coordinate system for each lane
-    for (const auto &lane : roadNetwork->getLanes())
+    const auto lanes{roadNetwork->getLanes()};
+    const auto numLanes{static_cast<long>(lanes.size())};
+#pragma omp parallel for schedule(dynamic) num_threads(static_cast<int>(numThreads))
+    for (long idx = 0; idx < numLanes; ++idx)
         try {
-            auto l{
-                lane->getCurvilinearCoordinateSystem()}; // This is a dummy call to ensure that the CCS is initialized
+            auto l{lanes[static_cast<size_t>(idx)]
+                       ->getCurvilinearCoordinateSystem()}; // This is a dummy call to ensure that the CCS is initialized
         } catch (const std::runtime_error &e) {
             spdlog::error("World::setInitialLanes: Error while setting initial lanes: {}", e.what());
         } catch (...) {
@@ -111,33 +129,34 @@ void World::setCurvilinearStates() const {
             obs->setCurvilinearStates(roadNetwork);
 }
 
-void World::setEgoVehicles(const std::vector<std::shared_ptr<Obstacle>> &egos) { egoVehicles = egos; }
+void World::setEgoVehicles(const std::vector<std::shared_ptr<Obstacle>> &egos) {
+    egoVehicles = egos;
+    updateObstacleIndex();
+}
 
 void World::setEgoVehicles(std::vector<size_t> &egos) {
-    for (const auto &eID : egos) {
-        auto itr{std::find_if(obstacles.begin(), obstacles.end(),
-                              [eID](const std::shared_ptr<Obstacle> &obs) { return obs->getId() == eID; })};
-        if (itr != obstacles.end()) {
-            egoVehicles.push_back(*itr);
-            obstacles.erase(itr);
-        } else
+    tsl::robin_set<size_t> egoIds;
+    egoIds.reserve(egos.size());
+    for (const auto &eID : egos)
+        if (obstacleIndex.find(eID) == obstacleIndex.end() or !egoIds.insert(eID).second)
             throw std::runtime_error("PythonInterface::createScenario: Unknown ego ID.");
-    }
-    // obstacles not in ego list but currently ego are moved to obstacles
-    std::vector<size_t> idsToRemove;
-    for (const auto &egoTmp : egoVehicles) {
-        if (std::find_if(egos.begin(), egos.end(), [egoTmp](const size_t eID) { return egoTmp->getId() == eID; }) ==
-            egos.end())
-            idsToRemove.push_back(egoTmp->getId());
-    }
-    for (const auto &eID : idsToRemove) {
-        auto egoRef{std::find_if(egoVehicles.begin(), egoVehicles.end(),
-                                 [eID](const std::shared_ptr<Obstacle> &egoTmp) { return egoTmp->getId() == eID; })};
-        if (egoRef != egoVehicles.end()) {
-            obstacles.push_back(*egoRef);
-            egoVehicles.erase(egoRef);
-        }
-    }
+
+    std::vector<std::shared_ptr<Obstacle>> newEgoVehicles;
+    newEgoVehicles.reserve(egos.size());
+    for (const auto &eID : egos)
+        newEgoVehicles.push_back(obstacleIndex.at(eID));
+
+    // current ego vehicles are moved to obstacles
+    std::vector<std::shared_ptr<Obstacle>> newObstacles;
+    newObstacles.reserve(obstacles.size() + egoVehicles.size());
+    for (const auto &obs : obstacles)
+        if (egoIds.find(obs->getId()) == egoIds.end())
+            newObstacles.push_back(obs);
+    newObstacles.insert(newObstacles.end(), egoVehicles.begin(), egoVehicles.end());
+
+    egoVehicles = std::move(newEgoVehicles);
+    obstacles = std::move(newObstacles);
+    updateObstacleIndex();
 }
 
 const std::string &World::getName() const { return name; }
@@ -160,16 +179,17 @@ void World::initMissingInformation() const {
 }
 
 void World::updateObstacles(const std::vector<std::shared_ptr<Obstacle>> &obstacleList) {
+    ENV_MODEL_TRACE_SPAN("World::updateObstacles", "world");
     std::vector<std::shared_ptr<Obstacle>> newObstacles;
-    std::set<size_t> newObstacleIds;
+    newObstacles.reserve(obstacleList.size() + obstacles.size());
+    tsl::robin_set<size_t> newObstacleIds;
+    newObstacleIds.reserve(obstacleList.size());
     for (const auto &obs : obstacleList) {
         newObstacleIds.insert(obs->getId());
-        auto existingObs{std::find_if(obstacles.begin(), obstacles.end(), [obs](const std::shared_ptr<Obstacle> &o) {
-            return o->getId() == obs->getId();
-        })};
+        auto existingObs{obstacleIndex.find(obs->getId())};
 
         // obstacle is new -> add to list
-        if (existingObs == obstacles.end()) {
+        if (existingObs == obstacleIndex.end()) {
             newObstacles.push_back(obs);
             continue;
         }
@@ -180,11 +200,11 @@ void World::updateObstacles(const std::vector<std::shared_ptr<Obstacle>> &obstac
             newObstacles.push_back(obs);
             continue;
         }
-        (*existingObs)->updateCurrentState(obs->getCurrentState());
-        (*existingObs)->setTrajectoryPrediction(obs->getTrajectoryPrediction());
-        (*existingObs)->setGeoShape(obs->getShapePtr()); // set shape as it might change in real-world
-                                                         // simulations due to sensor inaccuracies
-        newObstacles.push_back(*existingObs);
+        existingObs->second->updateCurrentState(obs->getCurrentState());
+        existingObs->second->setTrajectoryPrediction(obs->getTrajectoryPrediction());
+        existingObs->second->setGeoShape(obs->getShapePtr()); // set shape as it might change in real-world
+                                                              // simulations due to sensor inaccuracies
+        newObstacles.push_back(existingObs->second);
     }
 
     // obstacle is not present anymore -> consider until history not relevant anymore
@@ -196,13 +216,16 @@ void World::updateObstacles(const std::vector<std::shared_ptr<Obstacle>> &obstac
             newObstacles.push_back(obs);
         }
     }
-    obstacles = newObstacles;
+    obstacles = std::move(newObstacles);
+    updateObstacleIndex();
 }
 
 void World::updateObstaclesTraj(
     const std::vector<std::shared_ptr<Obstacle>> &obstacleList, std::map<size_t, std::shared_ptr<State>> &currentStates,
     std::map<size_t, tsl::robin_map<time_step_t, std::shared_ptr<State>>> &trajectoryPredictions) {
+    ENV_MODEL_TRACE_SPAN("World::updateObstaclesTraj", "world");
     std::vector<std::shared_ptr<Obstacle>> newObstacles{obstacleList};
+    newObstacles.reserve(obstacleList.size() + currentStates.size() + obstacles.size());
 
     for (const auto &[obsID, state] : currentStates) {
         auto existingObs{findObstacle(obsID)};
@@ -211,23 +234,28 @@ void World::updateObstaclesTraj(
         newObstacles.push_back(existingObs);
     }
 
+    tsl::robin_set<size_t> newObstacleIds;
+    newObstacleIds.reserve(newObstacles.size());
+    for (const auto &obs : newObstacles)
+        newObstacleIds.insert(obs->getId());
+
     // obstacle is not present anymore -> consider until history not relevant anymore
     for (const auto &obs : obstacles) {
-        if (std::find_if(newObstacles.begin(), newObstacles.end(), [obs](const std::shared_ptr<Obstacle> &o) {
-                return o->getId() == obs->getId();
-            }) == newObstacles.end()) {
+        if (newObstacleIds.find(obs->getId()) == newObstacleIds.end()) {
             // if obs history passed -> continue
             if (!newObstacles.empty() and obs->historyPassed(newObstacles.front()->getCurrentState()->getTimeStep()))
                 continue;
             newObstacles.push_back(obs);
         }
     }
-    obstacles = newObstacles;
+    obstacles = std::move(newObstacles);
+    updateObstacleIndex();
 }
 
 WorldParameters World::getWorldParameters() const { return worldParameters; }
 
 void World::propagate(const bool ego) const {
+    ENV_MODEL_TRACE_SPAN("World::propagate", "world");
     for (const auto &obs : obstacles)
         obs->propagate();
     if (ego)
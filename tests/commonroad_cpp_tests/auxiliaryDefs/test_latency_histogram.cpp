@@ -0,0 +1,54 @@
+#include "test_latency_histogram.h"
+#include "commonroad_cpp/auxiliaryDefs/latency_histogram.h"
+#include <stdexcept>
+
+TEST_F(TestLatencyHistogram, EmptyHistogram) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getCount(), 0);
+    EXPECT_EQ(histogram.getMax(), 0);
+    EXPECT_EQ(histogram.getQuantile(0.5), 0);
+    EXPECT_THROW(static_cast<void>(histogram.getQuantile(1.5)), std::invalid_argument);
+}
+
+TEST_F(TestLatencyHistogram, SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (long value{0}; value < 8; ++value)
+        histogram.record(value);
+    histogram.record(-5);
+    EXPECT_EQ(histogram.getCount(), 9);
+    EXPECT_EQ(histogram.getQuantile(0.0), 0);
+    EXPECT_EQ(histogram.getQuantile(0.5), 3);
+    EXPECT_EQ(histogram.getQuantile(1.0), 7);
+    EXPECT_EQ(histogram.getMax(), 7);
+}
+
+TEST_F(TestLatencyHistogram, QuantilesWithinRelativeError) {
+    LatencyHistogram histogram;
+    for (long value{1}; value <= 1000; ++value)
+        histogram.record(value * 1000);
+    EXPECT_EQ(histogram.getCount(), 1000);
+    EXPECT_EQ(histogram.getMax(), 1000000);
+    for (const double quantile : {0.5, 0.95, 0.99}) {
+        const auto exact{static_cast<double>(quantile * 1000000)};
+        EXPECT_GE(histogram.getQuantile(quantile), exact);
+        EXPECT_LE(histogram.getQuantile(quantile), exact * (1.0 + 1.0 / LatencyHistogram::numSubBuckets));
+    }
+    EXPECT_EQ(histogram.getQuantile(1.0), 1000000);
+}
+
+TEST_F(TestLatencyHistogram, MergeAndReset) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    for (long value{1}; value <= 100; ++value)
+        first.record(value);
+    for (long value{0}; value < 100; ++value)
+        second.record(1000000);
+    first.merge(second);
+    EXPECT_EQ(first.getCount(), 200);
+    EXPECT_EQ(first.getMax(), 1000000);
+    EXPECT_LT(first.getQuantile(0.5), 1000000);
+    EXPECT_GE(first.getQuantile(0.51), 1000000);
+    first.reset();
+    EXPECT_EQ(first.getCount(), 0);
+    EXPECT_EQ(first.getQuantile(0.99), 0);
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+class TestLatencyHistogram : public testing::Test {};
@@ -0,0 +1,69 @@
+#include "test_task_scheduler.h"
+#include "commonroad_cpp/auxiliaryDefs/task_scheduler.h"
+#include <atomic>
+#include <stdexcept>
+
+TEST_F(TestTaskScheduler, InvalidNumberOfThreads) { EXPECT_THROW(TaskScheduler{0}, std::invalid_argument); }
+
+TEST_F(TestTaskScheduler, ExecuteNestedTasks) {
+    TaskScheduler scheduler{3};
+    std::atomic_size_t numExecutedTasks{0};
+    for (size_t scenario{0}; scenario < 4; ++scenario)
+        scheduler.submit(
+            [&scheduler, &numExecutedTasks]() {
+                numExecutedTasks++;
+                for (size_t chunk{0}; chunk < 25; ++chunk)
+                    scheduler.submit([&numExecutedTasks]() { numExecutedTasks++; }, "chunk");
+            },
+            "scenario");
+    scheduler.wait();
+    EXPECT_EQ(numExecutedTasks, 104);
+    EXPECT_EQ(scheduler.getNumThreads(), 3);
+
+    const auto timings{scheduler.getTaskTimings()};
+    EXPECT_EQ(timings.size(), 104);
+    size_t numScenarioTasks{0};
+    for (const auto &timing : timings) {
+        EXPECT_LT(timing.worker, 3);
+        EXPECT_GE(timing.duration, 0);
+        numScenarioTasks += timing.label == "scenario" ? 1 : 0;
+    }
+    EXPECT_EQ(numScenarioTasks, 4);
+
+    const auto statistics{scheduler.getWorkerStatistics()};
+    ASSERT_EQ(statistics.size(), 3);
+    size_t numTasks{0};
+    for (const auto &stat : statistics) {
+        numTasks += stat.numExecutedTasks;
+        EXPECT_LE(stat.numStolenTasks, stat.numExecutedTasks);
+    }
+    EXPECT_EQ(numTasks, 104);
+}
+
+TEST_F(TestTaskScheduler, RethrowException) {
+    TaskScheduler scheduler{2};
+    std::atomic_size_t numExecutedTasks{0};
+    scheduler.submit([]() { throw std::runtime_error("task failed"); });
+    for (size_t index{0}; index < 10; ++index)
+        scheduler.submit([&numExecutedTasks]() { numExecutedTasks++; });
+    EXPECT_THROW(scheduler.wait(), std::runtime_error);
+    EXPECT_EQ(numExecutedTasks, 10);
+    // exception is only rethrown once
+    EXPECT_NO_THROW(scheduler.wait());
+}
+
+TEST_F(TestTaskScheduler, DisableTimings) {
+    TaskScheduler scheduler{2, false};
+    std::atomic_size_t numExecutedTasks{0};
+    for (size_t round{0}; round < 3; ++round) {
+        for (size_t index{0}; index < 10; ++index)
+            scheduler.submit([&numExecutedTasks]() { numExecutedTasks++; }, "task");
+        scheduler.wait();
+    }
+    EXPECT_EQ(numExecutedTasks, 30);
+    EXPECT_TRUE(scheduler.getTaskTimings().empty());
+    size_t numTasks{0};
+    for (const auto &stat : scheduler.getWorkerStatistics())
+        numTasks += stat.numExecutedTasks;
+    EXPECT_EQ(numTasks, 30);
+}
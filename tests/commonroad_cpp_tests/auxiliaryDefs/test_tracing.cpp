@@ -0,0 +1,104 @@
+#include "test_tracing.h"
+#include "commonroad_cpp/auxiliaryDefs/tracing.h"
+#include "commonroad_cpp/predicates/position/in_front_of_predicate.h"
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+
+void TestTracing::SetUp() { TraceRecorder::reset(); }
+
+void TestTracing::TearDown() {
+    TraceRecorder::disable();
+    TraceRecorder::reset();
+}
+
+TEST_F(TestTracing, DisabledRecording) {
+    EXPECT_FALSE(TraceRecorder::isEnabled());
+    { const TraceSpan span{"span", "test"}; }
+    EXPECT_TRUE(TraceRecorder::getEvents().empty());
+}
+
+TEST_F(TestTracing, RecordNestedSpans) {
+    TraceRecorder::enable();
+    EXPECT_TRUE(TraceRecorder::isEnabled());
+    {
+        const TraceSpan outer{"outer", "test"};
+        { const TraceSpan inner{"inner", "test"}; }
+    }
+    TraceRecorder::disable();
+    { const TraceSpan span{"disabled", "test"}; }
+
+    const auto events{TraceRecorder::getEvents()};
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_STREQ(events[0].name, "outer");
+    EXPECT_STREQ(events[1].name, "inner");
+    EXPECT_STREQ(events[1].category, "test");
+    EXPECT_LE(events[0].start, events[1].start);
+    EXPECT_GE(events[0].start + events[0].duration, events[1].start + events[1].duration);
+    EXPECT_EQ(events[0].thread, events[1].thread);
+
+    TraceRecorder::reset();
+    EXPECT_TRUE(TraceRecorder::getEvents().empty());
+}
+
+TEST_F(TestTracing, RecordMultipleThreads) {
+    TraceRecorder::enable();
+    { const TraceSpan span{"main", "test"}; }
+    std::thread thread{[]() { const TraceSpan span{"worker", "test"}; }};
+    thread.join();
+
+    const auto events{TraceRecorder::getEvents()};
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].thread, events[1].thread);
+}
+
+TEST_F(TestTracing, InternName) {
+    const std::string name{"predicate"};
+    const auto *interned{TraceRecorder::internName(name)};
+    EXPECT_STREQ(interned, "predicate");
+    EXPECT_NE(interned, name.c_str());
+    EXPECT_EQ(TraceRecorder::internName("predicate"), interned);
+    EXPECT_NE(TraceRecorder::internName("other"), interned);
+}
+
+TEST_F(TestTracing, PredicateTraceName) {
+    const InFrontOfPredicate predicate;
+    const auto *name{predicate.getTraceName()};
+#if __has_include(<cxxabi.h>)
+    EXPECT_STREQ(name, "InFrontOfPredicate");
+#endif
+    EXPECT_EQ(predicate.getTraceName(), name);
+    EXPECT_EQ(TraceRecorder::internName(name), name);
+}
+
+TEST_F(TestTracing, WriteChromeTrace) {
+    TraceRecorder::enable();
+    { const TraceSpan span{"World::\"update\"", "world"}; }
+    TraceRecorder::disable();
+
+    std::stringstream stream;
+    TraceRecorder::writeChromeTrace(stream);
+    const auto trace{stream.str()};
+    EXPECT_NE(trace.find("\"traceEvents\": ["), std::string::npos);
+    EXPECT_NE(trace.find("\"name\": \"World::\\\"update\\\"\""), std::string::npos);
+    EXPECT_NE(trace.find("\"cat\": \"world\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\": \"X\""), std::string::npos);
+
+    EXPECT_THROW(TraceRecorder::writeChromeTrace(std::string{"/nonexistent/directory/trace.json"}),
+                 std::runtime_error);
+}
+
+TEST_F(TestTracing, SpanMacro) {
+    TraceRecorder::enable();
+    {
+        ENV_MODEL_TRACE_SPAN("first", "test");
+        ENV_MODEL_TRACE_SPAN("second", "test");
+    }
+    TraceRecorder::disable();
+#ifdef ENV_MODEL_TRACING
+    EXPECT_EQ(TraceRecorder::getEvents().size(), 2);
+#else
+    EXPECT_TRUE(TraceRecorder::getEvents().empty());
+#endif
+}
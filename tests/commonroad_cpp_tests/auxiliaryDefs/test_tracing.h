@@ -0,0 +1,9 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+class TestTracing : public testing::Test {
+  protected:
+    void SetUp() override;
+    void TearDown() override;
+};
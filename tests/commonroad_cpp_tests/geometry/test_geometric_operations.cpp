@@ -3,6 +3,8 @@
 #include "commonroad_cpp/geometry/geometric_operations.h"
 
 #include <cmath>
+#include <geometry/curvilinear_coordinate_system.h>
+#include <stdexcept>
 
 void GeometricOperationsTest::SetUp() {}
 
@@ -239,3 +241,27 @@ TEST_F(GeometricOperationsTest, computeDistanceFromPolylines) {
     EXPECT_THROW(geometric_operations::computeDistanceFromPolylines(polylineA, polylineC), std::logic_error);
     EXPECT_THROW(geometric_operations::computeDistanceFromPolylines(polylineA, polylineD), std::logic_error);
 }
+
+TEST_F(GeometricOperationsTest, ConvertPointsToCurvilinear) {
+    geometry::EigenPolyline referencePath;
+    for (int idx{0}; idx <= 50; ++idx)
+        referencePath.emplace_back(idx * 2.0, 0.1 * std::pow(idx * 2.0 - 50.0, 2) / 50.0);
+    const geometry::CurvilinearCoordinateSystem ccs{referencePath};
+
+    std::vector<vertex> points{{10.0, 1.0}, {10.5, -1.5}, {42.0, 2.0}, {80.0, -0.5}, {79.0, 1.0}};
+    const auto convertedPoints{geometric_operations::convertPointsToCurvilinear(ccs, points)};
+    ASSERT_EQ(convertedPoints.size(), points.size());
+    for (size_t idx{0}; idx < points.size(); ++idx) {
+        const auto expected{ccs.convertToCurvilinearCoords(points[idx].x, points[idx].y)};
+        EXPECT_NEAR(convertedPoints[idx].x, expected.x(), 1e-9);
+        EXPECT_NEAR(convertedPoints[idx].y, expected.y(), 1e-9);
+    }
+
+    const auto convertedPoint{geometric_operations::convertPointsToCurvilinear(ccs, {points.front()})};
+    ASSERT_EQ(convertedPoint.size(), 1);
+    EXPECT_NEAR(convertedPoint.front().x, convertedPoints.front().x, 1e-9);
+    EXPECT_TRUE(geometric_operations::convertPointsToCurvilinear(ccs, {}).empty());
+
+    points.push_back({50.0, 500.0});
+    EXPECT_THROW(geometric_operations::convertPointsToCurvilinear(ccs, points), std::invalid_argument);
+}
@@ -0,0 +1,78 @@
+#include <boost/geometry.hpp>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "commonroad_cpp/geometry/geometric_operations.h"
+#include "test_oriented_bounding_box.h"
+
+namespace bg = boost::geometry;
+
+namespace {
+polygon_type createRectangle(const vertex &center, double length, double width, double orientation) {
+    const auto vertices{geometric_operations::rotateAndTranslateVertices(
+        geometric_operations::addObjectDimensionsRectangle({vertex{0.0, 0.0}}, length, width), center, orientation)};
+    polygon_type polygon;
+    for (const auto &vert : vertices)
+        polygon.outer().emplace_back(vert.x, vert.y);
+    polygon.outer().emplace_back(vertices.front().x, vertices.front().y);
+    bg::correct(polygon);
+    return polygon;
+}
+} // namespace
+
+void OrientedBoundingBoxTest::SetUp() {
+    boxOne = OrientedBoundingBox::fromRectangle(createRectangle({0.0, 0.0}, 4.0, 2.0, 0.0));
+    boxTwo = OrientedBoundingBox::fromRectangle(createRectangle({3.5, 1.5}, 4.0, 2.0, M_PI / 4));
+    boxThree = OrientedBoundingBox::fromRectangle(createRectangle({2.0, 3.5}, 2.0, 1.0, 0.0));
+}
+
+TEST_F(OrientedBoundingBoxTest, Initialization) {
+    EXPECT_NEAR(boxOne.getCenter().x, 0.0, 1e-12);
+    EXPECT_NEAR(boxOne.getCenter().y, 0.0, 1e-12);
+    EXPECT_NEAR(boxTwo.getCenter().x, 3.5, 1e-12);
+    EXPECT_NEAR(boxTwo.getCenter().y, 1.5, 1e-12);
+    const auto bounds{boxOne.getAxisAlignedBoundingBox()};
+    EXPECT_NEAR(bounds.min_corner().x(), -2.0, 1e-12);
+    EXPECT_NEAR(bounds.min_corner().y(), -1.0, 1e-12);
+    EXPECT_NEAR(bounds.max_corner().x(), 2.0, 1e-12);
+    EXPECT_NEAR(bounds.max_corner().y(), 1.0, 1e-12);
+    EXPECT_THROW(OrientedBoundingBox::fromRectangle(polygon_type{{{0.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}}}),
+                 std::invalid_argument);
+}
+
+TEST_F(OrientedBoundingBoxTest, Intersects) {
+    EXPECT_TRUE(boxOne.intersects(boxTwo));
+    EXPECT_TRUE(boxTwo.intersects(boxOne));
+    // axis-aligned bounding boxes overlap but the boxes are separated along an edge normal of the rotated box
+    EXPECT_TRUE(bg::intersects(boxTwo.getAxisAlignedBoundingBox(), boxThree.getAxisAlignedBoundingBox()));
+    EXPECT_FALSE(boxTwo.intersects(boxThree));
+    EXPECT_FALSE(boxThree.intersects(boxTwo));
+    EXPECT_FALSE(boxOne.intersects(boxThree));
+    // touching boxes intersect
+    EXPECT_TRUE(boxOne.intersects(OrientedBoundingBox::fromRectangle(createRectangle({4.0, 0.0}, 4.0, 2.0, 0.0))));
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> position{-5.0, 5.0};
+    std::uniform_real_distribution<double> dimension{0.1, 5.0};
+    std::uniform_real_distribution<double> orientation{-M_PI, M_PI};
+    for (size_t idx{0}; idx < 1000; ++idx) {
+        const auto rectangleOne{createRectangle({position(generator), position(generator)}, dimension(generator),
+                                                dimension(generator), orientation(generator))};
+        const auto rectangleTwo{createRectangle({position(generator), position(generator)}, dimension(generator),
+                                                dimension(generator), orientation(generator))};
+        EXPECT_EQ(OrientedBoundingBox::fromRectangle(rectangleOne)
+                      .intersects(OrientedBoundingBox::fromRectangle(rectangleTwo)),
+                  bg::intersects(rectangleOne, rectangleTwo));
+    }
+}
+
+TEST_F(OrientedBoundingBoxTest, Separation) {
+    const std::vector<vertex> triangle{{3.0, -1.0}, {5.0, -1.0}, {3.0, 1.0}};
+    EXPECT_NEAR(boxOne.separation(triangle), 1.0, 1e-12);
+    const std::vector<vertex> diagonalTriangle{{3.0, 2.0}, {4.0, 2.0}, {4.0, 3.0}};
+    // the gap is a lower bound of the distance sqrt(2)
+    EXPECT_NEAR(boxOne.separation(diagonalTriangle), 1.0, 1e-12);
+    EXPECT_LE(boxTwo.separation(triangle), 0.0);
+    EXPECT_LE(boxOne.separation({{-1.0, -0.5}, {1.0, -0.5}, {0.0, 0.5}}), 0.0);
+}
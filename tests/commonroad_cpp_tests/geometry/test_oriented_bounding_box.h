@@ -0,0 +1,14 @@
+#pragma once
+
+#include "commonroad_cpp/geometry/oriented_bounding_box.h"
+#include <gtest/gtest.h>
+
+class OrientedBoundingBoxTest : public testing::Test {
+  protected:
+    OrientedBoundingBox boxOne;
+    OrientedBoundingBox boxTwo;
+    OrientedBoundingBox boxThree;
+
+  private:
+    void SetUp() override;
+};
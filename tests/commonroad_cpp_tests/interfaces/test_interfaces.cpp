@@ -5,11 +5,13 @@
 #include <tuple>
 
 #include "commonroad_cpp/geometry/polygon.h"
+#include "commonroad_cpp/interfaces/commonroad/protobuf_reader.h"
 #include "commonroad_cpp/geometry/shape_group.h"
 #include "commonroad_cpp/obstacle/occupancy.h"
 #include "commonroad_cpp/roadNetwork/intersection/crossing_group.h"
 #include "commonroad_cpp/roadNetwork/intersection/incoming_group.h"
 #include "commonroad_cpp/roadNetwork/intersection/intersection.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lanelet.h"
 #include "commonroad_cpp/roadNetwork/regulatoryElements/traffic_light.h"
 #include "commonroad_cpp/roadNetwork/regulatoryElements/traffic_sign.h"
 #include "commonroad_cpp/roadNetwork/road_network.h"
@@ -58,6 +60,90 @@ TEST_F(InterfacesTest, Read2020aFileSingleThread) {
     EXPECT_EQ(lanelets.size(), 95);
 }
 
+TEST_F(InterfacesTest, ReadScenarioSingleParse) {
+    std::string xmlFilePath{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1_1_T-1.xml"};
+
+    const auto scenario{XMLReader::createScenarioFromXML(xmlFilePath)};
+
+    EXPECT_EQ(scenario.roadNetwork->getTrafficSigns().size(), 95);
+    EXPECT_EQ(scenario.roadNetwork->getTrafficLights().size(), 8);
+    EXPECT_EQ(scenario.roadNetwork->getIntersections().size(), 1);
+    EXPECT_EQ(scenario.obstacles.size(), 24);
+    EXPECT_EQ(scenario.roadNetwork->getLaneletNetwork().size(), 95);
+    EXPECT_EQ(scenario.timeStepSize, XMLReader::extractTimeStepSize(xmlFilePath));
+    EXPECT_EQ(scenario.planningProblems.size(), XMLReader::createPlanningProblemFromXML(xmlFilePath).size());
+}
+
+TEST_F(InterfacesTest, ReadMultipleFiles) {
+    std::vector<std::string> paths{
+        TestUtils::getTestScenarioDirectory() + "/DEU_BicycleBothRight-1/DEU_BicycleBothRight-1_1_T-1.pb",
+        TestUtils::getTestScenarioDirectory() + "/ZAM_TestReadingAll-1/ZAM_TestReadingAll-1_1_T-1.pb",
+        TestUtils::getTestScenarioDirectory() + "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb"};
+
+    const auto scenarios{InputUtils::getDataFromCommonRoadFiles(paths, 2)};
+
+    ASSERT_EQ(scenarios.size(), paths.size());
+    for (size_t idx{0}; idx < paths.size(); ++idx) {
+        const auto scenario{InputUtils::getDataFromCommonRoad(paths[idx])};
+        EXPECT_EQ(scenarios[idx].obstacles.size(), scenario.obstacles.size());
+        EXPECT_EQ(scenarios[idx].roadNetwork->getLaneletNetwork().size(),
+                  scenario.roadNetwork->getLaneletNetwork().size());
+        EXPECT_EQ(scenarios[idx].timeStepSize, scenario.timeStepSize);
+    }
+    EXPECT_TRUE(InputUtils::getDataFromCommonRoadFiles({}, 2).empty());
+    paths.push_back(TestUtils::getTestScenarioDirectory() + "/invalid.txt");
+    EXPECT_THROW(static_cast<void>(InputUtils::getDataFromCommonRoadFiles(paths, 2)), std::runtime_error);
+}
+
+TEST_F(InterfacesTest, ReadProtobufFileList) {
+    const std::string dir{TestUtils::getTestScenarioDirectory() + "/ZAM_TestReadingAll-1/"};
+    const std::vector<ProtobufReader::ScenarioFiles> files{
+        {dir + "ZAM_TestReadingAll-1.pb", dir + "ZAM_TestReadingAll-1_1_T-1.pb",
+         dir + "ZAM_TestReadingAll-1_1_T-1-SC.pb"},
+        {dir + "ZAM_TestReadingAll-1.pb", {}, {}}};
+
+    const auto scenarios{InputUtils::getDataFromProtobufFiles(files, 2)};
+
+    ASSERT_EQ(scenarios.size(), files.size());
+    const auto scenario{InputUtils::getDataFromCommonRoad(dir + "ZAM_TestReadingAll-1_1_T-1.pb")};
+    EXPECT_EQ(scenarios[0].obstacles.size(), scenario.obstacles.size());
+    EXPECT_EQ(scenarios[0].planningProblems.size(), scenario.planningProblems.size());
+    EXPECT_EQ(scenarios[0].timeStepSize, scenario.timeStepSize);
+    EXPECT_EQ(scenarios[1].timeStepSize, 0);
+    EXPECT_TRUE(scenarios[1].planningProblems.empty());
+
+    // lanelets are constructed directly from the boundary messages
+    const auto mapMsg{ProtobufReader::loadMapProtobufMessage(files[0].mapFile)};
+    for (const auto &laneletMsg : mapMsg.lanelets()) {
+        const auto lanelet{scenarios[0].roadNetwork->findLaneletById(laneletMsg.lanelet_id())};
+        for (const auto &boundMsg : mapMsg.boundaries()) {
+            const auto bound{ProtobufReader::createBoundFromMessage(boundMsg)};
+            if (boundMsg.boundary_id() == laneletMsg.left_bound()) {
+                EXPECT_EQ(lanelet->getLeftBorderVertices(), bound->getVertices());
+                EXPECT_EQ(lanelet->getLineMarkingLeft(), bound->getLineMarking());
+            }
+            if (boundMsg.boundary_id() == laneletMsg.right_bound()) {
+                EXPECT_EQ(lanelet->getRightBorderVertices(), bound->getVertices());
+                EXPECT_EQ(lanelet->getLineMarkingRight(), bound->getLineMarking());
+            }
+        }
+        ASSERT_EQ(lanelet->getCenterVertices().size(), lanelet->getLeftBorderVertices().size());
+        for (size_t idx{0}; idx < lanelet->getCenterVertices().size(); ++idx)
+            EXPECT_EQ(lanelet->getCenterVertices()[idx],
+                      (lanelet->getLeftBorderVertices()[idx] + lanelet->getRightBorderVertices()[idx]) / 2.);
+        EXPECT_EQ(lanelet->getStopLine() != nullptr, laneletMsg.has_stop_line());
+        EXPECT_FALSE(lanelet->getOuterPolygon().outer().empty());
+        EXPECT_EQ(scenarios[1].roadNetwork->findLaneletById(laneletMsg.lanelet_id())->getLeftBorderVertices(),
+                  lanelet->getLeftBorderVertices());
+    }
+
+    EXPECT_TRUE(InputUtils::getDataFromProtobufFiles({}, 2).empty());
+    EXPECT_THROW(static_cast<void>(InputUtils::getDataFromProtobufFiles({{dir + "missing.pb", {}, {}}})),
+                 std::runtime_error);
+    EXPECT_THROW(static_cast<void>(InputUtils::getDataFromProtobufFiles({{{}, files[0].dynamicFile, {}}})),
+                 std::runtime_error);
+}
+
 TEST_F(InterfacesTest, SamePredecessors) {
     std::string scenarioName = "ARG_Carcarana-6_5_T-1";
     const auto &[scenarioXml, scenarioPb] = InterfacesTest::loadXmlAndPbScenarios(scenarioName);
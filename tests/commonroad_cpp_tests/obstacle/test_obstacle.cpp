@@ -6,6 +6,10 @@
 #include <commonroad_cpp/interfaces/commonroad/input_utils.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane.h>
 #include <commonroad_cpp/world.h>
+#include <geometry/curvilinear_coordinate_system.h>
+#include <optional>
+#include <thread>
+#include <tuple>
 
 void ObstacleTestInitialization::setUpObstacles() {
     size_t globalID{1234};
@@ -249,6 +253,24 @@ TEST_F(ObstacleTest, GetOccupancyPolygonShape) {
     EXPECT_EQ(obstacleOne->getOccupancyPolygonShape(1).at(0).outer().at(0).y(), 0.0);
     EXPECT_EQ(obstacleSix->getOccupancyPolygonShape(7).at(0).outer().at(3).x(), 69.0);
     EXPECT_EQ(obstacleSix->getOccupancyPolygonShape(7).at(0).outer().at(1).y(), -4.0);
+
+    // cached shape is returned without copy and stays valid when further shapes are cached
+    const auto &shape{obstacleOne->getOccupancyPolygonShape(0)};
+    for (const auto &timeStep : obstacleOne->getTimeSteps())
+        EXPECT_FALSE(obstacleOne->getOccupancyPolygonShape(timeStep).empty());
+    EXPECT_EQ(&shape, &obstacleOne->getOccupancyPolygonShape(0));
+    EXPECT_EQ(shape.at(0).outer().at(0).x(), 0.5);
+}
+
+TEST_F(ObstacleTest, GetShapePtr) {
+    const auto shape{obstacleOne->getShapePtr()};
+    ASSERT_NE(shape, nullptr);
+    EXPECT_NE(shape.get(), &obstacleOne->getGeoShape());
+    EXPECT_EQ(shape->getType(), ShapeType::rectangle);
+    EXPECT_EQ(shape->getLength(), obstacleOne->getGeoShape().getLength());
+    EXPECT_EQ(shape->getWidth(), obstacleOne->getGeoShape().getWidth());
+    shape->setLength(2 * obstacleOne->getGeoShape().getLength() + 1.0);
+    EXPECT_NE(shape->getLength(), obstacleOne->getGeoShape().getLength());
 }
 
 TEST_F(ObstacleTest, GetOccupiedLanelets) {
@@ -304,10 +326,133 @@ TEST_F(ObstacleTest, ConvertPointToCurvilinear) {
     EXPECT_EQ(stateOne->getLatPosition(), -4.25);
 }
 
+TEST_F(ObstacleTest, ConvertPointsToCurvilinear) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() +
+                               "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    roadNetworkScenario->setIdCounterRef(std::make_shared<size_t>(123456789));
+
+    size_t numConverted{0};
+    for (const auto &obs : obstaclesScenario) {
+        if (obs->getGeoShape().getType() != ShapeType::rectangle)
+            continue;
+        const auto timeStep{obs->getCurrentState()->getTimeStep()};
+        std::shared_ptr<geometry::CurvilinearCoordinateSystem> ccs;
+        try {
+            ccs = obs->getReferenceLane(roadNetworkScenario, timeStep)->getCurvilinearCoordinateSystem();
+        } catch (const std::runtime_error &) {
+            continue;
+        }
+        std::vector<size_t> timeSteps;
+        for (const auto &time : obs->getTimeSteps())
+            if (ccs->cartesianPointInProjectionDomain(obs->getStateByTimeStep(time)->getXPosition(),
+                                                      obs->getStateByTimeStep(time)->getYPosition()))
+                timeSteps.push_back(time);
+
+        const auto positions{obs->convertPointsToCurvilinear(timeSteps, ccs)};
+        ASSERT_EQ(positions.size(), timeSteps.size());
+        for (size_t idx{0}; idx < timeSteps.size(); ++idx) {
+            const auto expected{obs->convertPointToCurvilinear(timeSteps[idx], ccs)};
+            for (size_t dim{0}; dim < expected.size(); ++dim)
+                EXPECT_NEAR(positions[idx][dim], expected[dim], 1e-9);
+        }
+        numConverted += timeSteps.size();
+    }
+    EXPECT_GT(numConverted, 0);
+
+    // positions of all obstacles at a time step
+    const auto timeStep{obstaclesScenario.front()->getCurrentState()->getTimeStep()};
+    const auto ccs{obstaclesScenario.front()->getReferenceLane(roadNetworkScenario, timeStep)
+                       ->getCurvilinearCoordinateSystem()};
+    std::vector<std::optional<double>> expected;
+    for (const auto &obs : obstaclesScenario) {
+        obs->clearCache();
+        if (obs->timeStepExists(timeStep) and
+            ccs->cartesianPointInProjectionDomain(obs->getStateByTimeStep(timeStep)->getXPosition(),
+                                                  obs->getStateByTimeStep(timeStep)->getYPosition()))
+            expected.emplace_back(obs->convertPointToCurvilinear(timeStep, ccs)[0]);
+        else
+            expected.emplace_back(std::nullopt);
+        obs->clearCache();
+    }
+    Obstacle::convertPointsToCurvilinear(obstaclesScenario, timeStep, ccs);
+    for (size_t idx{0}; idx < obstaclesScenario.size(); ++idx)
+        if (expected[idx])
+            EXPECT_NEAR(obstaclesScenario[idx]->getLonPosition(timeStep, ccs), *expected[idx], 1e-9);
+}
+
 TEST_F(ObstacleTest, SetOccupiedLaneletsDrivingDirectionByShape) {
     EXPECT_NO_THROW(obstacleOne->getOccupiedLaneletsDrivingDirectionByShape(roadNetwork, 0));
 }
 
+TEST_F(ObstacleTest, ConcurrentCacheAccess) {
+    // stress test which is intended to be executed with ThreadSanitizer, see docs/cpp_dev.md
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() +
+                               "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    roadNetworkScenario->setIdCounterRef(std::make_shared<size_t>(123456789));
+
+    using query_t =
+        std::tuple<std::shared_ptr<Obstacle>, size_t, std::shared_ptr<geometry::CurvilinearCoordinateSystem>>;
+    using result_t = std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<double>, std::optional<double>>;
+    std::vector<query_t> queries;
+    for (const auto &obs : obstaclesScenario) {
+        if (obs->getGeoShape().getType() != ShapeType::rectangle)
+            continue;
+        std::shared_ptr<geometry::CurvilinearCoordinateSystem> ccs;
+        try {
+            ccs = obs->getReferenceLane(roadNetworkScenario, obs->getCurrentState()->getTimeStep())
+                      ->getCurvilinearCoordinateSystem();
+        } catch (const std::runtime_error &) {
+            continue;
+        }
+        for (const auto &timeStep : obs->getTimeSteps())
+            queries.emplace_back(obs, timeStep, ccs);
+    }
+    ASSERT_FALSE(queries.empty());
+
+    auto evaluate{[roadNetwork{roadNetworkScenario}](const query_t &query) {
+        const auto &[obs, timeStep, ccs] = query;
+        result_t result;
+        for (const auto &let : obs->getOccupiedLaneletsByShape(roadNetwork, timeStep))
+            std::get<0>(result).push_back(let->getId());
+        for (const auto &let : obs->getOccupiedLaneletsByFront(roadNetwork, timeStep))
+            std::get<1>(result).push_back(let->getId());
+        std::get<2>(result) = obs->getFrontXYCoordinates(timeStep);
+        try {
+            std::get<3>(result) = obs->getLonPosition(timeStep, ccs);
+        } catch (const std::runtime_error &) {
+            std::get<3>(result) = std::nullopt;
+        }
+        return result;
+    }};
+
+    std::vector<result_t> expected;
+    for (const auto &query : queries)
+        expected.push_back(evaluate(query));
+    for (const auto &obs : obstaclesScenario)
+        obs->clearCache();
+
+    const size_t numThreads{8};
+    std::vector<std::vector<result_t>> results(numThreads, std::vector<result_t>(queries.size()));
+    std::vector<std::thread> threads;
+    for (size_t threadIdx{0}; threadIdx < numThreads; ++threadIdx)
+        threads.emplace_back([&, threadIdx]() {
+            // threads start at different queries so that the same cache entries are computed concurrently
+            for (size_t idx{0}; idx < queries.size(); ++idx) {
+                const size_t queryIdx{(idx + threadIdx * queries.size() / numThreads) % queries.size()};
+                results[threadIdx][queryIdx] = evaluate(queries[queryIdx]);
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &result : results)
+        EXPECT_EQ(result, expected);
+}
+
 TEST_F(ObstacleTest, SetReferenceGeneralScenario1) {
     size_t timeStep{0};
     std::string pathToTestFileOne{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
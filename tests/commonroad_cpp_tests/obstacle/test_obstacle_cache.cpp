@@ -0,0 +1,153 @@
+#include "test_obstacle_cache.h"
+#include "commonroad_cpp/obstacle/obstacle_cache.h"
+#include <thread>
+
+namespace {
+
+template <template <typename...> class Storage> void testShardedTimeStepMapAccess() {
+    ShardedTimeStepMap<double, Storage> cache;
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_FALSE(cache.find(1).has_value());
+    EXPECT_EQ(cache.emplace(1, 2.0), 2.0);
+    EXPECT_EQ(cache.emplace(1, 3.0), 2.0); // existing value is kept
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_EQ(cache.find(1).value(), 2.0);
+    cache.insertOrAssign(1, 3.0);
+    EXPECT_EQ(cache.find(1).value(), 3.0);
+    EXPECT_EQ(cache.getOrCompute(1, []() { return 4.0; }), 3.0);
+    EXPECT_EQ(cache.getOrCompute(6, []() { return 4.0; }), 4.0);
+    EXPECT_EQ(cache.modify(6, [](double &value) { return value += 1.0; }), 5.0);
+    EXPECT_EQ(cache.modify(7, [](double &value) { return value; }), 0.0);
+    EXPECT_TRUE(cache.visit(6, [](const double *value) { return value != nullptr and *value == 5.0; }));
+    EXPECT_TRUE(cache.visit(8, [](const double *value) { return value == nullptr; }));
+    EXPECT_EQ(cache.size(), 3);
+
+    auto copy{cache};
+    cache.erase(6);
+    EXPECT_FALSE(cache.contains(6));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy.find(6).value(), 5.0);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    copy = cache;
+    EXPECT_EQ(copy.size(), 0);
+}
+
+} // namespace
+
+TEST_F(ObstacleCacheTest, ShardedTimeStepMapAccess) {
+    testShardedTimeStepMapAccess<HashTimeStepStorage>();
+    testShardedTimeStepMapAccess<DenseTimeStepStorage>();
+}
+
+TEST_F(ObstacleCacheTest, DenseTimeStepStorage) {
+    DenseTimeStepStorage<std::vector<double>> storage;
+    EXPECT_EQ(storage.find(5), nullptr);
+    EXPECT_EQ(storage.tryEmplace(5, {5.0}).at(0), 5.0);
+    // array is extended in front of and behind the first time step
+    EXPECT_EQ(storage.tryEmplace(2, {2.0}).at(0), 2.0);
+    storage[9].push_back(9.0);
+    EXPECT_EQ(storage.size(), 3);
+    for (time_step_t index{0}; index < 12; ++index) {
+        if (index == 2 or index == 5 or index == 9)
+            EXPECT_EQ(storage.find(index)->at(0), static_cast<double>(index));
+        else
+            EXPECT_EQ(storage.find(index), nullptr);
+    }
+    EXPECT_EQ(storage.tryEmplace(5, {6.0}).at(0), 5.0);
+
+    storage.erase(5);
+    storage.erase(6);
+    EXPECT_EQ(storage.find(5), nullptr);
+    EXPECT_EQ(storage.size(), 2);
+    // erased entries are default constructed when they are accessed again
+    EXPECT_TRUE(storage[5].empty());
+    storage.erase(2);
+    storage.erase(5);
+    storage.erase(9);
+    EXPECT_EQ(storage.size(), 0);
+    // offset is reset after all values are removed
+    EXPECT_EQ(storage.tryEmplace(100, {100.0}).at(0), 100.0);
+    EXPECT_EQ(storage.find(2), nullptr);
+    EXPECT_EQ(storage.size(), 1);
+    storage.clear();
+    EXPECT_EQ(storage.find(100), nullptr);
+    EXPECT_EQ(storage.size(), 0);
+
+    // sliding window as used for the history of obstacles
+    for (time_step_t index{0}; index < 100; ++index) {
+        storage.tryEmplace(index, {static_cast<double>(index)});
+        if (index >= 10)
+            storage.erase(index - 10);
+        EXPECT_EQ(storage.size(), std::min<size_t>(index + 1, 10));
+    }
+    for (time_step_t index{0}; index < 100; ++index) {
+        if (index < 90)
+            EXPECT_EQ(storage.find(index), nullptr);
+        else
+            EXPECT_EQ(storage.find(index)->at(0), static_cast<double>(index));
+    }
+}
+
+TEST_F(ObstacleCacheTest, RemoveTimeStepFromMappingVariables) {
+    ObstacleCache cache;
+    for (time_step_t timeStep{0}; timeStep < 10; ++timeStep) {
+        cache.frontXYPositions.emplace(timeStep, {1.0, 2.0});
+        cache.leftLatPosition.emplace(timeStep, 1.0);
+        cache.referenceLane.emplace(timeStep, nullptr);
+        cache.occupiedLanelets.emplace(timeStep, {});
+    }
+    cache.removeTimeStepFromMappingVariables(3, false);
+    EXPECT_FALSE(cache.frontXYPositions.contains(3));
+    EXPECT_FALSE(cache.leftLatPosition.contains(3));
+    EXPECT_FALSE(cache.occupiedLanelets.contains(3));
+    EXPECT_TRUE(cache.referenceLane.contains(3));
+    EXPECT_EQ(cache.frontXYPositions.size(), 9);
+    cache.removeTimeStepFromMappingVariables(3, true);
+    EXPECT_FALSE(cache.referenceLane.contains(3));
+    cache.clear();
+    EXPECT_EQ(cache.frontXYPositions.size(), 0);
+    EXPECT_EQ(cache.referenceLane.size(), 0);
+}
+
+TEST_F(ObstacleCacheTest, ConcurrentAccess) {
+    // stress test which is intended to be executed with ThreadSanitizer, see docs/cpp_dev.md
+    ObstacleCache cache;
+    const size_t numThreads{8};
+    const time_step_t numTimeSteps{64};
+    std::vector<std::thread> threads;
+    std::vector<size_t> mismatches(numThreads, 0);
+    for (size_t threadIdx{0}; threadIdx < numThreads; ++threadIdx)
+        threads.emplace_back([&cache, &mismatches, threadIdx, numTimeSteps]() {
+            for (size_t iteration{0}; iteration < 200; ++iteration) {
+                for (time_step_t timeStep{0}; timeStep < numTimeSteps; ++timeStep) {
+                    // threads iterate over time steps with different offsets to provoke concurrent insertions
+                    const time_step_t time{(timeStep + threadIdx * 7) % numTimeSteps};
+                    auto front{cache.frontXYPositions.getOrCompute(
+                        time, [time]() { return std::vector<double>{static_cast<double>(time), 1.0}; })};
+                    if (front.at(0) != static_cast<double>(time))
+                        ++mismatches[threadIdx];
+                    cache.lateralDistanceToObjects.modify(
+                        time, [threadIdx, time](auto &distances) { distances[threadIdx] = static_cast<double>(time); });
+                    if (cache.leftLatPosition.emplace(time, static_cast<double>(time)) != static_cast<double>(time))
+                        ++mismatches[threadIdx];
+                }
+                if (threadIdx == 0 and iteration % 50 == 0)
+                    cache.removeTimeStepFromMappingVariables(iteration % numTimeSteps, true);
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    for (const auto &num : mismatches)
+        EXPECT_EQ(num, 0);
+    EXPECT_EQ(cache.frontXYPositions.size(), numTimeSteps);
+    EXPECT_EQ(cache.leftLatPosition.size(), numTimeSteps);
+    for (time_step_t timeStep{0}; timeStep < numTimeSteps; ++timeStep) {
+        const auto distances{cache.lateralDistanceToObjects.find(timeStep).value()};
+        EXPECT_FALSE(distances.empty());
+        for (const auto &[threadIdx, distance] : distances)
+            EXPECT_EQ(distance, static_cast<double>(timeStep));
+    }
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+class ObstacleCacheTest : public testing::Test {};
@@ -154,3 +154,17 @@ TEST_F(KeepsSafeDistancePrecPredicateTest, SetBasedPrediction) {
     EXPECT_TRUE(pred.booleanEvaluation(0, world, dynamicObstacle, obs1, {"0.0"}, true));
     EXPECT_FALSE(pred.booleanEvaluation(1, world, dynamicObstacle, obs1, {"0.0"}, true));
 }
+
+TEST_F(KeepsSafeDistancePrecPredicateTest, BatchBooleanEvaluation) {
+    const std::vector<ObstaclePair> obstaclePairs{{obstacleOne, obstacleTwo}, {obstacleTwo, obstacleThree}};
+    const auto result{pred.batchBooleanEvaluation(0, 1, world, obstaclePairs)};
+    EXPECT_TRUE(result.at(0, 0).value());
+    EXPECT_FALSE(result.at(1, 0).value());
+    EXPECT_TRUE(result.at(0, 1).value());
+    EXPECT_FALSE(result.at(1, 1).has_value());
+    EXPECT_EQ(result.getValues(),
+              pred.CommonRoadPredicate::batchBooleanEvaluation(0, 1, world, obstaclePairs).getValues());
+
+    EXPECT_THROW(pred.batchBooleanEvaluation(0, 1, world, {{obstacleOne, nullptr}}), std::invalid_argument);
+    EXPECT_THROW(pred.batchBooleanEvaluation(0, 1, world, {{nullptr, obstacleTwo}}), std::invalid_argument);
+}
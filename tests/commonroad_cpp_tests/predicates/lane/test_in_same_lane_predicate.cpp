@@ -127,3 +127,29 @@ TEST_F(TestInSameLanePredicate, SetBasedPrediction) {
     EXPECT_TRUE(pred.booleanEvaluation(25, world, ego, obs2, {}, true));
     EXPECT_TRUE(pred.booleanEvaluation(25, world, ego, obs3, {}, true));
 }
+
+TEST_F(TestInSameLanePredicate, BatchBooleanEvaluation) {
+    const std::vector<ObstaclePair> obstaclePairs{{obstacleOne, obstacleTwo}, {obstacleOne, obstacleThree}};
+    const auto result{pred.batchBooleanEvaluation(0, 4, world, obstaclePairs)};
+    EXPECT_EQ(result.getFirstTimeStep(), 0);
+    EXPECT_EQ(result.getNumTimeSteps(), 5);
+    EXPECT_EQ(result.getNumPairs(), 2);
+    EXPECT_TRUE(result.at(0, 0).value());
+    EXPECT_TRUE(result.at(1, 0).value());
+    EXPECT_TRUE(result.at(2, 0).value());
+    EXPECT_FALSE(result.at(3, 0).value());
+    EXPECT_FALSE(result.at(4, 0).has_value()); // other vehicle does not exist anymore
+    EXPECT_FALSE(result.at(0, 1).has_value()); // other vehicle does not exist yet
+    EXPECT_TRUE(result.at(4, 1).value());
+    EXPECT_THROW(result.at(5, 0), std::out_of_range);
+    EXPECT_THROW(pred.batchBooleanEvaluation(4, 3, world, obstaclePairs), std::invalid_argument);
+}
+
+TEST_F(TestInSameLanePredicate, BatchBooleanEvaluationDefault) {
+    const std::vector<ObstaclePair> obstaclePairs{{obstacleOne, obstacleTwo},
+                                                  {obstacleTwo, obstacleOne},
+                                                  {obstacleOne, obstacleThree},
+                                                  {obstacleThree, obstacleOne}};
+    EXPECT_EQ(pred.batchBooleanEvaluation(0, 4, world, obstaclePairs).getValues(),
+              pred.CommonRoadPredicate::batchBooleanEvaluation(0, 4, world, obstaclePairs).getValues());
+}
@@ -145,3 +145,16 @@ TEST_F(OnLaneletWithTypePredicateTest, SetBasedPrediction) {
     EXPECT_FALSE(pred.booleanEvaluation(1, world, obs2, {}, {"intersection"}, true));
     EXPECT_TRUE(pred.booleanEvaluation(30, world, obs2, {}, {"interstate"}, true));
 }
+
+TEST_F(OnLaneletWithTypePredicateTest, BatchBooleanEvaluation) {
+    initializeTestData("SHOULDER", "interstate");
+    const std::vector<ObstaclePair> obstaclePairs{{egoVehicle, nullptr}, {egoVehicle, nullptr}};
+    const auto result{pred.batchBooleanEvaluation(0, 4, world, obstaclePairs, opt)};
+    for (size_t pairIndex{0}; pairIndex < obstaclePairs.size(); ++pairIndex) {
+        EXPECT_TRUE(result.at(0, pairIndex).value());
+        EXPECT_TRUE(result.at(1, pairIndex).value());
+        EXPECT_TRUE(result.at(2, pairIndex).value());
+        EXPECT_FALSE(result.at(3, pairIndex).value());
+        EXPECT_FALSE(result.at(4, pairIndex).value());
+    }
+}
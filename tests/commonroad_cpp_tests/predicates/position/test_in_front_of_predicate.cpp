@@ -135,3 +135,54 @@ TEST_F(TestInFrontOfPredicate, SetBasedPrediction) {
     EXPECT_TRUE(pred.booleanEvaluation(0, world, ego, obs2, {}, true));
     EXPECT_FALSE(pred.booleanEvaluation(0, world, dynamicObstacle, obs1, {}, true));
 }
+
+TEST_F(TestInFrontOfPredicate, BatchBooleanEvaluation) {
+    const std::vector<ObstaclePair> obstaclePairs{{obstacleOne, obstacleTwo}, {obstacleTwo, obstacleOne}};
+    const auto result{pred.batchBooleanEvaluation(0, 4, world, obstaclePairs)};
+    EXPECT_FALSE(result.at(0, 0).value());
+    EXPECT_TRUE(result.at(0, 1).value());
+    EXPECT_FALSE(result.at(1, 0).value());
+    EXPECT_FALSE(result.at(1, 1).value());
+    EXPECT_FALSE(result.at(2, 0).value());
+    EXPECT_FALSE(result.at(2, 1).value());
+    EXPECT_TRUE(result.at(3, 0).value());
+    EXPECT_FALSE(result.at(3, 1).value());
+    EXPECT_FALSE(result.at(4, 0).has_value()); // obstacle two does not exist
+    EXPECT_FALSE(result.at(4, 1).has_value());
+    EXPECT_EQ(result.getValues(),
+              pred.CommonRoadPredicate::batchBooleanEvaluation(0, 4, world, obstaclePairs).getValues());
+
+    // in front of requires the pth obstacle
+    const std::vector<ObstaclePair> incompletePairs{{obstacleOne, obstacleTwo}, {obstacleOne, nullptr}};
+    EXPECT_THROW(pred.batchBooleanEvaluation(0, 4, world, incompletePairs), std::invalid_argument);
+    EXPECT_THROW(pred.CommonRoadPredicate::batchBooleanEvaluation(0, 4, world, incompletePairs),
+                 std::invalid_argument);
+}
+
+TEST_F(TestInFrontOfPredicate, VectorizedEvaluation) {
+    std::vector<size_t> timeSteps;
+    std::vector<ObstaclePair> obstaclePairs;
+    for (size_t timeStep{0}; timeStep < 4; ++timeStep)
+        for (const auto &pair : std::vector<ObstaclePair>{{obstacleOne, obstacleTwo}, {obstacleTwo, obstacleOne}}) {
+            timeSteps.push_back(timeStep);
+            obstaclePairs.push_back(pair);
+        }
+    const auto booleanResult{pred.vectorizedBooleanEvaluation(timeSteps, world, obstaclePairs)};
+    const auto robustResult{pred.vectorizedRobustEvaluation(timeSteps, world, obstaclePairs)};
+    ASSERT_EQ(booleanResult.size(), timeSteps.size());
+    ASSERT_EQ(robustResult.size(), timeSteps.size());
+    for (size_t idx{0}; idx < timeSteps.size(); ++idx) {
+        EXPECT_EQ(booleanResult[idx] == 1, pred.booleanEvaluation(timeSteps[idx], world, obstaclePairs[idx].first,
+                                                                  obstaclePairs[idx].second));
+        EXPECT_EQ(robustResult[idx], pred.robustEvaluation(timeSteps[idx], world, obstaclePairs[idx].first,
+                                                           obstaclePairs[idx].second));
+    }
+    EXPECT_EQ(pred.vectorizedBooleanEvaluation(timeSteps, world, obstaclePairs, {"0.0"}, false, 3), booleanResult);
+    EXPECT_EQ(pred.vectorizedRobustEvaluation(timeSteps, world, obstaclePairs, {"0.0"}, false, 3), robustResult);
+
+    EXPECT_THROW(pred.vectorizedBooleanEvaluation({4}, world, {{obstacleOne, obstacleTwo}}), std::invalid_argument);
+    EXPECT_THROW(pred.vectorizedRobustEvaluation({0, 1}, world, {{obstacleOne, obstacleTwo}}), std::invalid_argument);
+    // in front of requires the pth obstacle
+    EXPECT_THROW(pred.vectorizedBooleanEvaluation({0}, world, {{obstacleOne, nullptr}}), std::invalid_argument);
+    EXPECT_THROW(pred.vectorizedRobustEvaluation({0}, world, {{obstacleOne, nullptr}}), std::invalid_argument);
+}
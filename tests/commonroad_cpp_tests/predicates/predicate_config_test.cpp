@@ -18,3 +18,18 @@ TEST_F(PredicateConfigTest, getParameterCollection) {
     EXPECT_EQ(std::get<3>(params.getParameterCollection().at("laneMatchingOrientation")), 0.0);
     EXPECT_EQ(std::get<5>(params.getParameterCollection().at("laneMatchingOrientation")), "angle");
 }
+
+TEST_F(PredicateConfigTest, getParamById) {
+    EXPECT_EQ(params.getParam(PredicateParamId::laneMatchingOrientation), 0.35);
+    EXPECT_EQ(params.getParam(PredicateParamId::epsilon), 1e-6);
+    for (size_t idx{0}; idx < numPredicateParams; ++idx)
+        EXPECT_EQ(params.getParam(static_cast<PredicateParamId>(idx)),
+                  params.getParam(std::string{predicateParamNames.at(idx)}));
+    EXPECT_EQ(params.getPredicateNames().size() + params.getConstantNames().size(), numPredicateParams);
+
+    params.updateParam("laneMatchingOrientation", 0.0);
+    params.updateParam("epsilon", 1e-3);
+    EXPECT_EQ(params.getParam(PredicateParamId::laneMatchingOrientation), 0.0);
+    EXPECT_EQ(params.getParam(PredicateParamId::epsilon), 1e-3);
+    EXPECT_THROW(params.updateParam("unknown", 0.0), std::runtime_error);
+}
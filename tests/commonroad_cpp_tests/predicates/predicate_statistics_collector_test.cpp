@@ -0,0 +1,86 @@
+#include "predicate_statistics_collector_test.h"
+#include <commonroad_cpp/predicates/predicate_statistics_collector.h>
+#include <sstream>
+#include <thread>
+
+namespace {
+void recordExecutions(PredicateStatisticsCollector &collector, const std::string &predicateName,
+                      const std::string &scenario, size_t numExecutions, long computationTime) {
+    const auto &statistics{collector.getThreadStatistics(predicateName, scenario)};
+    for (size_t index{0}; index < numExecutions; ++index) {
+        statistics->numExecutions++;
+        statistics->numSatisfaction += index % 2;
+        statistics->totalComputationTime += static_cast<size_t>(computationTime);
+        statistics->computationTimeHistogram.record(computationTime);
+        statistics->computationTime.push_back(static_cast<double>(computationTime) / 1e6);
+    }
+}
+} // namespace
+
+TEST_F(PredicateStatisticsCollectorTest, MergeThreadStatistics) {
+    PredicateStatisticsCollector collector;
+    std::vector<std::thread> threads;
+    for (size_t index{0}; index < 4; ++index)
+        threads.emplace_back([&collector, index]() {
+            recordExecutions(collector, "in_same_lane", "DEU_Test-1", 100, 1000);
+            recordExecutions(collector, "in_same_lane", "DEU_Test-2", 10, 1000000);
+            // every thread obtains its own statistics
+            EXPECT_EQ(collector.getThreadStatistics("in_same_lane", "DEU_Test-1")->numExecutions, 100);
+            if (index == 0)
+                recordExecutions(collector, "in_front_of", "DEU_Test-1", 1, 500);
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    const auto statistics{collector.getStatistics()};
+    ASSERT_EQ(statistics.size(), 3);
+    EXPECT_EQ(statistics.at({"in_same_lane", "DEU_Test-1"}).numExecutions, 400);
+    EXPECT_EQ(statistics.at({"in_same_lane", "DEU_Test-1"}).numSatisfaction, 200);
+    EXPECT_EQ(statistics.at({"in_same_lane", "DEU_Test-2"}).computationTimeHistogram.getCount(), 40);
+    EXPECT_EQ(statistics.at({"in_front_of", "DEU_Test-1"}).totalComputationTime, 500);
+
+    const auto predicateStatistics{collector.getPredicateStatistics()};
+    ASSERT_EQ(predicateStatistics.size(), 2);
+    const auto &inSameLane{predicateStatistics.at("in_same_lane")};
+    EXPECT_EQ(inSameLane.numExecutions, 440);
+    EXPECT_EQ(inSameLane.totalComputationTime, 40400000);
+    EXPECT_EQ(inSameLane.computationTimeHistogram.getMax(), 1000000);
+    EXPECT_LE(inSameLane.computationTimeHistogram.getQuantile(0.5), 1125);
+    EXPECT_EQ(inSameLane.computationTimeHistogram.getQuantile(0.99), 1000000);
+    // per-execution computation times are only kept in the thread statistics
+    EXPECT_TRUE(inSameLane.computationTime.empty());
+
+    collector.reset();
+    EXPECT_EQ(collector.getPredicateStatistics().at("in_same_lane").numExecutions, 0);
+}
+
+TEST_F(PredicateStatisticsCollectorTest, Export) {
+    PredicateStatisticsCollector collector;
+    recordExecutions(collector, "in_same_lane", "DEU_Test-1", 2, 2000000);
+    recordExecutions(collector, "in_same_lane", "DEU_\"Test\"-2", 2, 4000000);
+
+    std::stringstream csv;
+    collector.writeCsv(csv);
+    std::string line;
+    std::getline(csv, line);
+    EXPECT_EQ(line, "Predicate Name,Scenario,Num. Executions,Num. Satisfactions,Total Comp. Time,Avg. Comp. Time,"
+                    "P50 Comp. Time,P95 Comp. Time,P99 Comp. Time,Max. Comp. Time");
+    std::getline(csv, line);
+    EXPECT_EQ(line, "\"in_same_lane\",\"all\",4,2,12.000000,3.000000,2.097151,4.000000,4.000000,4.000000");
+    std::getline(csv, line);
+    EXPECT_EQ(line,
+              "\"in_same_lane\",\"DEU_\"\"Test\"\"-2\",2,1,8.000000,4.000000,4.000000,4.000000,4.000000,4.000000");
+    std::getline(csv, line);
+    EXPECT_EQ(line, "\"in_same_lane\",\"DEU_Test-1\",2,1,4.000000,2.000000,2.000000,2.000000,2.000000,2.000000");
+    EXPECT_FALSE(std::getline(csv, line));
+
+    std::stringstream json;
+    collector.writeJson(json);
+    const auto content{json.str()};
+    EXPECT_EQ(content.find("{\n  \"unit\": \"ms\",\n  \"predicates\": [\n    {\"name\": \"in_same_lane\", "
+                           "\"num_executions\": 4, \"num_satisfactions\": 2, \"total_computation_time\": 12.000000"),
+              0);
+    EXPECT_NE(content.find("{\"name\": \"DEU_\\\"Test\\\"-2\", \"num_executions\": 2"), std::string::npos);
+    EXPECT_NE(content.find("\"p99_computation_time\": 2.000000, \"max_computation_time\": 2.000000}]}"),
+              std::string::npos);
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+class PredicateStatisticsCollectorTest : public testing::Test {};
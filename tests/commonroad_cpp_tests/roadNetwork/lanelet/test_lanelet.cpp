@@ -3,6 +3,8 @@
 #include <commonroad_cpp/roadNetwork/regulatoryElements/stop_line.h>
 #include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_light.h>
 #include <commonroad_cpp/roadNetwork/regulatoryElements/traffic_sign.h>
+#include <limits>
+#include <random>
 
 namespace bg = boost::geometry;
 typedef boost::geometry::model::d2::point_xy<double> point_type;
@@ -208,6 +210,15 @@ TEST_F(LaneletTest, CheckIntersection) {
     EXPECT_EQ(laneletOne->checkIntersection(polygonThree, ContainmentType::COMPLETELY_CONTAINED), false);
 }
 
+TEST_F(LaneletTest, ContainsPoint) {
+    EXPECT_TRUE(laneletOne->containsPoint(30.0, 1.5));
+    EXPECT_TRUE(laneletOne->containsPoint(0.0, 0.0)); // border is part of lanelet
+    EXPECT_FALSE(laneletOne->containsPoint(30.0, 4.0));
+    EXPECT_FALSE(laneletOne->containsPoint(-1.0, 1.5));
+    EXPECT_TRUE(laneletTwo->containsPoint(115.0, 4.0));
+    EXPECT_FALSE(laneletTwo->containsPoint(65.0, 4.0));
+}
+
 TEST_F(LaneletTest, ConstructOuterPolygon) {
     // evaluates whether in setUp creates outer polygon is valid (this test case does not check the vertices directly)
     // lanelet one
@@ -265,3 +276,52 @@ TEST_F(LaneletTest, GetOrientationAtPosition) {
     EXPECT_NEAR(laneletTwo->getOrientationAtPosition(110.5, 2.75), 0.291457, 0.00001);
     EXPECT_NEAR(laneletTwo->getOrientationAtPosition(120.0, 3.5), 0.291457, 0.00001);
 }
+
+TEST_F(LaneletTest, FindClosestIndex) {
+    EXPECT_EQ(laneletOne->findClosestIndex(0.0, 0.0), 0);
+    EXPECT_EQ(laneletOne->findClosestIndex(100.0, 1.5), laneletOne->getCenterVertices().size() - 2);
+    EXPECT_EQ(laneletOne->findClosestIndex(100.0, 1.5, true), laneletOne->getCenterVertices().size() - 1);
+
+    // long center line which passes each position twice so that distances of several vertices are equal
+    std::vector<vertex> leftBorder;
+    std::vector<vertex> rightBorder;
+    for (size_t idx{0}; idx < 2000; ++idx) {
+        const double xPos{std::fmod(static_cast<double>(idx), 1000.0)};
+        const double yPos{10.0 * std::sin(xPos / 50.0)};
+        leftBorder.push_back({xPos, yPos + 1.5});
+        rightBorder.push_back({xPos, yPos - 1.5});
+    }
+    Lanelet longLanelet{1, leftBorder, rightBorder, {LaneletType::unknown}};
+    const auto &centerVertices{longLanelet.getCenterVertices()};
+    const auto closestIndexReference{[&centerVertices](double positionX, double positionY, size_t numVertices) {
+        double minimumDiff{std::numeric_limits<double>::infinity()};
+        size_t minimumIndex{0};
+        for (size_t idx{0}; idx < numVertices; ++idx) {
+            const double diffX{centerVertices[idx].x - positionX};
+            const double diffY{centerVertices[idx].y - positionY};
+            if (diffX * diffX + diffY * diffY < minimumDiff) {
+                minimumDiff = diffX * diffX + diffY * diffY;
+                minimumIndex = idx;
+            }
+        }
+        return minimumIndex;
+    }};
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distributionX{-100.0, 1100.0};
+    std::uniform_real_distribution<double> distributionY{-50.0, 50.0};
+    for (size_t query{0}; query < 1000; ++query) {
+        const double positionX{query % 2 == 0 ? distributionX(generator) : std::round(distributionX(generator))};
+        const double positionY{distributionY(generator)};
+        EXPECT_EQ(longLanelet.findClosestIndex(positionX, positionY),
+                  closestIndexReference(positionX, positionY, centerVertices.size() - 1));
+        EXPECT_EQ(longLanelet.findClosestIndex(positionX, positionY, true),
+                  closestIndexReference(positionX, positionY, centerVertices.size()));
+    }
+    EXPECT_EQ(longLanelet.findClosestIndex(500.0, centerVertices[500].y), 500);
+    EXPECT_EQ(longLanelet.findClosestIndex(std::numeric_limits<double>::quiet_NaN(), 0.0), 0);
+
+    // appended vertices are considered in subsequent queries
+    longLanelet.addCenterVertex({2000.0, 0.0});
+    EXPECT_EQ(longLanelet.findClosestIndex(1990.0, 0.0, true), centerVertices.size() - 1);
+}
@@ -0,0 +1,207 @@
+#include "test_lanelet_graph.h"
+#include "../../interfaces/utility_functions.h"
+
+#include <commonroad_cpp/interfaces/commonroad/input_utils.h>
+#include <commonroad_cpp/roadNetwork/lanelet/dijkstra.h>
+#include <commonroad_cpp/roadNetwork/lanelet/lanelet.h>
+#include <commonroad_cpp/roadNetwork/lanelet/lanelet_graph.h>
+#include <commonroad_cpp/roadNetwork/road_network.h>
+#include <thread>
+
+namespace {
+
+/**
+ * Computes the cost of a path with the same edge weights as the lanelet graph.
+ *
+ * @param roadNetwork Road network containing the lanelets of the path.
+ * @param path IDs of the lanelets along the path.
+ * @param considerAdjacency Boolean indicating whether lane changes are allowed.
+ * @return Cost of path. Maximum value if two consecutive lanelets are not connected.
+ */
+size_t computePathCost(const std::shared_ptr<RoadNetwork> &roadNetwork, const std::vector<size_t> &path,
+                       bool considerAdjacency) {
+    size_t cost{0};
+    for (size_t idx{1}; idx < path.size(); ++idx) {
+        const auto let{roadNetwork->findLaneletById(path.at(idx - 1))};
+        const auto &successors{let->getSuccessors()};
+        if (std::any_of(successors.begin(), successors.end(),
+                        [&path, idx](const auto &suc) { return suc->getId() == path.at(idx); }))
+            cost += 1;
+        else if (considerAdjacency and ((let->getAdjacentLeft().adj != nullptr and
+                                         !let->getAdjacentLeft().oppositeDir and
+                                         let->getAdjacentLeft().adj->getId() == path.at(idx)) or
+                                        (let->getAdjacentRight().adj != nullptr and
+                                         !let->getAdjacentRight().oppositeDir and
+                                         let->getAdjacentRight().adj->getId() == path.at(idx))))
+            cost += 4;
+        else
+            return std::numeric_limits<size_t>::max();
+    }
+    return cost;
+}
+
+/**
+ * Creates the adjacency list graph used by the lanelet graph before its compressed sparse row representation.
+ *
+ * @param lanelets Lanelets of the road network.
+ * @param considerAdjacency Boolean indicating whether lane changes are added as edges.
+ * @return Graph with vertex index i corresponding to lanelet i.
+ */
+graph<size_t, size_t> createReferenceGraph(const std::vector<std::shared_ptr<Lanelet>> &lanelets,
+                                           bool considerAdjacency) {
+    graph<size_t, size_t> referenceGraph;
+    std::map<size_t, std::ptrdiff_t> vertices;
+    for (const auto &let : lanelets)
+        vertices[let->getId()] = referenceGraph.add_vertex(let->getId());
+    for (const auto &let : lanelets) {
+        for (const auto &adj : {let->getAdjacentLeft(), let->getAdjacentRight()})
+            if (considerAdjacency and adj.adj != nullptr and !adj.oppositeDir) {
+                referenceGraph.add_edge(vertices.at(let->getId()), vertices.at(adj.adj->getId()), 4);
+                referenceGraph.add_edge(vertices.at(adj.adj->getId()), vertices.at(let->getId()), 4);
+            }
+        for (const auto &suc : let->getSuccessors())
+            referenceGraph.add_edge(vertices.at(let->getId()), vertices.at(suc->getId()), 1);
+    }
+    return referenceGraph;
+}
+
+} // namespace
+
+TEST_F(LaneletGraphTest, FindPathsMatchesReference) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    const auto &lanelets{roadNetworkScenario->getLaneletNetwork()};
+    ASSERT_FALSE(lanelets.empty());
+
+    for (const auto considerAdjacency : {false, true}) {
+        LaneletGraph laneletGraph{lanelets};
+        const auto referenceGraph{createReferenceGraph(lanelets, considerAdjacency)};
+        size_t numPaths{0};
+        for (size_t srcIdx{0}; srcIdx < lanelets.size(); ++srcIdx) {
+            const dijkstra<size_t, size_t> searcher{referenceGraph, static_cast<std::ptrdiff_t>(srcIdx)};
+            for (size_t dstIdx{0}; dstIdx < lanelets.size(); ++dstIdx) {
+                if (srcIdx == dstIdx)
+                    continue;
+                const auto path{
+                    laneletGraph.findPaths(lanelets[srcIdx]->getId(), lanelets[dstIdx]->getId(), considerAdjacency)};
+                const auto reference{searcher.search_path(static_cast<std::ptrdiff_t>(dstIdx))};
+                ASSERT_EQ(path.empty(), !reference.has_value());
+                if (path.empty())
+                    continue;
+                ++numPaths;
+                EXPECT_EQ(path.front(), lanelets[srcIdx]->getId());
+                EXPECT_EQ(path.back(), lanelets[dstIdx]->getId());
+                EXPECT_EQ(computePathCost(roadNetworkScenario, path, considerAdjacency),
+                          static_cast<size_t>(reference.value().second));
+            }
+        }
+        EXPECT_GT(numPaths, 0);
+    }
+}
+
+TEST_F(LaneletGraphTest, FindPathsSameLanelet) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    LaneletGraph laneletGraph{roadNetworkScenario->getLaneletNetwork()};
+    const auto letId{roadNetworkScenario->getLaneletNetwork().front()->getId()};
+    EXPECT_EQ(laneletGraph.findPaths(letId, letId, false), std::vector<size_t>{letId});
+    EXPECT_THROW(laneletGraph.findPaths(letId, 1, false), std::out_of_range);
+}
+
+TEST_F(LaneletGraphTest, FindPathsConsidersAdjacencyInMemo) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    LaneletGraph laneletGraph{roadNetworkScenario->getLaneletNetwork()};
+    // lanelet pair which is only connected via a lane change
+    std::shared_ptr<Lanelet> let;
+    std::shared_ptr<Lanelet> adjacentLet;
+    for (const auto &candidate : roadNetworkScenario->getLaneletNetwork())
+        if (candidate->getAdjacentLeft().adj != nullptr and !candidate->getAdjacentLeft().oppositeDir and
+            LaneletGraph{roadNetworkScenario->getLaneletNetwork()}
+                .findPaths(candidate->getId(), candidate->getAdjacentLeft().adj->getId(), false)
+                .empty()) {
+            let = candidate;
+            adjacentLet = candidate->getAdjacentLeft().adj;
+            break;
+        }
+    ASSERT_NE(let, nullptr);
+    EXPECT_TRUE(laneletGraph.findPaths(let->getId(), adjacentLet->getId(), false).empty());
+    EXPECT_EQ(laneletGraph.findPaths(let->getId(), adjacentLet->getId(), true),
+              (std::vector<size_t>{let->getId(), adjacentLet->getId()}));
+    EXPECT_TRUE(laneletGraph.findPaths(let->getId(), adjacentLet->getId(), false).empty());
+}
+
+TEST_F(LaneletGraphTest, MemoStatistics) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    const auto &lanelets{roadNetworkScenario->getLaneletNetwork()};
+    LaneletGraph laneletGraph{lanelets, 16};
+    const auto path{laneletGraph.findPaths(lanelets.at(0)->getId(), lanelets.at(1)->getId(), true)};
+    EXPECT_EQ(laneletGraph.findPaths(lanelets.at(0)->getId(), lanelets.at(1)->getId(), true), path);
+    EXPECT_EQ(laneletGraph.getMemoHits(), 1);
+    EXPECT_EQ(laneletGraph.getMemoMisses(), 1);
+    EXPECT_EQ(laneletGraph.getMemoSize(), 1);
+
+    for (const auto &dst : lanelets)
+        laneletGraph.findPaths(lanelets.at(0)->getId(), dst->getId(), false);
+    EXPECT_LE(laneletGraph.getMemoSize(), 16);
+    EXPECT_EQ(laneletGraph.getMemoHits() + laneletGraph.getMemoMisses(), lanelets.size() + 1);
+
+    LaneletGraph laneletGraphWithoutMemo{lanelets, 0};
+    EXPECT_EQ(laneletGraphWithoutMemo.findPaths(lanelets.at(0)->getId(), lanelets.at(1)->getId(), true), path);
+    EXPECT_EQ(laneletGraphWithoutMemo.findPaths(lanelets.at(0)->getId(), lanelets.at(1)->getId(), true), path);
+    EXPECT_EQ(laneletGraphWithoutMemo.getMemoHits(), 0);
+    EXPECT_EQ(laneletGraphWithoutMemo.getMemoSize(), 0);
+}
+
+TEST_F(LaneletGraphTest, IsReachable) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    const auto &lanelets{roadNetworkScenario->getLaneletNetwork()};
+    LaneletGraph laneletGraph{lanelets};
+    LaneletGraph laneletGraphWithoutTable{lanelets, LaneletGraph::defaultMemoCapacity, 0};
+    EXPECT_TRUE(laneletGraph.hasReachabilityTable());
+    EXPECT_FALSE(laneletGraphWithoutTable.hasReachabilityTable());
+    for (const auto &src : lanelets)
+        for (const auto &dst : lanelets) {
+            const auto reachable{!laneletGraph.findPaths(src->getId(), dst->getId(), false).empty()};
+            EXPECT_EQ(laneletGraph.isReachable(src->getId(), dst->getId()), reachable);
+            EXPECT_EQ(laneletGraphWithoutTable.isReachable(src->getId(), dst->getId()), reachable);
+        }
+}
+
+TEST_F(LaneletGraphTest, ConcurrentFindPaths) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    const auto &lanelets{roadNetworkScenario->getLaneletNetwork()};
+    LaneletGraph referenceGraph{lanelets};
+    std::map<std::array<size_t, 3>, std::vector<size_t>> referencePaths;
+    for (const auto &src : lanelets)
+        for (const auto &dst : lanelets)
+            for (const auto considerAdjacency : {false, true})
+                if (src != dst)
+                    referencePaths[{src->getId(), dst->getId(), considerAdjacency}] =
+                        referenceGraph.findPaths(src->getId(), dst->getId(), considerAdjacency);
+
+    // small memo so that insertions and evictions interleave with lookups
+    LaneletGraph laneletGraph{lanelets, 64};
+    std::atomic<size_t> numMismatches{0};
+    std::vector<std::thread> threads;
+    for (size_t threadIdx{0}; threadIdx < 4; ++threadIdx)
+        threads.emplace_back([&]() {
+            for (size_t run{0}; run < 2; ++run)
+                for (const auto &[query, path] : referencePaths)
+                    if (laneletGraph.findPaths(query[0], query[1], query[2] != 0) != path)
+                        ++numMismatches;
+        });
+    for (auto &thread : threads)
+        thread.join();
+    EXPECT_EQ(numMismatches, 0);
+    EXPECT_EQ(laneletGraph.getMemoHits() + laneletGraph.getMemoMisses(), 4 * 2 * referencePaths.size());
+}
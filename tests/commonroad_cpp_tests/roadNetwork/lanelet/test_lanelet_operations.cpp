@@ -6,6 +6,42 @@
 #include "test_lanelet_operations.h"
 #include <commonroad_cpp/interfaces/commonroad/input_utils.h>
 
+namespace {
+
+/**
+ * Recursive enumeration of lanelet sequences which copies the sequence for each branch. Serves as reference for the
+ * prefix tree based enumeration.
+ */
+std::vector<std::vector<std::shared_ptr<Lanelet>>>
+enumerateLaneletSequencesRecursive(const std::shared_ptr<Lanelet> &curLanelet, double fov, int numIntersections,
+                                   bool successors, const std::vector<std::shared_ptr<Lanelet>> &containedLanelets,
+                                   double offset) {
+    std::vector<std::vector<std::shared_ptr<Lanelet>>> lanes;
+    auto laneletList{containedLanelets};
+    laneletList.push_back(curLanelet);
+    double laneLength{offset};
+    for (const auto &lanelet : laneletList)
+        laneLength += lanelet->getPathLength().back();
+    if (curLanelet->hasLaneletType(LaneletType::incoming))
+        --numIntersections;
+    const auto &nextLanelets{successors ? curLanelet->getSuccessors() : curLanelet->getPredecessors()};
+    if (nextLanelets.empty() or
+        std::any_of(containedLanelets.begin(), containedLanelets.end(),
+                    [curLanelet](const auto &lanelet) { return curLanelet->getId() == lanelet->getId(); }) or
+        laneLength >= fov or numIntersections < 0)
+        return {laneletList};
+    for (const auto &lanelet : nextLanelets) {
+        if (lanelet->hasLaneletType(LaneletType::border))
+            continue;
+        auto newLanes{enumerateLaneletSequencesRecursive(lanelet, fov, numIntersections, successors, laneletList,
+                                                         offset)};
+        lanes.insert(lanes.end(), newLanes.begin(), newLanes.end());
+    }
+    return lanes;
+}
+
+} // namespace
+
 void LaneletOperationsTest::SetUp() {
     setUpLane();
     setUpRoadNetwork();
@@ -297,6 +333,38 @@ TEST_F(LaneletOperationsTest, CreateLanesByLaneletsSeveralComplexIntersections)
     EXPECT_EQ(endIds, expEndIds);
 }
 
+TEST_F(LaneletOperationsTest, EnumerateLaneletSequences) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblemsOne] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    size_t numSequences{0};
+    size_t numSharedLanelets{0};
+    for (const auto &let : roadNetworkScenario->getLaneletNetwork())
+        for (const auto successors : {true, false})
+            for (const auto &[fov, numIntersections] : std::vector<std::pair<double, int>>{{50, 0}, {250, 2}}) {
+                const auto tree{
+                    lane_operations::enumerateLaneletSequences(let, fov, numIntersections, successors, -1.0)};
+                const auto sequences{tree.extractSequences()};
+                EXPECT_EQ(sequences,
+                          enumerateLaneletSequencesRecursive(let, fov, numIntersections, successors, {}, -1.0));
+                size_t numLanelets{0};
+                for (const auto &sequence : sequences)
+                    numLanelets += sequence.size();
+                EXPECT_LE(tree.lanelets.size(), numLanelets);
+                numSharedLanelets += numLanelets - tree.lanelets.size();
+                numSequences += sequences.size();
+            }
+    EXPECT_GT(numSequences, 0);
+    EXPECT_GT(numSharedLanelets, 0);
+
+    const auto &let{roadNetworkScenario->getLaneletNetwork().front()};
+    const std::vector<std::shared_ptr<Lanelet>> containedLanelets{roadNetworkScenario->getLaneletNetwork().back()};
+    EXPECT_EQ(lane_operations::combineLaneletAndSuccessorsToLane(let, 250, 2, containedLanelets, 1.0),
+              enumerateLaneletSequencesRecursive(let, 250, 2, true, containedLanelets, 1.0));
+    EXPECT_EQ(lane_operations::combineLaneletAndPredecessorsToLane(let, 250, 2, containedLanelets, 1.0),
+              enumerateLaneletSequencesRecursive(let, 250, 2, false, containedLanelets, 1.0));
+}
+
 TEST_F(LaneletOperationsTest, LaneletsRightOfLanelet) {
     EXPECT_EQ(lanelet_operations::laneletsRightOfLanelet(laneletOne, true).size(), 1);
     EXPECT_EQ(lanelet_operations::laneletsRightOfLanelet(laneletTwo, true).size(), 0);
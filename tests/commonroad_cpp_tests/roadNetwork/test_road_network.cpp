@@ -1,11 +1,20 @@
 #include "test_road_network.h"
 #include "../interfaces/utility_functions.h"
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
 #include "commonroad_cpp/roadNetwork/regulatoryElements/traffic_light.h"
+#include "commonroad_cpp/roadNetwork/regulatoryElements/traffic_sign.h"
 
+#include <commonroad_cpp/geometry/geometric_operations.h>
+#include <commonroad_cpp/geometry/oriented_bounding_box.h>
 #include <commonroad_cpp/interfaces/commonroad/input_utils.h>
+#include <commonroad_cpp/obstacle/obstacle.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane.h>
 #include <commonroad_cpp/roadNetwork/lanelet/lane_operations.h>
 #include <geometry/curvilinear_coordinate_system.h>
+#include <cmath>
+#include <map>
+#include <random>
+#include <set>
 
 void RoadNetworkTestInitialization::setUpRoadNetwork() {
     std::vector<std::shared_ptr<Lanelet>> lanelets{laneletOne,  laneletTwo, laneletThree, laneletFour,
@@ -40,6 +49,21 @@ TEST_F(RoadNetworkTest, FindLaneletsByPosition) {
     EXPECT_EQ(roadNetwork->findLaneletsByPosition(123, 123).size(), 0);
 }
 
+TEST_F(RoadNetworkTest, FindLaneletsByPositions) {
+    std::vector<vertex> positions{{1, 0.5}, {123, 123}, {30, 1.5}, {1, 0.5}};
+    auto lanelets{roadNetwork->findLaneletsByPositions(positions)};
+    ASSERT_EQ(lanelets.size(), positions.size());
+    for (size_t idx{0}; idx < positions.size(); ++idx) {
+        auto expected{roadNetwork->findLaneletsByPosition(positions[idx].x, positions[idx].y)};
+        ASSERT_EQ(lanelets[idx].size(), expected.size());
+        for (size_t letIdx{0}; letIdx < expected.size(); ++letIdx)
+            EXPECT_EQ(lanelets[idx][letIdx], expected[letIdx]);
+    }
+    EXPECT_EQ(lanelets[0].at(0)->getId(), 1);
+    EXPECT_TRUE(lanelets[1].empty());
+    EXPECT_TRUE(roadNetwork->findLaneletsByPositions({}).empty());
+}
+
 TEST_F(RoadNetworkTest, FindLaneletById) {
     EXPECT_EQ(roadNetwork->findLaneletById(1)->getId(), 1);
     EXPECT_THROW(roadNetwork->findLaneletById(123)->getId(), std::domain_error);
@@ -78,6 +102,106 @@ TEST_F(RoadNetworkTest, AddLanes) {
     EXPECT_NE(testLanes.at(0)->getId(), updatedLanes.at(0)->getId());
 }
 
+TEST_F(RoadNetworkTest, CreateLanesForAllLanelets) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/predicates/ZAM_Test-2/ZAM_Test-2_1_T-1.pb"};
+    const auto &[obstaclesScenarioOne, roadNetworkScenarioOne, timeStepSizeOne, planningProblemsOne] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    const auto &[obstaclesScenarioTwo, roadNetworkScenarioTwo, timeStepSizeTwo, planningProblemsTwo] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    roadNetworkScenarioOne->setIdCounterRef(std::make_shared<size_t>(123456789));
+    roadNetworkScenarioTwo->setIdCounterRef(std::make_shared<size_t>(123456789));
+
+    for (const auto &let : roadNetworkScenarioOne->getLaneletNetwork())
+        lane_operations::createLanesBySingleLanelets({let}, roadNetworkScenarioOne, 250, 250, 1, {});
+    lane_operations::createLanesForAllLanelets(roadNetworkScenarioTwo->getLaneletNetwork(), roadNetworkScenarioTwo, 250,
+                                               250, 1, {}, 4);
+
+    std::map<std::set<size_t>, size_t> lanesOne;
+    for (const auto &lane : roadNetworkScenarioOne->getLanes())
+        lanesOne[lane->getContainedLaneletIDs()] = lane->getId();
+    std::map<std::set<size_t>, size_t> lanesTwo;
+    for (const auto &lane : roadNetworkScenarioTwo->getLanes())
+        lanesTwo[lane->getContainedLaneletIDs()] = lane->getId();
+    EXPECT_FALSE(lanesOne.empty());
+    EXPECT_EQ(lanesOne, lanesTwo);
+    EXPECT_EQ(*roadNetworkScenarioOne->getIdCounterRef(), *roadNetworkScenarioTwo->getIdCounterRef());
+    for (const auto &let : roadNetworkScenarioTwo->getLaneletNetwork())
+        EXPECT_EQ(roadNetworkScenarioOne->findLanesByBaseLanelet(let->getId()).size(),
+                  roadNetworkScenarioTwo->findLanesByBaseLanelet(let->getId()).size());
+}
+
+TEST_F(RoadNetworkTest, LaneIndices) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    roadNetworkScenario->setIdCounterRef(std::make_shared<size_t>(123456789));
+    lane_operations::createLanesForAllLanelets(roadNetworkScenario->getLaneletNetwork(), roadNetworkScenario, 250, 250,
+                                               1, {}, 1);
+    const auto lanes{roadNetworkScenario->getLanes()};
+    ASSERT_FALSE(lanes.empty());
+
+    for (const auto &let : roadNetworkScenario->getLaneletNetwork()) {
+        std::set<size_t> expectedLanes;
+        for (const auto &lane : lanes)
+            if (lane->containsLanelet(let))
+                expectedLanes.insert(lane->getId());
+        std::set<size_t> containingLanes;
+        for (const auto &lane : roadNetworkScenario->findLanesByContainedLanelet(let->getId()))
+            containingLanes.insert(lane->getId());
+        EXPECT_EQ(containingLanes, expectedLanes);
+        for (const auto &lane : roadNetworkScenario->findLanesByBaseLanelet(let->getId())) {
+            EXPECT_TRUE(lane->containsLanelet(let));
+            EXPECT_EQ(roadNetworkScenario->findLaneByContainedLanelets(lane->getContainedLaneletIDs()), lane);
+        }
+    }
+    EXPECT_TRUE(roadNetworkScenario->findLanesByContainedLanelet(1).empty());
+    EXPECT_TRUE(roadNetworkScenario->findLanesByBaseLanelet(1).empty());
+}
+
+TEST_F(RoadNetworkTest, InternLane) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    roadNetworkScenario->setIdCounterRef(std::make_shared<size_t>(123456789));
+    const auto let{roadNetworkScenario->findLaneletById(3524)};
+    ASSERT_FALSE(let->getSuccessors().empty());
+    const auto sucId{let->getSuccessors().at(0)->getId()};
+    std::vector<std::shared_ptr<Lanelet>> laneLanelets{let, let->getSuccessors().at(0)};
+    EXPECT_EQ(roadNetworkScenario->findLaneByLaneletSequence({3524, sucId}), nullptr);
+
+    auto lane{roadNetworkScenario->internLane(lane_operations::createLaneByContainedLanelets(laneLanelets, 1))};
+    auto sameLane{roadNetworkScenario->internLane(lane_operations::createLaneByContainedLanelets(laneLanelets, 2))};
+    EXPECT_EQ(lane, sameLane);
+    EXPECT_EQ(lane->getId(), 1);
+    EXPECT_EQ(lane->getCurvilinearCoordinateSystem(), sameLane->getCurvilinearCoordinateSystem());
+    EXPECT_EQ(roadNetworkScenario->findLaneByLaneletSequence({3524, sucId}), lane);
+    EXPECT_EQ(roadNetworkScenario->findLaneByLaneletSequence({sucId, 3524}), nullptr);
+    // interned lanes are no lanes of the road network until they are added
+    EXPECT_EQ(roadNetworkScenario->findLaneByContainedLanelets({3524, sucId}), nullptr);
+
+    const auto addedLanes{roadNetworkScenario->addLanes(
+        {lane_operations::createLaneByContainedLanelets(laneLanelets, 3)}, 3524)};
+    EXPECT_EQ(addedLanes.at(0), lane);
+    EXPECT_EQ(roadNetworkScenario->findLaneByContainedLanelets({3524, sucId}), lane);
+    EXPECT_EQ(roadNetworkScenario->findLanesByBaseLanelet(3524).at(0), lane);
+
+    const auto laneFromPoints{
+        lane_operations::computeLaneFromTwoPoints({28.0, 3.75}, {-15.5, -2.5}, roadNetworkScenario)};
+    EXPECT_EQ(lane_operations::computeLaneFromTwoPoints({28.0, 3.75}, {-15.5, -2.5}, roadNetworkScenario),
+              laneFromPoints);
+}
+
+TEST_F(RoadNetworkTest, GenerateId) {
+    std::vector<size_t> ids(1000);
+#pragma omp parallel for num_threads(4)
+    for (int idx = 0; idx < 1000; ++idx)
+        ids[static_cast<size_t>(idx)] = roadNetwork->generateId();
+    EXPECT_EQ(std::set<size_t>(ids.begin(), ids.end()).size(), 1000);
+    EXPECT_EQ(*roadNetwork->getIdCounterRef(), 123456789 + 1000);
+    EXPECT_EQ(roadNetwork->reserveIds(10), 123456789 + 1001);
+    EXPECT_EQ(roadNetwork->generateId(), 123456789 + 1011);
+}
+
 TEST_F(RoadNetworkTest, FindTrafficLightById) {
     std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"};
     const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
@@ -92,8 +216,68 @@ TEST_F(RoadNetworkTest, FindTrafficLightById) {
     EXPECT_THROW(roadNetworkScenario->findTrafficLightById(1), std::domain_error);
 }
 
+TEST_F(RoadNetworkTest, FindTrafficSignById) {
+    std::string pathToTestFile{TestUtils::getTestScenarioDirectory() + "/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb"};
+    const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+        InputUtils::getDataFromCommonRoad(pathToTestFile);
+    ASSERT_FALSE(roadNetworkScenario->getTrafficSigns().empty());
+    for (const auto &sign : roadNetworkScenario->getTrafficSigns())
+        EXPECT_EQ(roadNetworkScenario->findTrafficSignById(sign->getId()), sign);
+    EXPECT_THROW(roadNetworkScenario->findTrafficSignById(1), std::domain_error);
+}
+
+TEST_F(RoadNetworkTest, FindIntersectionById) {
+    EXPECT_EQ(roadNetwork->findIntersectionById(1000), intersection1);
+    EXPECT_EQ(roadNetwork->findIntersectionById(1001), intersection2);
+    EXPECT_THROW(roadNetwork->findIntersectionById(1), std::domain_error);
+}
+
 TEST_F(RoadNetworkTest, GetIntersections) {
     EXPECT_EQ(roadNetwork->getIntersections().size(), 2);
     EXPECT_EQ(roadNetwork->getIntersections()[0]->getId(), 1000);
     EXPECT_EQ(roadNetwork->getIntersections()[1]->getId(), 1001);
 }
+
+TEST_F(RoadNetworkTest, FindOccupiedLaneletsByRectangle) {
+    for (const auto &scenario :
+         {"/DEU_Guetersloh-25/DEU_Guetersloh-25_4_T-1.pb", "/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"}) {
+        const auto &[obstaclesScenario, roadNetworkScenario, timeStepSize, planningProblems] =
+            InputUtils::getDataFromCommonRoad(TestUtils::getTestScenarioDirectory() + scenario);
+
+        // occupancies of obstacles
+        for (const auto &obs : obstaclesScenario) {
+            if (obs->getGeoShape().getType() != ShapeType::rectangle)
+                continue;
+            for (const auto timeStep : obs->getTimeSteps()) {
+                const auto &shape{obs->getOccupancyPolygonShape(timeStep)};
+                EXPECT_EQ(roadNetworkScenario->findOccupiedLaneletsByShape(
+                              shape.front(), OrientedBoundingBox::fromRectangle(shape.front())),
+                          roadNetworkScenario->findOccupiedLaneletsByShape(shape));
+            }
+        }
+
+        // rectangles close to the lanelet borders, partially within the simplification tolerance of the borders
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<double> offset{-1.0, 1.0};
+        std::uniform_real_distribution<double> dimension{0.01, 3.0};
+        std::uniform_real_distribution<double> orientation{-M_PI, M_PI};
+        for (const auto &let : roadNetworkScenario->getLaneletNetwork()) {
+            for (const auto &border : {let->getLeftBorderVertices(), let->getRightBorderVertices()}) {
+                for (const auto &vert : border) {
+                    const double scale{generator() % 2 == 0 ? 1.0 : 0.02};
+                    const auto vertices{geometric_operations::rotateAndTranslateVertices(
+                        geometric_operations::addObjectDimensionsRectangle({vertex{0.0, 0.0}}, dimension(generator),
+                                                                           dimension(generator) * scale),
+                        vertex{vert.x + offset(generator) * scale, vert.y + offset(generator) * scale},
+                        orientation(generator))};
+                    polygon_type polygon;
+                    for (const auto &corner : vertices)
+                        polygon.outer().emplace_back(corner.x, corner.y);
+                    polygon.outer().emplace_back(vertices.front().x, vertices.front().y);
+                    EXPECT_EQ(let->applyIntersectionTesting(OrientedBoundingBox::fromRectangle(polygon), polygon),
+                              let->applyIntersectionTesting(polygon));
+                }
+            }
+        }
+    }
+}
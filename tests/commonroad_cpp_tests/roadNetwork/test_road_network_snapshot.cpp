@@ -0,0 +1,98 @@
+#include "test_road_network_snapshot.h"
+#include "../interfaces/utility_functions.h"
+#include "commonroad_cpp/auxiliaryDefs/structs.h"
+
+#include <commonroad_cpp/interfaces/commonroad/input_utils.h>
+#include <commonroad_cpp/roadNetwork/lanelet/lane.h>
+#include <commonroad_cpp/roadNetwork/road_network.h>
+#include <commonroad_cpp/roadNetwork/road_network_snapshot.h>
+#include <commonroad_cpp/world.h>
+#include <filesystem>
+#include <geometry/curvilinear_coordinate_system.h>
+
+void RoadNetworkSnapshotTest::SetUp() {
+    scenarioFile = TestUtils::getTestScenarioDirectory() + "/USA_Peach-2/USA_Peach-2_1_T-1.pb";
+    mapFile = TestUtils::getTestScenarioDirectory() + "/USA_Peach-2/USA_Peach-2.pb";
+    snapshotFile = (std::filesystem::temp_directory_path() /
+                    (std::string{testing::UnitTest::GetInstance()->current_test_info()->name()} + ".snapshot"))
+                       .string();
+    mapChecksum = RoadNetworkSnapshot::computeChecksum(mapFile);
+
+    auto scenario{InputUtils::getDataFromCommonRoad(scenarioFile)};
+    coldRoadNetwork = scenario.roadNetwork;
+    World world{"USA_Peach-2_1_T-1", 0, coldRoadNetwork, {}, scenario.obstacles, scenario.timeStepSize};
+    RoadNetworkSnapshot::write(snapshotFile, coldRoadNetwork, mapChecksum);
+}
+
+void RoadNetworkSnapshotTest::TearDown() { std::filesystem::remove(snapshotFile); }
+
+TEST_F(RoadNetworkSnapshotTest, RestoreLanes) {
+    const RoadNetworkSnapshot snapshot{snapshotFile};
+    const auto coldLanes{coldRoadNetwork->getLanes()};
+    EXPECT_EQ(snapshot.getMapChecksum(), mapChecksum);
+    EXPECT_TRUE(snapshot.isValidFor(mapChecksum));
+    EXPECT_EQ(snapshot.getNumLanes(), coldLanes.size());
+
+    auto scenario{InputUtils::getDataFromCommonRoad(scenarioFile)};
+    snapshot.restore(scenario.roadNetwork);
+    ASSERT_EQ(scenario.roadNetwork->getLanes().size(), coldLanes.size());
+    for (const auto &coldLane : coldLanes) {
+        std::vector<size_t> laneletIds;
+        for (const auto &lanelet : coldLane->getContainedLanelets())
+            laneletIds.push_back(lanelet->getId());
+        const auto warmLane{scenario.roadNetwork->findLaneByLaneletSequence(laneletIds)};
+        ASSERT_NE(warmLane, nullptr);
+        EXPECT_EQ(warmLane->getId(), coldLane->getId());
+        EXPECT_EQ(scenario.roadNetwork->findBaseLaneletsByLane(warmLane),
+                  coldRoadNetwork->findBaseLaneletsByLane(coldLane));
+
+        ASSERT_EQ(warmLane->getCenterVertices().size(), coldLane->getCenterVertices().size());
+        for (size_t idx{0}; idx < coldLane->getCenterVertices().size(); ++idx) {
+            EXPECT_EQ(warmLane->getCenterVertices()[idx].x, coldLane->getCenterVertices()[idx].x);
+            EXPECT_EQ(warmLane->getCenterVertices()[idx].y, coldLane->getCenterVertices()[idx].y);
+        }
+
+        const auto coldPath{coldLane->getCurvilinearCoordinateSystem()->referencePathOriginal()};
+        const auto warmPath{warmLane->getCurvilinearCoordinateSystem()->referencePathOriginal()};
+        ASSERT_EQ(warmPath.size(), coldPath.size());
+        for (size_t idx{0}; idx < coldPath.size(); ++idx)
+            EXPECT_TRUE(warmPath[idx] == coldPath[idx]);
+    }
+
+    // the restored lanes cover the field of view of the world, so that no further lanes are created
+    World world{"USA_Peach-2_1_T-1", 0, scenario.roadNetwork, {}, scenario.obstacles, scenario.timeStepSize};
+    EXPECT_EQ(scenario.roadNetwork->getLanes().size(), coldLanes.size());
+}
+
+TEST_F(RoadNetworkSnapshotTest, InvalidateOutdatedSnapshot) {
+    const auto otherChecksum{
+        RoadNetworkSnapshot::computeChecksum(TestUtils::getTestScenarioDirectory() + "/USA_Peach-4/USA_Peach-4.pb")};
+    EXPECT_EQ(RoadNetworkSnapshot::computeChecksum(mapFile), mapChecksum);
+    EXPECT_NE(otherChecksum, mapChecksum);
+    EXPECT_FALSE(RoadNetworkSnapshot{snapshotFile}.isValidFor(otherChecksum));
+
+    auto scenario{InputUtils::getDataFromCommonRoad(scenarioFile)};
+    EXPECT_FALSE(RoadNetworkSnapshot::restoreIfValid(snapshotFile, scenario.roadNetwork, otherChecksum));
+    EXPECT_FALSE(RoadNetworkSnapshot::restoreIfValid(snapshotFile + ".missing", scenario.roadNetwork, mapChecksum));
+    EXPECT_TRUE(scenario.roadNetwork->getLanes().empty());
+    EXPECT_TRUE(RoadNetworkSnapshot::restoreIfValid(snapshotFile, scenario.roadNetwork, mapChecksum));
+    EXPECT_EQ(scenario.roadNetwork->getLanes().size(), coldRoadNetwork->getLanes().size());
+}
+
+TEST_F(RoadNetworkSnapshotTest, RejectInvalidFiles) {
+    EXPECT_THROW(RoadNetworkSnapshot{snapshotFile + ".missing"}, std::runtime_error);
+    EXPECT_THROW(RoadNetworkSnapshot::computeChecksum(snapshotFile + ".missing"), std::runtime_error);
+    EXPECT_THROW(RoadNetworkSnapshot{mapFile}, std::runtime_error);
+
+    std::filesystem::resize_file(snapshotFile, std::filesystem::file_size(snapshotFile) - sizeof(vertex));
+    EXPECT_THROW(RoadNetworkSnapshot{snapshotFile}, std::runtime_error);
+    auto scenario{InputUtils::getDataFromCommonRoad(scenarioFile)};
+    EXPECT_FALSE(RoadNetworkSnapshot::restoreIfValid(snapshotFile, scenario.roadNetwork, mapChecksum));
+}
+
+TEST_F(RoadNetworkSnapshotTest, RejectDifferentRoadNetwork) {
+    auto scenario{
+        InputUtils::getDataFromCommonRoad(TestUtils::getTestScenarioDirectory() + "/ZAM_Urban-2/ZAM_Urban-2_1_T-1.pb")};
+    EXPECT_THROW(RoadNetworkSnapshot{snapshotFile}.restore(scenario.roadNetwork), std::runtime_error);
+    EXPECT_TRUE(scenario.roadNetwork->getLanes().empty());
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+class RoadNetwork;
+
+class RoadNetworkSnapshotTest : public testing::Test {
+  protected:
+    std::string scenarioFile;
+    std::string mapFile;
+    std::string snapshotFile;
+    uint64_t mapChecksum{0};
+    std::shared_ptr<RoadNetwork> coldRoadNetwork;
+
+    void SetUp() override;
+    void TearDown() override;
+};
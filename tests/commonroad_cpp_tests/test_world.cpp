@@ -1,9 +1,13 @@
 #include "test_world.h"
 #include "commonroad_cpp/interfaces/commonroad/input_utils.h"
 #include "commonroad_cpp/obstacle/obstacle_operations.h"
+#include "commonroad_cpp/roadNetwork/lanelet/lane.h"
+#include "commonroad_cpp/roadNetwork/road_network.h"
 #include "commonroad_cpp/world.h"
 #include "interfaces/utility_functions.h"
 #include <array>
+#include <map>
+#include <set>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem.hpp>
 
@@ -125,6 +129,37 @@ TEST_F(WorldTest, SetCurvilinearStates) {
     EXPECT_NO_THROW(world1.setCurvilinearStates());
 }
 
+TEST_F(WorldTest, ParallelConstruction) {
+    std::string scenario{"DEU_Guetersloh-25_4_T-1"};
+    std::string pathToTestFileOne{TestUtils::getTestScenarioDirectory() + "/" +
+                                  scenario.substr(0, scenario.size() - 6) + "/" + scenario + ".pb"};
+    const auto &[obstaclesScenarioOne, roadNetworkScenarioOne, timeStepSizeOne, planningProblemsOne] =
+        InputUtils::getDataFromCommonRoad(pathToTestFileOne);
+    const auto &[obstaclesScenarioTwo, roadNetworkScenarioTwo, timeStepSizeTwo, planningProblemsTwo] =
+        InputUtils::getDataFromCommonRoad(pathToTestFileOne);
+    auto world1{World(scenario, 0, roadNetworkScenarioOne, {obstaclesScenarioOne.front()}, {}, timeStepSizeOne,
+                      WorldParameters(RoadNetworkParameters(), SensorParameters::dynamicDefaults(),
+                                      ActuatorParameters::egoDefaults(), TimeParameters::dynamicDefaults(),
+                                      ActuatorParameters::vehicleDefaults(), 1))};
+    auto world2{World(scenario, 0, roadNetworkScenarioTwo, {obstaclesScenarioTwo.front()}, {}, timeStepSizeTwo,
+                      WorldParameters(RoadNetworkParameters(), SensorParameters::dynamicDefaults(),
+                                      ActuatorParameters::egoDefaults(), TimeParameters::dynamicDefaults(),
+                                      ActuatorParameters::vehicleDefaults(), 0))};
+    EXPECT_EQ(world1.getWorldParameters().getNumThreads(), 1);
+    EXPECT_EQ(world2.getWorldParameters().getNumThreads(), 0);
+
+    // lanes and their IDs do not depend on the number of threads
+    std::map<std::set<size_t>, size_t> lanesOne;
+    for (const auto &lane : roadNetworkScenarioOne->getLanes())
+        lanesOne[lane->getContainedLaneletIDs()] = lane->getId();
+    std::map<std::set<size_t>, size_t> lanesTwo;
+    for (const auto &lane : roadNetworkScenarioTwo->getLanes())
+        lanesTwo[lane->getContainedLaneletIDs()] = lane->getId();
+    EXPECT_FALSE(lanesOne.empty());
+    EXPECT_EQ(lanesOne, lanesTwo);
+    EXPECT_EQ(*roadNetworkScenarioOne->getIdCounterRef(), *roadNetworkScenarioTwo->getIdCounterRef());
+}
+
 TEST_F(WorldTest, GetEgoVehicles) {
     std::string scenario{"USA_Peach-2_1_T-1"};
     std::string pathToTestFileOne{TestUtils::getTestScenarioDirectory() + "/" +
@@ -161,6 +196,51 @@ TEST_F(WorldTest, SetEgoVehicles) {
     EXPECT_EQ(world2.getEgoVehicles()[0]->getId(), obstaclesScenarioOne.front()->getId());
 }
 
+TEST_F(WorldTest, SetEgoVehiclesByIds) {
+    std::string scenario{"USA_Peach-2_1_T-1"};
+    std::string pathToTestFileOne{TestUtils::getTestScenarioDirectory() + "/" +
+                                  scenario.substr(0, scenario.size() - 6) + "/" + scenario + ".pb"};
+    const auto &[obstaclesScenarioOne, roadNetworkScenarioOne, timeStepSizeOne, planningProblemsOne] =
+        InputUtils::getDataFromCommonRoad(pathToTestFileOne);
+    auto world1{World("USA_Peach-2_1_T-1", 0, roadNetworkScenarioOne, {}, obstaclesScenarioOne, timeStepSizeOne)};
+    auto numObstacles{world1.getObstacles().size()};
+
+    std::vector<size_t> egoIds{363, 334};
+    world1.setEgoVehicles(egoIds);
+    EXPECT_EQ(world1.getEgoVehicles().size(), 2);
+    EXPECT_EQ(world1.getEgoVehicles()[0]->getId(), 363);
+    EXPECT_EQ(world1.getEgoVehicles()[1]->getId(), 334);
+    EXPECT_EQ(world1.getObstacles().size(), numObstacles - 2);
+    auto obs{world1.findObstacles({334, 363})};
+    EXPECT_EQ(obs.size(), 2);
+    EXPECT_EQ(obs[0]->getId(), 334);
+    EXPECT_EQ(obs[1]->getId(), 363);
+
+    // 363 and 334 are moved back to obstacles
+    const auto newEgoId{world1.getObstacles().front()->getId()};
+    egoIds = {newEgoId};
+    world1.setEgoVehicles(egoIds);
+    EXPECT_EQ(world1.getEgoVehicles().size(), 1);
+    EXPECT_EQ(world1.getEgoVehicles()[0]->getId(), newEgoId);
+    EXPECT_EQ(world1.getObstacles().size(), numObstacles - 1);
+    EXPECT_EQ(world1.getObstacles().back()->getId(), 334);
+    EXPECT_EQ(world1.findObstacle(363)->getId(), 363);
+
+    // unknown IDs and IDs which are already ego vehicles are rejected without modifying the world
+    egoIds = {1};
+    EXPECT_THROW(world1.setEgoVehicles(egoIds), std::runtime_error);
+    egoIds = {newEgoId};
+    EXPECT_THROW(world1.setEgoVehicles(egoIds), std::runtime_error);
+    egoIds = {363, 363};
+    EXPECT_THROW(world1.setEgoVehicles(egoIds), std::runtime_error);
+    EXPECT_EQ(world1.getEgoVehicles().size(), 1);
+    EXPECT_EQ(world1.getObstacles().size(), numObstacles - 1);
+
+    std::vector<std::shared_ptr<Obstacle>> egos{};
+    world1.setEgoVehicles(egos);
+    EXPECT_THROW(world1.findObstacle(newEgoId), std::logic_error);
+}
+
 TEST_F(WorldTest, IdCounterRef) {
     std::string scenario{"USA_Peach-2_1_T-1"};
     std::string pathToTestFileOne{TestUtils::getTestScenarioDirectory() + "/" +
@@ -232,6 +312,7 @@ TEST_F(WorldTest, UpdateObstacles) {
     newObstacles = {obstacleCopy};
     EXPECT_NO_THROW(world1.updateObstacles(newObstacles));
     EXPECT_EQ(world1.getObstacles().size(), 1);
+    EXPECT_THROW(world1.findObstacle(obstaclesScenarioOne.at(1)->getId()), std::logic_error);
 
     // check whether new obstacle with history is used
     // (coverage should also be verified via debugging)
@@ -251,6 +332,7 @@ TEST_F(WorldTest, UpdateObstacles) {
     EXPECT_EQ(world1.getObstacles().at(0)->getTrajectoryHistory().size(), 1);
     EXPECT_EQ(world1.getObstacles().at(0)->getTrajectoryHistory().begin().value<>()->getTimeStep(),
               hist->getTimeStep());
+    EXPECT_EQ(world1.findObstacle(obsManip->getId()), obstacleCopy);
 }
 
 TEST_F(WorldTest, UpdateObstaclesTraj) {
@@ -302,6 +384,7 @@ TEST_F(WorldTest, UpdateObstaclesTraj) {
     traj = {{obsManip->getId(), obstacleCopyTraj}};
     EXPECT_NO_THROW(world1.updateObstaclesTraj(newObstacles, cstate, traj));
     EXPECT_EQ(world1.getObstacles().size(), 1);
+    EXPECT_THROW(world1.findObstacle(obstaclesScenarioOne.at(1)->getId()), std::logic_error);
 }
 
 TEST_F(WorldTest, Propagate) {
@@ -0,0 +1,122 @@
+"""Benchmarks of the conversion between Python objects and the C++ representation.
+
+Requires pytest-benchmark and is not collected by default; run with
+
+    pytest tests/python/benchmark_conversion.py --benchmark-only
+"""
+
+import os
+from pathlib import Path
+
+import crcpp
+import numpy as np
+import pytest
+from commonroad.common.file_reader import CommonRoadFileReader
+from commonroad.scenario.state import CustomState
+
+SCENARIOS = [
+    "DEU_Muc-2/DEU_Muc-2_1_T-1.pb",
+    "USA_Lanker-1/USA_Lanker-1_1_T-1.pb",
+    "ZAM_Urban-2/ZAM_Urban-2_1_T-1.pb",
+]
+
+NUM_STATES = 100
+
+
+def open_scenario(name):
+    full_path = Path(os.path.dirname(os.path.realpath(__file__))) / "../scenarios" / name
+    map_path = full_path.parent / f"{full_path.stem.split('_')[0]}_{full_path.stem.split('_')[1]}.pb"
+    return CommonRoadFileReader(filename_dynamic=full_path, filename_map=map_path).open_map_dynamic()
+
+
+@pytest.fixture(scope="module", params=SCENARIOS)
+def scenario(request):
+    return open_scenario(request.param)
+
+
+@pytest.fixture(scope="module")
+def world(scenario):
+    return crcpp.World(str(scenario.scenario_id), 0, 0.1, "DEU", scenario.lanelet_network, [], scenario.obstacles)
+
+
+@pytest.fixture(scope="module")
+def state_array():
+    states = np.zeros((NUM_STATES, len(crcpp.STATE_DTYPE.names)))
+    states[:, 0] = np.arange(NUM_STATES)
+    states[:, 1] = np.linspace(0.0, 100.0, NUM_STATES)
+    states[:, 4] = 10.0
+    return states
+
+
+def test_create_world(benchmark, scenario):
+    benchmark(crcpp.World, str(scenario.scenario_id), 0, 0.1, "DEU", scenario.lanelet_network, [], scenario.obstacles)
+
+
+def test_lanelet_vertices_objects(benchmark, world):
+    def convert():
+        return [
+            np.array([[vert.x, vert.y] for vert in lanelet.left_border_vertices])
+            for lanelet in world.road_network.lanelets
+        ]
+
+    benchmark(convert)
+
+
+def test_lanelet_vertices_array(benchmark, world):
+    benchmark(lambda: [lanelet.left_border_array for lanelet in world.road_network.lanelets])
+
+
+def test_update_trajectory_objects(benchmark, world, state_array):
+    states = [
+        CustomState(
+            time_step=int(row[0]),
+            position=np.array([row[1], row[2]]),
+            orientation=row[3],
+            velocity=row[4],
+            acceleration=row[5],
+        )
+        for row in state_array
+    ]
+    benchmark(world.obstacles[0].update_trajectory, states)
+
+
+def test_update_trajectory_array(benchmark, world, state_array):
+    benchmark(world.obstacles[0].update_trajectory_array, state_array)
+
+
+def test_obstacle_states_objects(benchmark, world):
+    def convert():
+        return np.array(
+            [
+                [obs.id, obs.get_state_by_time_step(0).x, obs.get_state_by_time_step(0).y]
+                for obs in world.obstacles
+                if obs.time_step_exists(0)
+            ]
+        )
+
+    benchmark(convert)
+
+
+def test_obstacle_states_array(benchmark, world):
+    benchmark(world.obstacle_state_array, 0)
+
+
+@pytest.fixture(scope="module")
+def predicate_entries(world):
+    cars = [obs for obs in world.obstacles if obs.type == crcpp.ObstacleType.car and obs.time_step_exists(0)][:8]
+    pairs = [(obs_k, obs_p) for obs_k in cars for obs_p in cars if obs_k is not obs_p]
+    time_steps = np.zeros(len(pairs), dtype=np.int64)
+    ids_k = np.array([obs_k.id for obs_k, _ in pairs], dtype=np.int64)
+    ids_p = np.array([obs_p.id for _, obs_p in pairs], dtype=np.int64)
+    return pairs, time_steps, ids_k, ids_p
+
+
+def test_predicate_scalar(benchmark, world, predicate_entries):
+    predicate = crcpp.lookup_predicate("in_same_lane_predicate")
+    pairs = predicate_entries[0]
+    benchmark(lambda: [predicate.boolean_evaluation(0, world, obs_k, obs_p) for obs_k, obs_p in pairs])
+
+
+def test_predicate_vectorized(benchmark, world, predicate_entries):
+    predicate = crcpp.lookup_predicate("in_same_lane_predicate")
+    benchmark(predicate.boolean_evaluation_vectorized, world, *predicate_entries[1:])
@@ -41,6 +41,54 @@ class TestPythonInterface(unittest.TestCase):
                 for ts in valid_ts:
                     result = predicate.boolean_evaluation(ts, world, obs_a, obs_b)  # noqa: F841
 
+    def test_vectorized_predicates(self):
+        full_path = Path(self.path + self.filenames[0])
+        scenario = crcpp.read_scenario(str(full_path))
+        world = crcpp.World("foo", 0, scenario.road_network, [], scenario.obstacles, scenario.time_step_size)
+
+        predicate = crcpp.lookup_predicate("in_same_lane_predicate")
+        time_steps, ids_k, ids_p = [], [], []
+        cars = [obs for obs in world.obstacles if obs.type == crcpp.ObstacleType.car]
+        for obs_a, obs_b in [(a, b) for a in cars for b in cars]:
+            for ts in sorted(frozenset(obs_a.get_time_steps()) & frozenset(obs_b.get_time_steps()))[:5]:
+                time_steps.append(ts)
+                ids_k.append(obs_a.id)
+                ids_p.append(obs_b.id)
+        time_steps, ids_k, ids_p = np.array(time_steps), np.array(ids_k), np.array(ids_p)
+
+        result = predicate.boolean_evaluation_vectorized(world, time_steps, ids_k, ids_p)
+        self.assertEqual(result.dtype, np.bool_)
+        self.assertEqual(result.shape, time_steps.shape)
+        obstacles = {obs.id: obs for obs in world.obstacles}
+        for idx in range(0, len(time_steps), 7):
+            self.assertEqual(
+                result[idx],
+                predicate.boolean_evaluation(
+                    int(time_steps[idx]), world, obstacles[int(ids_k[idx])], obstacles[int(ids_p[idx])]
+                ),
+            )
+        np.testing.assert_array_equal(
+            predicate.boolean_evaluation_vectorized(world, time_steps, ids_k, ids_p, numThreads=2), result
+        )
+
+        in_front_of = crcpp.lookup_predicate("in_front_of_predicate")
+        robustness = in_front_of.robust_evaluation_vectorized(world, time_steps, ids_k, ids_p)
+        self.assertEqual(robustness.dtype, np.float64)
+        np.testing.assert_array_equal(
+            in_front_of.boolean_evaluation_vectorized(world, time_steps, ids_k, ids_p), robustness > 0
+        )
+        with self.assertRaises(ValueError):
+            predicate.boolean_evaluation_vectorized(world, time_steps[:-1], ids_k, ids_p)
+        with self.assertRaises(ValueError):
+            in_front_of.boolean_evaluation_vectorized(world, time_steps, ids_k)
+        with self.assertRaises(ValueError):
+            in_front_of.robust_evaluation_vectorized(world, time_steps, ids_k)
+        unknown_id = max(obstacles) + 1
+        with self.assertRaises(ValueError):
+            predicate.boolean_evaluation_vectorized(world, time_steps[:1], np.array([unknown_id]), ids_p[:1])
+        with self.assertRaises(ValueError):
+            in_front_of.robust_evaluation_vectorized(world, time_steps[:1], ids_k[:1], np.array([unknown_id]))
+
     def test_scenario_binding(self):
         for scenario in self.filenames:
             full_path = self.path + scenario
@@ -551,6 +599,37 @@ class TestPythonInterface(unittest.TestCase):
         )
         self.assertEqual(world.obstacles[0].reference_lane_by_time_step(world.road_network, 0), None)
 
+    def test_find_lanelets_by_position(self):
+        full_path = Path(__file__).parent.parent.parent / "tests/scenarios/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"
+        scenario_path_tmp = Path(full_path)
+        map_path = (
+            scenario_path_tmp.parent
+            / f"{scenario_path_tmp.stem.split('_')[0]}_{scenario_path_tmp.stem.split('_')[1]}.pb"
+        )
+        scenario = CommonRoadFileReader(filename_dynamic=full_path, filename_map=map_path).open_map_dynamic()
+        world = crcpp.World(
+            str(scenario.scenario_id),
+            2,
+            0.1,
+            "DEU",
+            scenario.lanelet_network,
+            [],
+            scenario.obstacles,
+        )
+
+        positions = np.array([lanelet.center_vertices[1] for lanelet in scenario.lanelet_network.lanelets[:10]])
+        lanelets = world.road_network.find_lanelets_by_positions(positions)
+        self.assertEqual(len(lanelets), len(positions))
+        for position, lanelets_at_position, lanelet in zip(
+            positions, lanelets, scenario.lanelet_network.lanelets[:10]
+        ):
+            ids = {let.id for let in lanelets_at_position}
+            self.assertIn(lanelet.lanelet_id, ids)
+            self.assertEqual(
+                ids, {let.id for let in world.road_network.find_lanelets_by_position(position[0], position[1])}
+            )
+        self.assertEqual(world.road_network.find_lanelet_by_id(lanelets[0][0].id).id, lanelets[0][0].id)
+
     def test_update_traffic_lights(self):
         full_path = Path(__file__).parent.parent.parent / "tests/scenarios/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"
         scenario_path_tmp = Path(full_path)
@@ -588,6 +667,60 @@ class TestPythonInterface(unittest.TestCase):
         self.assertEqual(light.cycle[1].duration, 2)
         self.assertEqual(light.cycle[1].color, crcpp.TrafficLightState.yellow)
 
+    def test_array_conversion(self):
+        full_path = Path(__file__).parent.parent.parent / "tests/scenarios/USA_Lanker-1/USA_Lanker-1_1_T-1.pb"
+        scenario_path_tmp = Path(full_path)
+        map_path = (
+            scenario_path_tmp.parent
+            / f"{scenario_path_tmp.stem.split('_')[0]}_{scenario_path_tmp.stem.split('_')[1]}.pb"
+        )
+        scenario = CommonRoadFileReader(filename_dynamic=full_path, filename_map=map_path).open_map_dynamic()
+        world = crcpp.World(
+            str(scenario.scenario_id),
+            0,
+            0.1,
+            "DEU",
+            scenario.lanelet_network,
+            [],
+            scenario.obstacles,
+        )
+
+        lanelet = world.road_network.lanelets[0]
+        left = lanelet.left_border_array
+        self.assertEqual(left.shape, (len(lanelet.left_border_vertices), 2))
+        self.assertFalse(left.flags.writeable)
+        self.assertEqual(left[-1, 0], lanelet.left_border_vertices[-1].x)
+        self.assertEqual(lanelet.center_vertices_array.shape[0], len(lanelet.center_vertices))
+
+        poly = crcpp.Polygon(np.array([[0.0, 1.0], [1.0, 0.0], [1.0, 4.0]]))
+        self.assertEqual(poly.vertices[2].y, 4)
+        np.testing.assert_array_equal(poly.vertices_array, [[0.0, 1.0], [1.0, 0.0], [1.0, 4.0]])
+
+        self.assertEqual(crcpp.STATE_DTYPE.names[0], "time_step")
+        obstacle = world.obstacles[0]
+        states = np.array([[5, 1.0, 2.0, 0.5, 3.0, np.nan], [4, 0.0, 1.0, 0.0, 2.0, 1.0]])
+        obstacle.update_trajectory_array(states)
+        self.assertEqual(obstacle.get_state_by_time_step(5).x, 1)
+        self.assertEqual(obstacle.get_state_by_time_step(4).acceleration, 1)
+        trajectory = obstacle.trajectory_prediction_array
+        self.assertEqual(trajectory.dtype, crcpp.STATE_DTYPE)
+        self.assertEqual(trajectory["time_step"].dtype, np.int64)
+        np.testing.assert_array_equal(trajectory["time_step"], [4, 5])
+        self.assertTrue(np.isnan(trajectory["acceleration"][1]))
+        self.assertEqual(len(obstacle.occupancy_vertices(4)), 1)
+        self.assertEqual(obstacle.occupancy_vertices(4)[0].shape[1], 2)
+        trajectory["x"] += 1.0
+        obstacle.update_trajectory_array(trajectory)
+        self.assertEqual(obstacle.get_state_by_time_step(5).x, 2)
+        for time_step in [-1, 0.5, np.inf, np.nan]:
+            with self.assertRaises(ValueError):
+                obstacle.update_trajectory_array(np.array([[time_step, 0.0, 0.0, 0.0, 0.0, 0.0]]))
+
+        obstacle_states = world.obstacle_state_array(4)
+        self.assertEqual(obstacle_states.dtype, crcpp.OBSTACLE_STATE_DTYPE)
+        self.assertEqual(obstacle_states.dtype.names, ("id",) + crcpp.STATE_DTYPE.names)
+        self.assertIn(obstacle.id, obstacle_states["id"])
+
 
 if __name__ == "__main__":
     unittest.main()